@@ -85,6 +85,12 @@ public:
     static RefPtr<SharedMemory> map(const Handle&, Protection);
 #if USE(UNIX_DOMAIN_SOCKETS)
     static RefPtr<SharedMemory> wrapMap(void*, size_t, int fileDescriptor);
+
+    // An empty region which is not mapped and grows as buffers are
+    // appended to it; only meant to be handed over with createHandle().
+    static RefPtr<SharedMemory> allocateGrowable();
+    // Appends the whole buffer, or nothing when the region cannot grow.
+    bool append(const PurCFetcher::SharedBuffer&);
 #endif
 
     ~SharedMemory();
@@ -102,6 +108,10 @@ public:
     static unsigned systemPageSize();
 
 private:
+#if USE(UNIX_DOMAIN_SOCKETS)
+    bool append(const char*, size_t);
+#endif
+
     size_t m_size;
     void* m_data;
 
@@ -29,6 +29,7 @@
 #include "Connection.h"
 #include "MessageSender.h"
 #include "ShareableResource.h"
+#include "SharedMemory.h"
 #include "WebPageProxyIdentifier.h"
 #include "FrameIdentifier.h"
 #include "PageIdentifier.h"
@@ -79,6 +80,7 @@ private:
     void didReceiveResponse(const PurCFetcher::ResourceResponse&, bool);
     void didReceiveData(IPC::DataReference&&, int64_t);
     void didReceiveSharedBuffer(IPC::SharedBufferDataReference&&, int64_t);
+    void didReceiveSharedMemory(const SharedMemory::Handle&, uint64_t);
     void didFinishResourceLoad(const PurCFetcher::NetworkLoadMetrics&);
     void didFailResourceLoad(const PurCFetcher::ResourceError&);
     void didFailServiceWorkerLoad(const PurCFetcher::ResourceError&);
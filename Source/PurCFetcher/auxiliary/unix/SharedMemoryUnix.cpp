@@ -31,8 +31,10 @@
 
 #include "Decoder.h"
 #include "Encoder.h"
+#include "SharedBuffer.h"
 #include <errno.h>
 #include <fcntl.h>
+#include <stdio.h>
 #include <stdlib.h>
 #include <sys/mman.h>
 #include <sys/stat.h>
@@ -179,6 +181,58 @@ RefPtr<SharedMemory> SharedMemory::allocate(size_t size)
     return instance;
 }
 
+RefPtr<SharedMemory> SharedMemory::allocateGrowable()
+{
+    int fileDescriptor = createSharedMemory();
+    if (fileDescriptor == -1) {
+        WTFLogAlways("Failed to create shared memory: %s", strerror(errno));
+        return nullptr;
+    }
+
+    RefPtr<SharedMemory> instance = adoptRef(new SharedMemory());
+    instance->m_data = nullptr;
+    instance->m_fileDescriptor = fileDescriptor;
+    instance->m_size = 0;
+    return instance;
+}
+
+bool SharedMemory::append(const char* data, size_t size)
+{
+    while (size) {
+        ssize_t written = write(m_fileDescriptor.value(), data, size);
+        if (written == -1) {
+            if (errno == EINTR)
+                continue;
+            return false;
+        }
+        data += written;
+        size -= written;
+        m_size += written;
+    }
+    return true;
+}
+
+bool SharedMemory::append(const SharedBuffer& buffer)
+{
+    ASSERT(!m_data);
+    ASSERT(m_fileDescriptor);
+
+    size_t oldSize = m_size;
+    size_t position = 0;
+    while (buffer.size() > position) {
+        auto data = buffer.getSomeData(position);
+        if (!append(data.data(), data.size())) {
+            // Leave the region as it was before this buffer.
+            if (ftruncate(m_fileDescriptor.value(), oldSize) != -1)
+                lseek(m_fileDescriptor.value(), oldSize, SEEK_SET);
+            m_size = oldSize;
+            return false;
+        }
+        position += data.size();
+    }
+    return true;
+}
+
 RefPtr<SharedMemory> SharedMemory::map(const Handle& handle, Protection protection)
 {
     ASSERT(!handle.isNull());
@@ -210,20 +264,49 @@ SharedMemory::~SharedMemory()
     if (m_isWrappingMap)
         return;
 
-    munmap(m_data, m_size);
+    if (m_data)
+        munmap(m_data, m_size);
     if (m_fileDescriptor)
         closeWithRetry(m_fileDescriptor.value());
 }
 
-bool SharedMemory::createHandle(Handle& handle, Protection)
+#if OS(LINUX)
+// A new open file description of the region which only allows reading;
+// a dup() would carry the write access of ours along.
+static int reopenReadOnly(int fileDescriptor)
+{
+    char path[32];
+    snprintf(path, sizeof(path), "/proc/self/fd/%d", fileDescriptor);
+
+    int readOnlyFileDescriptor;
+    do {
+        readOnlyFileDescriptor = open(path, O_RDONLY | O_CLOEXEC);
+    } while (readOnlyFileDescriptor == -1 && errno == EINTR);
+    return readOnlyFileDescriptor;
+}
+#endif
+
+bool SharedMemory::createHandle(Handle& handle, Protection protection)
 {
     ASSERT_ARG(handle, handle.isNull());
     ASSERT(m_fileDescriptor);
 
+    int duplicatedHandle = -1;
+#if OS(LINUX)
+    if (protection == Protection::ReadOnly) {
+        duplicatedHandle = reopenReadOnly(m_fileDescriptor.value());
+        // Without /proc mounted, fall back to a duplicate as elsewhere.
+        if (duplicatedHandle == -1 && errno != ENOENT)
+            return false;
+    }
+#else
     // FIXME: Handle the case where the passed Protection is ReadOnly.
     // See https://bugs.webkit.org/show_bug.cgi?id=131542.
+    UNUSED_PARAM(protection);
+#endif
 
-    int duplicatedHandle = dupCloseOnExec(m_fileDescriptor.value());
+    if (duplicatedHandle == -1)
+        duplicatedHandle = dupCloseOnExec(m_fileDescriptor.value());
     if (duplicatedHandle == -1) {
         ASSERT_NOT_REACHED();
         return false;
@@ -36,6 +36,7 @@
 #include <wtf/threads/BinarySemaphore.h>
 
 #if USE(UNIX_DOMAIN_SOCKETS)
+#include "MessageRing.h"
 #include "UnixMessage.h"
 #endif
 
@@ -864,6 +865,12 @@ void Connection::sendOutgoingMessages()
         if (!sendOutgoingMessage(WTFMove(message)))
             break;
     }
+
+#if USE(UNIX_DOMAIN_SOCKETS)
+    // What is left of this run goes out now.
+    if (platformCanSendOutgoingMessages())
+        flushOutputMessages();
+#endif
 }
 
 void Connection::dispatchSyncMessage(Decoder& decoder)
@@ -27,6 +27,7 @@
 #include "Encoder.h"
 
 #include "DataReference.h"
+#include "MessageBufferPool.h"
 #include "MessageFlags.h"
 #include <algorithm>
 #include <wtf/OptionSet.h>
@@ -36,16 +37,32 @@ namespace IPC {
 static const uint8_t defaultMessageFlags = 0;
 
 template <typename T>
-static inline bool allocBuffer(T*& buffer, size_t size)
+static inline bool allocBuffer(T*& buffer, size_t& size)
 {
-    buffer = static_cast<T*>(fastMalloc(size));
+    buffer = MessageBufferPool::allocate(size);
     return !!buffer;
 }
 
 static inline void freeBuffer(void* addr, size_t size)
 {
-    UNUSED_PARAM(size);
-    fastFree(addr);
+    MessageBufferPool::deallocate(static_cast<uint8_t*>(addr), size);
+}
+
+// The messages carrying a request or a response with its headers seldom
+// fit in the inline buffer. They start on a pooled buffer instead of
+// growing out of it.
+static size_t initialBufferCapacity(MessageName messageName)
+{
+    switch (messageName) {
+    case MessageName::NetworkConnectionToWebProcess_ScheduleResourceLoad:
+    case MessageName::NetworkConnectionToWebProcess_PerformSynchronousLoad:
+    case MessageName::NetworkResourceLoader_ContinueWillSendRequest:
+    case MessageName::WebResourceLoader_WillSendRequest:
+    case MessageName::WebResourceLoader_DidReceiveResponse:
+        return 4096;
+    default:
+        return 0;
+    }
 }
 
 Encoder::Encoder(MessageName messageName, uint64_t destinationID)
@@ -56,6 +73,7 @@ Encoder::Encoder(MessageName messageName, uint64_t destinationID)
     , m_bufferSize(0)
     , m_bufferCapacity(sizeof(m_inlineBuffer))
 {
+    reserve(initialBufferCapacity(messageName));
     encodeHeader();
 }
 
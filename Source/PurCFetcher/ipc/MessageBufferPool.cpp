@@ -0,0 +1,129 @@
+/* 
+ * Copyright (C) 2020 Beijing FMSoft Technologies Co., Ltd.
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ * 
+ * Or,
+ * 
+ * As this component is a program released under LGPLv3, which claims
+ * explicitly that the program could be modified by any end user
+ * even if the program is conveyed in non-source form on the system it runs.
+ * Generally, if you distribute this program in embedded devices,
+ * you might not satisfy this condition. Under this situation or you can
+ * not accept any condition of LGPLv3, you need to get a commercial license
+ * from FMSoft, along with a patent license for the patents owned by FMSoft.
+ * 
+ * If you have got a commercial/patent license of this program, please use it
+ * under the terms and conditions of the commercial license.
+ * 
+ * For more information about the commercial license and patent license,
+ * please refer to
+ * <https://hybridos.fmsoft.cn/blog/hybridos-licensing-policy/>.
+ * 
+ * Also note that the LGPLv3 license does not apply to any entity in the
+ * Exception List published by Beijing FMSoft Technologies Co., Ltd.
+ * 
+ * If you are or the entity you represent is listed in the Exception List,
+ * the above open source or free software license does not apply to you
+ * or the entity you represent. Regardless of the purpose, you should not
+ * use the software in any way whatsoever, including but not limited to
+ * downloading, viewing, copying, distributing, compiling, and running.
+ * If you have already downloaded it, you MUST destroy all of its copies.
+ * 
+ * The Exception List is published by FMSoft and may be updated
+ * from time to time. For more information, please see
+ * <https://www.fmsoft.cn/exception-list>.
+ */ 
+
+#include "config.h"
+#include "MessageBufferPool.h"
+
+#include <wtf/NeverDestroyed.h>
+#include <wtf/StdLibExtras.h>
+#include <wtf/ThreadSpecific.h>
+
+namespace IPC {
+
+// Beyond this, freed buffers go back to the allocator.
+static const size_t maximumCachedSize = 1 * MB;
+
+MessageBufferPool::~MessageBufferPool()
+{
+    for (auto& freeBuffers : m_freeBuffers) {
+        for (auto* buffer : freeBuffers)
+            fastFree(buffer);
+    }
+}
+
+MessageBufferPool& MessageBufferPool::current()
+{
+    static NeverDestroyed<ThreadSpecific<MessageBufferPool>> pools;
+    return *pools.get();
+}
+
+size_t MessageBufferPool::sizeClass(size_t capacity)
+{
+    size_t sizeClass = 0;
+    while (sizeClass < sizeClassCount && capacity > (static_cast<size_t>(1) << (minimumSizeClassShift + sizeClass)))
+        sizeClass++;
+    return sizeClass;
+}
+
+uint8_t* MessageBufferPool::allocate(size_t& capacity)
+{
+    auto& pool = current();
+    pool.m_statistics.allocationCount++;
+
+    size_t sizeClass = MessageBufferPool::sizeClass(capacity);
+    if (sizeClass == sizeClassCount)
+        return static_cast<uint8_t*>(fastMalloc(capacity));
+
+    capacity = static_cast<size_t>(1) << (minimumSizeClassShift + sizeClass);
+    auto& freeBuffers = pool.m_freeBuffers[sizeClass];
+    if (freeBuffers.isEmpty())
+        return static_cast<uint8_t*>(fastMalloc(capacity));
+
+    pool.m_statistics.reuseCount++;
+    pool.m_cachedSize -= capacity;
+    return freeBuffers.takeLast();
+}
+
+void MessageBufferPool::deallocate(uint8_t* buffer, size_t capacity)
+{
+    if (!buffer)
+        return;
+
+    size_t sizeClass = MessageBufferPool::sizeClass(capacity);
+    if (sizeClass == sizeClassCount) {
+        fastFree(buffer);
+        return;
+    }
+
+    auto& pool = current();
+    capacity = static_cast<size_t>(1) << (minimumSizeClassShift + sizeClass);
+    if (pool.m_cachedSize + capacity > maximumCachedSize) {
+        fastFree(buffer);
+        return;
+    }
+
+    pool.m_freeBuffers[sizeClass].append(buffer);
+    pool.m_cachedSize += capacity;
+}
+
+MessageBufferPool::Statistics MessageBufferPool::statistics()
+{
+    return current().m_statistics;
+}
+
+} // namespace IPC
@@ -29,6 +29,7 @@
 #include "Connection.h"
 
 #include "DataReference.h"
+#include "MessageRing.h"
 #include "SharedMemory.h"
 #include "UnixMessage.h"
 #include <sys/socket.h>
@@ -61,6 +62,8 @@ namespace IPC {
 
 static const size_t messageMaxSize = 4096;
 static const size_t attachmentMaxAmount = 254;
+// At most this many messages are gathered in one sendmsg() call.
+static const size_t outputMessagesMaxAmount = 64;
 
 class AttachmentInfo {
     WTF_MAKE_FAST_ALLOCATED;
@@ -135,12 +138,12 @@ bool Connection::processMessage()
     memcpy(&messageInfo, messageData, sizeof(messageInfo));
     messageData += sizeof(messageInfo);
 
-    if (messageInfo.attachmentCount() > attachmentMaxAmount || (!messageInfo.isBodyOutOfLine() && messageInfo.bodySize() > messageMaxSize)) {
+    if (messageInfo.attachmentCount() > attachmentMaxAmount || (messageInfo.isBodyInline() && messageInfo.bodySize() > messageMaxSize)) {
         ASSERT_NOT_REACHED();
         return false;
     }
 
-    size_t messageLength = sizeof(MessageInfo) + messageInfo.attachmentCount() * sizeof(AttachmentInfo) + (messageInfo.isBodyOutOfLine() ? 0 : messageInfo.bodySize());
+    size_t messageLength = sizeof(MessageInfo) + messageInfo.attachmentCount() * sizeof(AttachmentInfo) + (messageInfo.isBodyInline() ? messageInfo.bodySize() : 0);
     if (m_readBuffer.size() < messageLength)
         return false;
 
@@ -165,7 +168,7 @@ bool Connection::processMessage()
             }
         }
 
-        if (messageInfo.isBodyOutOfLine())
+        if (messageInfo.hasBodyAttachment())
             attachmentCount--;
     }
 
@@ -211,14 +214,42 @@ bool Connection::processMessage()
         }
     }
 
-    ASSERT(attachments.size() == (messageInfo.isBodyOutOfLine() ? messageInfo.attachmentCount() - 1 : messageInfo.attachmentCount()));
+    if (messageInfo.attachesRing()) {
+        if (attachmentInfo[attachmentCount].isNull()) {
+            ASSERT_NOT_REACHED();
+            return false;
+        }
 
-    uint8_t* messageBody = messageData;
+        PurCFetcher::SharedMemory::Handle handle;
+        handle.adoptAttachment(IPC::Attachment(m_fileDescriptors[attachmentFileDescriptorCount - 1], attachmentInfo[attachmentCount].size()));
+
+        m_incomingMessageRing = MessageRing::map(handle);
+        if (!m_incomingMessageRing) {
+            ASSERT_NOT_REACHED();
+            return false;
+        }
+    }
+
+    ASSERT(attachments.size() == (messageInfo.hasBodyAttachment() ? messageInfo.attachmentCount() - 1 : messageInfo.attachmentCount()));
+
+    const uint8_t* messageBody = messageData;
     if (messageInfo.isBodyOutOfLine())
         messageBody = reinterpret_cast<uint8_t*>(oolMessageBody->data());
+    else if (messageInfo.isBodyInRing()) {
+        messageBody = m_incomingMessageRing ? m_incomingMessageRing->bodyAt(messageInfo.ringPosition(), messageInfo.bodySize()) : nullptr;
+        if (!messageBody) {
+            ASSERT_NOT_REACHED();
+            return false;
+        }
+    }
 
     auto decoder = makeUnique<Decoder>(messageBody, messageInfo.bodySize(), nullptr, WTFMove(attachments));
 
+    // The decoder has its own copy of the body, its room in the ring can
+    // be written again.
+    if (messageInfo.isBodyInRing())
+        m_incomingMessageRing->release(messageInfo.ringPosition(), messageInfo.bodySize());
+
     //fprintf(stderr, "fetcher|%d|%s|fd=%d|receive|%s|thread=0x%lX\n", getpid(), this->client().connectionName(), m_socketDescriptor, description(decoder->messageName()), pthread_self());
     processIncomingMessage(WTFMove(decoder));
 
@@ -376,9 +407,25 @@ bool Connection::open()
     return true;
 }
 
+static size_t outputMessageSize(const UnixMessage& outputMessage)
+{
+    size_t size = sizeof(MessageInfo) + outputMessage.attachments().size() * sizeof(AttachmentInfo);
+    if (outputMessage.messageInfo().isBodyInline())
+        size += outputMessage.bodySize();
+    return size;
+}
+
+static size_t outputMessageFileDescriptorCount(const UnixMessage& outputMessage)
+{
+    return std::count_if(outputMessage.attachments().begin(), outputMessage.attachments().end(),
+        [](const Attachment& attachment) {
+            return attachment.fileDescriptor() != -1;
+        });
+}
+
 bool Connection::platformCanSendOutgoingMessages() const
 {
-    return !m_pendingOutputMessage;
+    return !m_isWaitingForSocket;
 }
 
 bool Connection::sendOutgoingMessage(std::unique_ptr<Encoder> encoder)
@@ -386,128 +433,201 @@ bool Connection::sendOutgoingMessage(std::unique_ptr<Encoder> encoder)
     //fprintf(stderr, "fetcher|%d|%s|fd=%d|send|%s\n", getpid(), client().connectionName(), m_socketDescriptor, description(encoder->messageName()));
     COMPILE_ASSERT(sizeof(MessageInfo) + attachmentMaxAmount * sizeof(size_t) <= messageMaxSize, AttachmentsFitToMessageInline);
 
-    UnixMessage outputMessage(*encoder);
-    if (outputMessage.attachments().size() > (attachmentMaxAmount - 1)) {
+    // The message keeps the encoder, and its body, until it is sent.
+    auto outputMessage = makeUnique<UnixMessage>(WTFMove(encoder));
+    if (outputMessage->attachments().size() > (attachmentMaxAmount - 1)) {
         ASSERT_NOT_REACHED();
         return false;
     }
 
-    size_t messageSizeWithBodyInline = sizeof(MessageInfo) + (outputMessage.attachments().size() * sizeof(AttachmentInfo)) + outputMessage.bodySize();
-    if (messageSizeWithBodyInline > messageMaxSize && outputMessage.bodySize()) {
-        RefPtr<PurCFetcher::SharedMemory> oolMessageBody = PurCFetcher::SharedMemory::allocate(encoder->bufferSize());
-        if (!oolMessageBody)
-            return false;
+    size_t messageSizeWithBodyInline = sizeof(MessageInfo) + (outputMessage->attachments().size() * sizeof(AttachmentInfo)) + outputMessage->bodySize();
+    if (messageSizeWithBodyInline > messageMaxSize && outputMessage->bodySize()) {
+        // Through the ring, a body only costs a copy: no memory is created,
+        // mapped and passed on the socket for each message.
+        Optional<uint64_t> position;
+        PurCFetcher::SharedMemory::Handle ringHandle;
+        bool attachesRing = false;
+        if (outputMessage->bodySize() <= MessageRing::maxBodySize) {
+            if (!m_outgoingMessageRing && !m_didFailToCreateMessageRing) {
+                m_outgoingMessageRing = MessageRing::create();
+                if (m_outgoingMessageRing && m_outgoingMessageRing->createHandle(ringHandle))
+                    attachesRing = true;
+                else {
+                    m_outgoingMessageRing = nullptr;
+                    m_didFailToCreateMessageRing = true;
+                }
+            }
 
-        PurCFetcher::SharedMemory::Handle handle;
-        if (!oolMessageBody->createHandle(handle, PurCFetcher::SharedMemory::Protection::ReadOnly))
-            return false;
+            if (m_outgoingMessageRing)
+                position = m_outgoingMessageRing->write(outputMessage->body(), outputMessage->bodySize());
+        }
+
+        if (position) {
+            outputMessage->messageInfo().setBodyInRing(*position, attachesRing);
+            if (attachesRing)
+                outputMessage->appendAttachment(ringHandle.releaseAttachment());
+        } else {
+            // The body is too large for the ring, or the receiver lags behind.
+            RefPtr<PurCFetcher::SharedMemory> oolMessageBody = PurCFetcher::SharedMemory::allocate(outputMessage->bodySize());
+            if (!oolMessageBody)
+                return false;
 
-        outputMessage.messageInfo().setBodyOutOfLine();
+            PurCFetcher::SharedMemory::Handle handle;
+            if (!oolMessageBody->createHandle(handle, PurCFetcher::SharedMemory::Protection::ReadOnly))
+                return false;
 
-        memcpy(oolMessageBody->data(), outputMessage.body(), outputMessage.bodySize());
+            outputMessage->messageInfo().setBodyOutOfLine();
 
-        outputMessage.appendAttachment(handle.releaseAttachment());
+            memcpy(oolMessageBody->data(), outputMessage->body(), outputMessage->bodySize());
+
+            outputMessage->appendAttachment(handle.releaseAttachment());
+        }
     }
 
-    return sendOutputMessage(outputMessage);
+    // The messages are gathered and sent together when there is enough of
+    // them to fill a packet, or at the end of sendOutgoingMessages().
+    m_outputMessagesSize += outputMessageSize(*outputMessage);
+    m_outputMessages.append(WTFMove(outputMessage));
+    if (m_outputMessagesSize < messageMaxSize)
+        return true;
+
+    return flushOutputMessages();
 }
 
-bool Connection::sendOutputMessage(UnixMessage& outputMessage)
+bool Connection::flushOutputMessages()
 {
-    ASSERT(!m_pendingOutputMessage);
+    while (!m_outputMessages.isEmpty()) {
+        // As many messages as the receiver reads with one recvmsg().
+        size_t count = 0;
+        size_t size = 0;
+        size_t fileDescriptorCount = 0;
+        for (auto& outputMessage : m_outputMessages) {
+            size_t messageSize = outputMessageSize(*outputMessage);
+            size_t messageFileDescriptorCount = outputMessageFileDescriptorCount(*outputMessage);
+            if (count && (count == outputMessagesMaxAmount || size + messageSize > messageMaxSize || fileDescriptorCount + messageFileDescriptorCount > attachmentMaxAmount))
+                break;
 
-    auto& messageInfo = outputMessage.messageInfo();
-    struct msghdr message;
-    memset(&message, 0, sizeof(message));
+            count++;
+            size += messageSize;
+            fileDescriptorCount += messageFileDescriptorCount;
+        }
 
-    struct iovec iov[3];
-    memset(&iov, 0, sizeof(iov));
+        bool sent = sendOutputMessages(count);
+        if (!sent && m_isWaitingForSocket)
+            return false;
 
-    message.msg_iov = iov;
-    int iovLength = 1;
+        // The messages failing for another reason are dropped.
+        m_outputMessages.remove(0, count);
+        m_outputMessagesSize -= size;
+        if (!sent)
+            return false;
+    }
+    return true;
+}
+
+bool Connection::sendOutputMessages(size_t count)
+{
+    ASSERT(!m_isWaitingForSocket);
+    ASSERT(count && count <= m_outputMessages.size());
 
-    iov[0].iov_base = reinterpret_cast<void*>(&messageInfo);
-    iov[0].iov_len = sizeof(messageInfo);
+    struct msghdr message;
+    memset(&message, 0, sizeof(message));
 
+    Vector<struct iovec, 3 * outputMessagesMaxAmount> iov;
     Vector<AttachmentInfo> attachmentInfo;
     MallocPtr<char> attachmentFDBuffer;
 
-    auto& attachments = outputMessage.attachments();
-    if (!attachments.isEmpty()) {
-        int* fdPtr = 0;
-
-        size_t attachmentFDBufferLength = std::count_if(attachments.begin(), attachments.end(),
-            [](const Attachment& attachment) {
-                return attachment.fileDescriptor() != -1;
-            });
-
-        if (attachmentFDBufferLength) {
-            attachmentFDBuffer = MallocPtr<char>::malloc(sizeof(char) * CMSG_SPACE(sizeof(int) * attachmentFDBufferLength));
+    size_t attachmentCount = 0;
+    size_t attachmentFDBufferLength = 0;
+    for (size_t i = 0; i < count; ++i) {
+        attachmentCount += m_outputMessages[i]->attachments().size();
+        attachmentFDBufferLength += outputMessageFileDescriptorCount(*m_outputMessages[i]);
+    }
 
-            message.msg_control = attachmentFDBuffer.get();
-            message.msg_controllen = CMSG_SPACE(sizeof(int) * attachmentFDBufferLength);
-            memset(message.msg_control, 0, message.msg_controllen);
+    // The file descriptors of all the messages go in one control message,
+    // in the order of the messages; processMessage() takes them that way.
+    int* fdPtr = 0;
+    if (attachmentFDBufferLength) {
+        attachmentFDBuffer = MallocPtr<char>::malloc(sizeof(char) * CMSG_SPACE(sizeof(int) * attachmentFDBufferLength));
 
-            struct cmsghdr* cmsg = CMSG_FIRSTHDR(&message);
-            cmsg->cmsg_level = SOL_SOCKET;
-            cmsg->cmsg_type = SCM_RIGHTS;
-            cmsg->cmsg_len = CMSG_LEN(sizeof(int) * attachmentFDBufferLength);
+        message.msg_control = attachmentFDBuffer.get();
+        message.msg_controllen = CMSG_SPACE(sizeof(int) * attachmentFDBufferLength);
+        memset(message.msg_control, 0, message.msg_controllen);
 
-            fdPtr = reinterpret_cast<int*>(CMSG_DATA(cmsg));
-        }
+        struct cmsghdr* cmsg = CMSG_FIRSTHDR(&message);
+        cmsg->cmsg_level = SOL_SOCKET;
+        cmsg->cmsg_type = SCM_RIGHTS;
+        cmsg->cmsg_len = CMSG_LEN(sizeof(int) * attachmentFDBufferLength);
 
-        attachmentInfo.resize(attachments.size());
-        int fdIndex = 0;
-        for (size_t i = 0; i < attachments.size(); ++i) {
-            attachmentInfo[i].setType(attachments[i].type());
+        fdPtr = reinterpret_cast<int*>(CMSG_DATA(cmsg));
+    }
 
-            switch (attachments[i].type()) {
-            case Attachment::MappedMemoryType:
-                attachmentInfo[i].setSize(attachments[i].size());
-                FALLTHROUGH;
-            case Attachment::SocketType:
-                if (attachments[i].fileDescriptor() != -1) {
-                    ASSERT(fdPtr);
-                    fdPtr[fdIndex++] = attachments[i].fileDescriptor();
-                } else
-                    attachmentInfo[i].setNull();
-                break;
-            case Attachment::Uninitialized:
-            default:
-                break;
+    // Not reallocated below, the iovec points into it.
+    attachmentInfo.resize(attachmentCount);
+
+    int fdIndex = 0;
+    size_t attachmentIndex = 0;
+    for (size_t i = 0; i < count; ++i) {
+        auto& outputMessage = *m_outputMessages[i];
+        auto& messageInfo = outputMessage.messageInfo();
+
+        iov.append({ reinterpret_cast<void*>(&messageInfo), sizeof(messageInfo) });
+
+        auto& attachments = outputMessage.attachments();
+        if (!attachments.isEmpty()) {
+            AttachmentInfo* messageAttachmentInfo = attachmentInfo.data() + attachmentIndex;
+            for (size_t j = 0; j < attachments.size(); ++j) {
+                messageAttachmentInfo[j].setType(attachments[j].type());
+
+                switch (attachments[j].type()) {
+                case Attachment::MappedMemoryType:
+                    messageAttachmentInfo[j].setSize(attachments[j].size());
+                    FALLTHROUGH;
+                case Attachment::SocketType:
+                    if (attachments[j].fileDescriptor() != -1) {
+                        ASSERT(fdPtr);
+                        fdPtr[fdIndex++] = attachments[j].fileDescriptor();
+                    } else
+                        messageAttachmentInfo[j].setNull();
+                    break;
+                case Attachment::Uninitialized:
+                default:
+                    break;
+                }
             }
+
+            iov.append({ reinterpret_cast<void*>(messageAttachmentInfo), sizeof(AttachmentInfo) * attachments.size() });
+            attachmentIndex += attachments.size();
         }
 
-        iov[iovLength].iov_base = attachmentInfo.data();
-        iov[iovLength].iov_len = sizeof(AttachmentInfo) * attachments.size();
-        ++iovLength;
+        if (messageInfo.isBodyInline() && outputMessage.bodySize())
+            iov.append({ reinterpret_cast<void*>(outputMessage.body()), outputMessage.bodySize() });
     }
 
-    if (!messageInfo.isBodyOutOfLine() && outputMessage.bodySize()) {
-        iov[iovLength].iov_base = reinterpret_cast<void*>(outputMessage.body());
-        iov[iovLength].iov_len = outputMessage.bodySize();
-        ++iovLength;
-    }
+    message.msg_iov = iov.data();
+    message.msg_iovlen = iov.size();
 
-    message.msg_iovlen = iovLength;
+    while (true) {
+        m_sendmsgCount++;
+        if (sendmsg(m_socketDescriptor, &message, MSG_NOSIGNAL) != -1)
+            break;
 
-    while (sendmsg(m_socketDescriptor, &message, MSG_NOSIGNAL) == -1) {
         if (errno == EINTR)
             continue;
         if (errno == EAGAIN || errno == EWOULDBLOCK) {
 #if USE(GLIB)
-            m_pendingOutputMessage = makeUnique<UnixMessage>(WTFMove(outputMessage));
+            // The messages stay queued, the following ones wait in
+            // m_outgoingMessages until they are sent.
+            m_isWaitingForSocket = true;
             m_writeSocketMonitor.start(m_socket.get(), G_IO_OUT, m_connectionQueue->runLoop(), [this, protectedThis = makeRef(*this)] (GIOCondition condition) -> gboolean {
                 if (condition & G_IO_OUT) {
-                    ASSERT(m_pendingOutputMessage);
+                    ASSERT(m_isWaitingForSocket);
                     // We can't stop the monitor from this lambda, because stop destroys the lambda.
                     m_connectionQueue->dispatch([this, protectedThis = makeRef(*this)] {
                         m_writeSocketMonitor.stop();
-                        auto message = WTFMove(m_pendingOutputMessage);
-                        if (m_isConnected) {
-                            sendOutputMessage(*message);
+                        m_isWaitingForSocket = false;
+                        if (m_isConnected && flushOutputMessages())
                             sendOutgoingMessages();
-                        }
                     });
                 }
                 return G_SOURCE_REMOVE;
@@ -539,6 +659,8 @@ bool Connection::sendOutputMessage(UnixMessage& outputMessage)
             WTFLogAlways("Error sending IPC message: %s", strerror(errno));
         return false;
     }
+
+    m_outputMessageCount += count;
     return true;
 }
 
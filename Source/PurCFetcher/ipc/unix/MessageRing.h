@@ -0,0 +1,102 @@
+/* 
+ * Copyright (C) 2020 Beijing FMSoft Technologies Co., Ltd.
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ * 
+ * Or,
+ * 
+ * As this component is a program released under LGPLv3, which claims
+ * explicitly that the program could be modified by any end user
+ * even if the program is conveyed in non-source form on the system it runs.
+ * Generally, if you distribute this program in embedded devices,
+ * you might not satisfy this condition. Under this situation or you can
+ * not accept any condition of LGPLv3, you need to get a commercial license
+ * from FMSoft, along with a patent license for the patents owned by FMSoft.
+ * 
+ * If you have got a commercial/patent license of this program, please use it
+ * under the terms and conditions of the commercial license.
+ * 
+ * For more information about the commercial license and patent license,
+ * please refer to
+ * <https://hybridos.fmsoft.cn/blog/hybridos-licensing-policy/>.
+ * 
+ * Also note that the LGPLv3 license does not apply to any entity in the
+ * Exception List published by Beijing FMSoft Technologies Co., Ltd.
+ * 
+ * If you are or the entity you represent is listed in the Exception List,
+ * the above open source or free software license does not apply to you
+ * or the entity you represent. Regardless of the purpose, you should not
+ * use the software in any way whatsoever, including but not limited to
+ * downloading, viewing, copying, distributing, compiling, and running.
+ * If you have already downloaded it, you MUST destroy all of its copies.
+ * 
+ * The Exception List is published by FMSoft and may be updated
+ * from time to time. For more information, please see
+ * <https://www.fmsoft.cn/exception-list>.
+ */ 
+
+#pragma once
+
+#include "SharedMemory.h"
+#include <atomic>
+#include <wtf/StdLibExtras.h>
+#include <wtf/Optional.h>
+
+namespace IPC {
+
+// A ring of shared memory carrying the message bodies too large to be sent
+// inline on the socket, in one direction of a connection. The sender
+// creates it for its first large message and passes it along with that
+// message; later messages only give the position of their body.
+//
+// The bodies are read in the order they were written, so the ring only
+// keeps two positions: the sender's write position, which stays private,
+// and the receiver's read position, shared in the header of the memory.
+class MessageRing {
+    WTF_MAKE_FAST_ALLOCATED;
+    WTF_MAKE_NONCOPYABLE(MessageRing);
+public:
+    static std::unique_ptr<MessageRing> create();
+    static std::unique_ptr<MessageRing> map(const PurCFetcher::SharedMemory::Handle&);
+
+    bool createHandle(PurCFetcher::SharedMemory::Handle&);
+
+    // The larger bodies still go through a SharedMemory of their own.
+    static constexpr size_t maxBodySize = 1 * MB;
+
+    // Sender side: copies a body in the ring and returns its position, or
+    // nullopt when the receiver has not released enough space yet.
+    Optional<uint64_t> write(const uint8_t* body, size_t);
+
+    // Receiver side.
+    const uint8_t* bodyAt(uint64_t position, size_t) const;
+    void release(uint64_t position, size_t);
+
+private:
+    struct Header {
+        alignas(64) std::atomic<uint64_t> readPosition;
+    };
+    static_assert(std::atomic<uint64_t>::is_always_lock_free, "The read position is shared between processes.");
+
+    explicit MessageRing(Ref<PurCFetcher::SharedMemory>&&);
+
+    Header& header() const { return *static_cast<Header*>(m_memory->data()); }
+    uint8_t* data() const { return static_cast<uint8_t*>(m_memory->data()) + sizeof(Header); }
+
+    Ref<PurCFetcher::SharedMemory> m_memory;
+    size_t m_capacity;
+    uint64_t m_writePosition { 0 };
+};
+
+} // namespace IPC
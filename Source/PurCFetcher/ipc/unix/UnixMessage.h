@@ -28,6 +28,7 @@
 #pragma once
 
 #include "Attachment.h"
+#include "Encoder.h"
 #include <wtf/Vector.h>
 
 namespace IPC {
@@ -56,14 +57,38 @@ public:
         m_attachmentCount++;
     }
 
+    // The body is in the MessageRing of the sender, which comes as the
+    // last attachment of the first message using it.
+    void setBodyInRing(uint64_t position, bool attachesRing)
+    {
+        ASSERT(!isBodyOutOfLine() && !isBodyInRing());
+
+        m_ringPosition = position;
+        m_isBodyInRing = true;
+        if (attachesRing) {
+            m_attachesRing = true;
+            m_attachmentCount++;
+        }
+    }
+
     bool isBodyOutOfLine() const { return m_isBodyOutOfLine; }
+    bool isBodyInRing() const { return m_isBodyInRing; }
+    bool isBodyInline() const { return !m_isBodyOutOfLine && !m_isBodyInRing; }
+    bool attachesRing() const { return m_attachesRing; }
+    uint64_t ringPosition() const { return m_ringPosition; }
     size_t bodySize() const { return m_bodySize; }
     size_t attachmentCount() const { return m_attachmentCount; }
 
+    // The out of line body or the ring is the last attachment.
+    bool hasBodyAttachment() const { return m_isBodyOutOfLine || m_attachesRing; }
+
 private:
     size_t m_bodySize { 0 };
     size_t m_attachmentCount { 0 };
+    uint64_t m_ringPosition { 0 };
     bool m_isBodyOutOfLine { false };
+    bool m_isBodyInRing { false };
+    bool m_attachesRing { false };
 };
 
 class UnixMessage {
@@ -76,14 +101,26 @@ public:
     {
     }
 
+    // Keeps the encoder, so the body stays valid until the message is sent.
+    UnixMessage(std::unique_ptr<Encoder>&& encoder)
+        : m_encoder(WTFMove(encoder))
+        , m_attachments(m_encoder->releaseAttachments())
+        , m_messageInfo(m_encoder->bufferSize(), m_attachments.size())
+        , m_body(m_encoder->buffer())
+    {
+    }
+
     UnixMessage(UnixMessage&& other)
     {
         m_attachments = WTFMove(other.m_attachments);
         m_messageInfo = WTFMove(other.m_messageInfo);
-        if (other.m_bodyOwned) {
+        if (other.m_encoder) {
+            m_encoder = WTFMove(other.m_encoder);
+            m_body = std::exchange(other.m_body, nullptr);
+        } else if (other.m_bodyOwned) {
             std::swap(m_body, other.m_body);
             std::swap(m_bodyOwned, other.m_bodyOwned);
-        } else if (!m_messageInfo.isBodyOutOfLine()) {
+        } else if (m_messageInfo.isBodyInline()) {
             m_body = static_cast<uint8_t*>(fastMalloc(m_messageInfo.bodySize()));
             memcpy(m_body, other.m_body, m_messageInfo.bodySize());
             m_bodyOwned = true;
@@ -100,6 +137,7 @@ public:
 
     const Vector<Attachment>& attachments() const { return m_attachments; }
     MessageInfo& messageInfo() { return m_messageInfo; }
+    const MessageInfo& messageInfo() const { return m_messageInfo; }
 
     uint8_t* body() const { return m_body; }
     size_t bodySize() const  { return m_messageInfo.bodySize(); }
@@ -110,6 +148,7 @@ public:
     }
 
 private:
+    std::unique_ptr<Encoder> m_encoder;
     Vector<Attachment> m_attachments;
     MessageInfo m_messageInfo;
     uint8_t* m_body { nullptr };
@@ -1232,6 +1232,8 @@ const char* description(MessageName name)
         return "NetworkResourceLoader::ContinueWillSendRequest";
     case MessageName::NetworkResourceLoader_ContinueDidReceiveResponse:
         return "NetworkResourceLoader::ContinueDidReceiveResponse";
+    case MessageName::NetworkResourceLoader_SetDefersLoading:
+        return "NetworkResourceLoader::SetDefersLoading";
     case MessageName::NetworkSocketChannel_SendString:
         return "NetworkSocketChannel::SendString";
     case MessageName::NetworkSocketChannel_SendStringReply:
@@ -3732,6 +3734,8 @@ const char* description(MessageName name)
         return "WebResourceLoader::DidReceiveData";
     case MessageName::WebResourceLoader_DidReceiveSharedBuffer:
         return "WebResourceLoader::DidReceiveSharedBuffer";
+    case MessageName::WebResourceLoader_DidReceiveSharedMemory:
+        return "WebResourceLoader::DidReceiveSharedMemory";
     case MessageName::WebResourceLoader_DidFinishResourceLoad:
         return "WebResourceLoader::DidFinishResourceLoad";
     case MessageName::WebResourceLoader_DidFailResourceLoad:
@@ -5825,6 +5829,7 @@ ReceiverName receiverName(MessageName messageName)
         return ReceiverName::NetworkProcess;
     case MessageName::NetworkResourceLoader_ContinueWillSendRequest:
     case MessageName::NetworkResourceLoader_ContinueDidReceiveResponse:
+    case MessageName::NetworkResourceLoader_SetDefersLoading:
         return ReceiverName::NetworkResourceLoader;
     case MessageName::NetworkSocketChannel_SendString:
     case MessageName::NetworkSocketChannel_SendData:
@@ -7349,6 +7354,7 @@ ReceiverName receiverName(MessageName messageName)
     case MessageName::WebResourceLoader_DidReceiveResponse:
     case MessageName::WebResourceLoader_DidReceiveData:
     case MessageName::WebResourceLoader_DidReceiveSharedBuffer:
+    case MessageName::WebResourceLoader_DidReceiveSharedMemory:
     case MessageName::WebResourceLoader_DidFinishResourceLoad:
     case MessageName::WebResourceLoader_DidFailResourceLoad:
     case MessageName::WebResourceLoader_DidFailServiceWorkerLoad:
@@ -9905,6 +9911,8 @@ bool isValidMessageName(MessageName messageName)
         return true;
     if (messageName == IPC::MessageName::NetworkResourceLoader_ContinueDidReceiveResponse)
         return true;
+    if (messageName == IPC::MessageName::NetworkResourceLoader_SetDefersLoading)
+        return true;
     if (messageName == IPC::MessageName::NetworkSocketChannel_SendString)
         return true;
     if (messageName == IPC::MessageName::NetworkSocketChannel_SendStringReply)
@@ -12405,6 +12413,8 @@ bool isValidMessageName(MessageName messageName)
         return true;
     if (messageName == IPC::MessageName::WebResourceLoader_DidReceiveSharedBuffer)
         return true;
+    if (messageName == IPC::MessageName::WebResourceLoader_DidReceiveSharedMemory)
+        return true;
     if (messageName == IPC::MessageName::WebResourceLoader_DidFinishResourceLoad)
         return true;
     if (messageName == IPC::MessageName::WebResourceLoader_DidFailResourceLoad)
@@ -850,2471 +850,2473 @@ enum class MessageName : uint16_t {
     , NetworkProcess_ClearBundleIdentifierReply = 489
     , NetworkResourceLoader_ContinueWillSendRequest = 490
     , NetworkResourceLoader_ContinueDidReceiveResponse = 491
-    , NetworkSocketChannel_SendString = 492
-    , NetworkSocketChannel_SendStringReply = 493
-    , NetworkSocketChannel_SendData = 494
-    , NetworkSocketChannel_SendDataReply = 495
-    , NetworkSocketChannel_Close = 496
-    , NetworkSocketStream_SendData = 497
-    , NetworkSocketStream_SendHandshake = 498
-    , NetworkSocketStream_Close = 499
-    , ServiceWorkerFetchTask_DidNotHandle = 500
-    , ServiceWorkerFetchTask_DidFail = 501
-    , ServiceWorkerFetchTask_DidReceiveRedirectResponse = 502
-    , ServiceWorkerFetchTask_DidReceiveResponse = 503
-    , ServiceWorkerFetchTask_DidReceiveData = 504
-    , ServiceWorkerFetchTask_DidReceiveSharedBuffer = 505
-    , ServiceWorkerFetchTask_DidReceiveFormData = 506
-    , ServiceWorkerFetchTask_DidFinish = 507
-    , WebSWServerConnection_ScheduleJobInServer = 508
-    , WebSWServerConnection_ScheduleUnregisterJobInServer = 509
-    , WebSWServerConnection_ScheduleUnregisterJobInServerReply = 510
-    , WebSWServerConnection_FinishFetchingScriptInServer = 511
-    , WebSWServerConnection_AddServiceWorkerRegistrationInServer = 512
-    , WebSWServerConnection_RemoveServiceWorkerRegistrationInServer = 513
-    , WebSWServerConnection_PostMessageToServiceWorker = 514
-    , WebSWServerConnection_DidResolveRegistrationPromise = 515
-    , WebSWServerConnection_MatchRegistration = 516
-    , WebSWServerConnection_WhenRegistrationReady = 517
-    , WebSWServerConnection_GetRegistrations = 518
-    , WebSWServerConnection_RegisterServiceWorkerClient = 519
-    , WebSWServerConnection_UnregisterServiceWorkerClient = 520
-    , WebSWServerConnection_TerminateWorkerFromClient = 521
-    , WebSWServerConnection_TerminateWorkerFromClientReply = 522
-    , WebSWServerConnection_WhenServiceWorkerIsTerminatedForTesting = 523
-    , WebSWServerConnection_WhenServiceWorkerIsTerminatedForTestingReply = 524
-    , WebSWServerConnection_SetThrottleState = 525
-    , WebSWServerConnection_StoreRegistrationsOnDisk = 526
-    , WebSWServerConnection_StoreRegistrationsOnDiskReply = 527
-    , WebSWServerToContextConnection_ScriptContextFailedToStart = 528
-    , WebSWServerToContextConnection_ScriptContextStarted = 529
-    , WebSWServerToContextConnection_DidFinishInstall = 530
-    , WebSWServerToContextConnection_DidFinishActivation = 531
-    , WebSWServerToContextConnection_SetServiceWorkerHasPendingEvents = 532
-    , WebSWServerToContextConnection_SkipWaiting = 533
-    , WebSWServerToContextConnection_SkipWaitingReply = 534
-    , WebSWServerToContextConnection_WorkerTerminated = 535
-    , WebSWServerToContextConnection_FindClientByIdentifier = 536
-    , WebSWServerToContextConnection_MatchAll = 537
-    , WebSWServerToContextConnection_Claim = 538
-    , WebSWServerToContextConnection_ClaimReply = 539
-    , WebSWServerToContextConnection_SetScriptResource = 540
-    , WebSWServerToContextConnection_PostMessageToServiceWorkerClient = 541
-    , WebSWServerToContextConnection_DidFailHeartBeatCheck = 542
-    , StorageManagerSet_ConnectToLocalStorageArea = 543
-    , StorageManagerSet_ConnectToTransientLocalStorageArea = 544
-    , StorageManagerSet_ConnectToSessionStorageArea = 545
-    , StorageManagerSet_DisconnectFromStorageArea = 546
-    , StorageManagerSet_GetValues = 547
-    , StorageManagerSet_CloneSessionStorageNamespace = 548
-    , StorageManagerSet_SetItem = 549
-    , StorageManagerSet_RemoveItem = 550
-    , StorageManagerSet_Clear = 551
-    , CacheStorageEngineConnection_Reference = 552
-    , CacheStorageEngineConnection_Dereference = 553
-    , CacheStorageEngineConnection_Open = 554
-    , CacheStorageEngineConnection_OpenReply = 555
-    , CacheStorageEngineConnection_Remove = 556
-    , CacheStorageEngineConnection_RemoveReply = 557
-    , CacheStorageEngineConnection_Caches = 558
-    , CacheStorageEngineConnection_CachesReply = 559
-    , CacheStorageEngineConnection_RetrieveRecords = 560
-    , CacheStorageEngineConnection_RetrieveRecordsReply = 561
-    , CacheStorageEngineConnection_DeleteMatchingRecords = 562
-    , CacheStorageEngineConnection_DeleteMatchingRecordsReply = 563
-    , CacheStorageEngineConnection_PutRecords = 564
-    , CacheStorageEngineConnection_PutRecordsReply = 565
-    , CacheStorageEngineConnection_ClearMemoryRepresentation = 566
-    , CacheStorageEngineConnection_ClearMemoryRepresentationReply = 567
-    , CacheStorageEngineConnection_EngineRepresentation = 568
-    , CacheStorageEngineConnection_EngineRepresentationReply = 569
-    , NetworkMDNSRegister_UnregisterMDNSNames = 570
-    , NetworkMDNSRegister_RegisterMDNSName = 571
-    , NetworkRTCMonitor_StartUpdatingIfNeeded = 572
-    , NetworkRTCMonitor_StopUpdating = 573
-    , NetworkRTCProvider_CreateUDPSocket = 574
-    , NetworkRTCProvider_CreateServerTCPSocket = 575
-    , NetworkRTCProvider_CreateClientTCPSocket = 576
-    , NetworkRTCProvider_WrapNewTCPConnection = 577
-    , NetworkRTCProvider_CreateResolver = 578
-    , NetworkRTCProvider_StopResolver = 579
-    , NetworkRTCSocket_SendTo = 580
-    , NetworkRTCSocket_Close = 581
-    , NetworkRTCSocket_SetOption = 582
-    , PluginControllerProxy_GeometryDidChange = 583
-    , PluginControllerProxy_VisibilityDidChange = 584
-    , PluginControllerProxy_FrameDidFinishLoading = 585
-    , PluginControllerProxy_FrameDidFail = 586
-    , PluginControllerProxy_DidEvaluateJavaScript = 587
-    , PluginControllerProxy_StreamWillSendRequest = 588
-    , PluginControllerProxy_StreamDidReceiveResponse = 589
-    , PluginControllerProxy_StreamDidReceiveData = 590
-    , PluginControllerProxy_StreamDidFinishLoading = 591
-    , PluginControllerProxy_StreamDidFail = 592
-    , PluginControllerProxy_ManualStreamDidReceiveResponse = 593
-    , PluginControllerProxy_ManualStreamDidReceiveData = 594
-    , PluginControllerProxy_ManualStreamDidFinishLoading = 595
-    , PluginControllerProxy_ManualStreamDidFail = 596
-    , PluginControllerProxy_HandleMouseEvent = 597
-    , PluginControllerProxy_HandleWheelEvent = 598
-    , PluginControllerProxy_HandleMouseEnterEvent = 599
-    , PluginControllerProxy_HandleMouseLeaveEvent = 600
-    , PluginControllerProxy_HandleKeyboardEvent = 601
-    , PluginControllerProxy_HandleEditingCommand = 602
-    , PluginControllerProxy_IsEditingCommandEnabled = 603
-    , PluginControllerProxy_HandlesPageScaleFactor = 604
-    , PluginControllerProxy_RequiresUnifiedScaleFactor = 605
-    , PluginControllerProxy_SetFocus = 606
-    , PluginControllerProxy_DidUpdate = 607
-    , PluginControllerProxy_PaintEntirePlugin = 608
-    , PluginControllerProxy_GetPluginScriptableNPObject = 609
-    , PluginControllerProxy_WindowFocusChanged = 610
-    , PluginControllerProxy_WindowVisibilityChanged = 611
-#if PLATFORM(COCOA)
-    , PluginControllerProxy_SendComplexTextInput = 612
-#endif
-#if PLATFORM(COCOA)
-    , PluginControllerProxy_WindowAndViewFramesChanged = 613
-#endif
-#if PLATFORM(COCOA)
-    , PluginControllerProxy_SetLayerHostingMode = 614
-#endif
-    , PluginControllerProxy_SupportsSnapshotting = 615
-    , PluginControllerProxy_Snapshot = 616
-    , PluginControllerProxy_StorageBlockingStateChanged = 617
-    , PluginControllerProxy_PrivateBrowsingStateChanged = 618
-    , PluginControllerProxy_GetFormValue = 619
-    , PluginControllerProxy_MutedStateChanged = 620
-    , PluginProcess_InitializePluginProcess = 621
-    , PluginProcess_CreateWebProcessConnection = 622
-    , PluginProcess_GetSitesWithData = 623
-    , PluginProcess_DeleteWebsiteData = 624
-    , PluginProcess_DeleteWebsiteDataForHostNames = 625
-#if PLATFORM(COCOA)
-    , PluginProcess_SetQOS = 626
-#endif
-    , WebProcessConnection_CreatePlugin = 627
-    , WebProcessConnection_CreatePluginAsynchronously = 628
-    , WebProcessConnection_DestroyPlugin = 629
-    , AuxiliaryProcess_ShutDown = 630
-    , AuxiliaryProcess_SetProcessSuppressionEnabled = 631
+    , NetworkResourceLoader_SetDefersLoading = 492
+    , NetworkSocketChannel_SendString = 493
+    , NetworkSocketChannel_SendStringReply = 494
+    , NetworkSocketChannel_SendData = 495
+    , NetworkSocketChannel_SendDataReply = 496
+    , NetworkSocketChannel_Close = 497
+    , NetworkSocketStream_SendData = 498
+    , NetworkSocketStream_SendHandshake = 499
+    , NetworkSocketStream_Close = 500
+    , ServiceWorkerFetchTask_DidNotHandle = 501
+    , ServiceWorkerFetchTask_DidFail = 502
+    , ServiceWorkerFetchTask_DidReceiveRedirectResponse = 503
+    , ServiceWorkerFetchTask_DidReceiveResponse = 504
+    , ServiceWorkerFetchTask_DidReceiveData = 505
+    , ServiceWorkerFetchTask_DidReceiveSharedBuffer = 506
+    , ServiceWorkerFetchTask_DidReceiveFormData = 507
+    , ServiceWorkerFetchTask_DidFinish = 508
+    , WebSWServerConnection_ScheduleJobInServer = 509
+    , WebSWServerConnection_ScheduleUnregisterJobInServer = 510
+    , WebSWServerConnection_ScheduleUnregisterJobInServerReply = 511
+    , WebSWServerConnection_FinishFetchingScriptInServer = 512
+    , WebSWServerConnection_AddServiceWorkerRegistrationInServer = 513
+    , WebSWServerConnection_RemoveServiceWorkerRegistrationInServer = 514
+    , WebSWServerConnection_PostMessageToServiceWorker = 515
+    , WebSWServerConnection_DidResolveRegistrationPromise = 516
+    , WebSWServerConnection_MatchRegistration = 517
+    , WebSWServerConnection_WhenRegistrationReady = 518
+    , WebSWServerConnection_GetRegistrations = 519
+    , WebSWServerConnection_RegisterServiceWorkerClient = 520
+    , WebSWServerConnection_UnregisterServiceWorkerClient = 521
+    , WebSWServerConnection_TerminateWorkerFromClient = 522
+    , WebSWServerConnection_TerminateWorkerFromClientReply = 523
+    , WebSWServerConnection_WhenServiceWorkerIsTerminatedForTesting = 524
+    , WebSWServerConnection_WhenServiceWorkerIsTerminatedForTestingReply = 525
+    , WebSWServerConnection_SetThrottleState = 526
+    , WebSWServerConnection_StoreRegistrationsOnDisk = 527
+    , WebSWServerConnection_StoreRegistrationsOnDiskReply = 528
+    , WebSWServerToContextConnection_ScriptContextFailedToStart = 529
+    , WebSWServerToContextConnection_ScriptContextStarted = 530
+    , WebSWServerToContextConnection_DidFinishInstall = 531
+    , WebSWServerToContextConnection_DidFinishActivation = 532
+    , WebSWServerToContextConnection_SetServiceWorkerHasPendingEvents = 533
+    , WebSWServerToContextConnection_SkipWaiting = 534
+    , WebSWServerToContextConnection_SkipWaitingReply = 535
+    , WebSWServerToContextConnection_WorkerTerminated = 536
+    , WebSWServerToContextConnection_FindClientByIdentifier = 537
+    , WebSWServerToContextConnection_MatchAll = 538
+    , WebSWServerToContextConnection_Claim = 539
+    , WebSWServerToContextConnection_ClaimReply = 540
+    , WebSWServerToContextConnection_SetScriptResource = 541
+    , WebSWServerToContextConnection_PostMessageToServiceWorkerClient = 542
+    , WebSWServerToContextConnection_DidFailHeartBeatCheck = 543
+    , StorageManagerSet_ConnectToLocalStorageArea = 544
+    , StorageManagerSet_ConnectToTransientLocalStorageArea = 545
+    , StorageManagerSet_ConnectToSessionStorageArea = 546
+    , StorageManagerSet_DisconnectFromStorageArea = 547
+    , StorageManagerSet_GetValues = 548
+    , StorageManagerSet_CloneSessionStorageNamespace = 549
+    , StorageManagerSet_SetItem = 550
+    , StorageManagerSet_RemoveItem = 551
+    , StorageManagerSet_Clear = 552
+    , CacheStorageEngineConnection_Reference = 553
+    , CacheStorageEngineConnection_Dereference = 554
+    , CacheStorageEngineConnection_Open = 555
+    , CacheStorageEngineConnection_OpenReply = 556
+    , CacheStorageEngineConnection_Remove = 557
+    , CacheStorageEngineConnection_RemoveReply = 558
+    , CacheStorageEngineConnection_Caches = 559
+    , CacheStorageEngineConnection_CachesReply = 560
+    , CacheStorageEngineConnection_RetrieveRecords = 561
+    , CacheStorageEngineConnection_RetrieveRecordsReply = 562
+    , CacheStorageEngineConnection_DeleteMatchingRecords = 563
+    , CacheStorageEngineConnection_DeleteMatchingRecordsReply = 564
+    , CacheStorageEngineConnection_PutRecords = 565
+    , CacheStorageEngineConnection_PutRecordsReply = 566
+    , CacheStorageEngineConnection_ClearMemoryRepresentation = 567
+    , CacheStorageEngineConnection_ClearMemoryRepresentationReply = 568
+    , CacheStorageEngineConnection_EngineRepresentation = 569
+    , CacheStorageEngineConnection_EngineRepresentationReply = 570
+    , NetworkMDNSRegister_UnregisterMDNSNames = 571
+    , NetworkMDNSRegister_RegisterMDNSName = 572
+    , NetworkRTCMonitor_StartUpdatingIfNeeded = 573
+    , NetworkRTCMonitor_StopUpdating = 574
+    , NetworkRTCProvider_CreateUDPSocket = 575
+    , NetworkRTCProvider_CreateServerTCPSocket = 576
+    , NetworkRTCProvider_CreateClientTCPSocket = 577
+    , NetworkRTCProvider_WrapNewTCPConnection = 578
+    , NetworkRTCProvider_CreateResolver = 579
+    , NetworkRTCProvider_StopResolver = 580
+    , NetworkRTCSocket_SendTo = 581
+    , NetworkRTCSocket_Close = 582
+    , NetworkRTCSocket_SetOption = 583
+    , PluginControllerProxy_GeometryDidChange = 584
+    , PluginControllerProxy_VisibilityDidChange = 585
+    , PluginControllerProxy_FrameDidFinishLoading = 586
+    , PluginControllerProxy_FrameDidFail = 587
+    , PluginControllerProxy_DidEvaluateJavaScript = 588
+    , PluginControllerProxy_StreamWillSendRequest = 589
+    , PluginControllerProxy_StreamDidReceiveResponse = 590
+    , PluginControllerProxy_StreamDidReceiveData = 591
+    , PluginControllerProxy_StreamDidFinishLoading = 592
+    , PluginControllerProxy_StreamDidFail = 593
+    , PluginControllerProxy_ManualStreamDidReceiveResponse = 594
+    , PluginControllerProxy_ManualStreamDidReceiveData = 595
+    , PluginControllerProxy_ManualStreamDidFinishLoading = 596
+    , PluginControllerProxy_ManualStreamDidFail = 597
+    , PluginControllerProxy_HandleMouseEvent = 598
+    , PluginControllerProxy_HandleWheelEvent = 599
+    , PluginControllerProxy_HandleMouseEnterEvent = 600
+    , PluginControllerProxy_HandleMouseLeaveEvent = 601
+    , PluginControllerProxy_HandleKeyboardEvent = 602
+    , PluginControllerProxy_HandleEditingCommand = 603
+    , PluginControllerProxy_IsEditingCommandEnabled = 604
+    , PluginControllerProxy_HandlesPageScaleFactor = 605
+    , PluginControllerProxy_RequiresUnifiedScaleFactor = 606
+    , PluginControllerProxy_SetFocus = 607
+    , PluginControllerProxy_DidUpdate = 608
+    , PluginControllerProxy_PaintEntirePlugin = 609
+    , PluginControllerProxy_GetPluginScriptableNPObject = 610
+    , PluginControllerProxy_WindowFocusChanged = 611
+    , PluginControllerProxy_WindowVisibilityChanged = 612
+#if PLATFORM(COCOA)
+    , PluginControllerProxy_SendComplexTextInput = 613
+#endif
+#if PLATFORM(COCOA)
+    , PluginControllerProxy_WindowAndViewFramesChanged = 614
+#endif
+#if PLATFORM(COCOA)
+    , PluginControllerProxy_SetLayerHostingMode = 615
+#endif
+    , PluginControllerProxy_SupportsSnapshotting = 616
+    , PluginControllerProxy_Snapshot = 617
+    , PluginControllerProxy_StorageBlockingStateChanged = 618
+    , PluginControllerProxy_PrivateBrowsingStateChanged = 619
+    , PluginControllerProxy_GetFormValue = 620
+    , PluginControllerProxy_MutedStateChanged = 621
+    , PluginProcess_InitializePluginProcess = 622
+    , PluginProcess_CreateWebProcessConnection = 623
+    , PluginProcess_GetSitesWithData = 624
+    , PluginProcess_DeleteWebsiteData = 625
+    , PluginProcess_DeleteWebsiteDataForHostNames = 626
+#if PLATFORM(COCOA)
+    , PluginProcess_SetQOS = 627
+#endif
+    , WebProcessConnection_CreatePlugin = 628
+    , WebProcessConnection_CreatePluginAsynchronously = 629
+    , WebProcessConnection_DestroyPlugin = 630
+    , AuxiliaryProcess_ShutDown = 631
+    , AuxiliaryProcess_SetProcessSuppressionEnabled = 632
 #if OS(LINUX)
-    , AuxiliaryProcess_DidReceiveMemoryPressureEvent = 632
-#endif
-    , WebConnection_HandleMessage = 633
-    , AuthenticationManager_CompleteAuthenticationChallenge = 634
-    , NPObjectMessageReceiver_Deallocate = 635
-    , NPObjectMessageReceiver_HasMethod = 636
-    , NPObjectMessageReceiver_Invoke = 637
-    , NPObjectMessageReceiver_InvokeDefault = 638
-    , NPObjectMessageReceiver_HasProperty = 639
-    , NPObjectMessageReceiver_GetProperty = 640
-    , NPObjectMessageReceiver_SetProperty = 641
-    , NPObjectMessageReceiver_RemoveProperty = 642
-    , NPObjectMessageReceiver_Enumerate = 643
-    , NPObjectMessageReceiver_Construct = 644
-    , DrawingAreaProxy_EnterAcceleratedCompositingMode = 645
-    , DrawingAreaProxy_UpdateAcceleratedCompositingMode = 646
-    , DrawingAreaProxy_DidFirstLayerFlush = 647
-    , DrawingAreaProxy_DispatchPresentationCallbacksAfterFlushingLayers = 648
-#if PLATFORM(COCOA)
-    , DrawingAreaProxy_DidUpdateGeometry = 649
+    , AuxiliaryProcess_DidReceiveMemoryPressureEvent = 633
+#endif
+    , WebConnection_HandleMessage = 634
+    , AuthenticationManager_CompleteAuthenticationChallenge = 635
+    , NPObjectMessageReceiver_Deallocate = 636
+    , NPObjectMessageReceiver_HasMethod = 637
+    , NPObjectMessageReceiver_Invoke = 638
+    , NPObjectMessageReceiver_InvokeDefault = 639
+    , NPObjectMessageReceiver_HasProperty = 640
+    , NPObjectMessageReceiver_GetProperty = 641
+    , NPObjectMessageReceiver_SetProperty = 642
+    , NPObjectMessageReceiver_RemoveProperty = 643
+    , NPObjectMessageReceiver_Enumerate = 644
+    , NPObjectMessageReceiver_Construct = 645
+    , DrawingAreaProxy_EnterAcceleratedCompositingMode = 646
+    , DrawingAreaProxy_UpdateAcceleratedCompositingMode = 647
+    , DrawingAreaProxy_DidFirstLayerFlush = 648
+    , DrawingAreaProxy_DispatchPresentationCallbacksAfterFlushingLayers = 649
+#if PLATFORM(COCOA)
+    , DrawingAreaProxy_DidUpdateGeometry = 650
 #endif
 #if USE(COORDINATED_GRAPHICS) || USE(TEXTURE_MAPPER)
-    , DrawingAreaProxy_Update = 650
+    , DrawingAreaProxy_Update = 651
 #endif
 #if USE(COORDINATED_GRAPHICS) || USE(TEXTURE_MAPPER)
-    , DrawingAreaProxy_DidUpdateBackingStoreState = 651
+    , DrawingAreaProxy_DidUpdateBackingStoreState = 652
 #endif
 #if USE(COORDINATED_GRAPHICS) || USE(TEXTURE_MAPPER)
-    , DrawingAreaProxy_ExitAcceleratedCompositingMode = 652
-#endif
-    , VisitedLinkStore_AddVisitedLinkHashFromPage = 653
-    , WebCookieManagerProxy_CookiesDidChange = 654
-    , WebFullScreenManagerProxy_SupportsFullScreen = 655
-    , WebFullScreenManagerProxy_EnterFullScreen = 656
-    , WebFullScreenManagerProxy_ExitFullScreen = 657
-    , WebFullScreenManagerProxy_BeganEnterFullScreen = 658
-    , WebFullScreenManagerProxy_BeganExitFullScreen = 659
-    , WebFullScreenManagerProxy_Close = 660
-    , WebGeolocationManagerProxy_StartUpdating = 661
-    , WebGeolocationManagerProxy_StopUpdating = 662
-    , WebGeolocationManagerProxy_SetEnableHighAccuracy = 663
-    , WebPageProxy_CreateNewPage = 664
-    , WebPageProxy_ShowPage = 665
-    , WebPageProxy_ClosePage = 666
-    , WebPageProxy_RunJavaScriptAlert = 667
-    , WebPageProxy_RunJavaScriptConfirm = 668
-    , WebPageProxy_RunJavaScriptPrompt = 669
-    , WebPageProxy_MouseDidMoveOverElement = 670
+    , DrawingAreaProxy_ExitAcceleratedCompositingMode = 653
+#endif
+    , VisitedLinkStore_AddVisitedLinkHashFromPage = 654
+    , WebCookieManagerProxy_CookiesDidChange = 655
+    , WebFullScreenManagerProxy_SupportsFullScreen = 656
+    , WebFullScreenManagerProxy_EnterFullScreen = 657
+    , WebFullScreenManagerProxy_ExitFullScreen = 658
+    , WebFullScreenManagerProxy_BeganEnterFullScreen = 659
+    , WebFullScreenManagerProxy_BeganExitFullScreen = 660
+    , WebFullScreenManagerProxy_Close = 661
+    , WebGeolocationManagerProxy_StartUpdating = 662
+    , WebGeolocationManagerProxy_StopUpdating = 663
+    , WebGeolocationManagerProxy_SetEnableHighAccuracy = 664
+    , WebPageProxy_CreateNewPage = 665
+    , WebPageProxy_ShowPage = 666
+    , WebPageProxy_ClosePage = 667
+    , WebPageProxy_RunJavaScriptAlert = 668
+    , WebPageProxy_RunJavaScriptConfirm = 669
+    , WebPageProxy_RunJavaScriptPrompt = 670
+    , WebPageProxy_MouseDidMoveOverElement = 671
 #if ENABLE(NETSCAPE_PLUGIN_API)
-    , WebPageProxy_UnavailablePluginButtonClicked = 671
+    , WebPageProxy_UnavailablePluginButtonClicked = 672
 #endif
 #if ENABLE(WEBGL)
-    , WebPageProxy_WebGLPolicyForURL = 672
+    , WebPageProxy_WebGLPolicyForURL = 673
 #endif
 #if ENABLE(WEBGL)
-    , WebPageProxy_ResolveWebGLPolicyForURL = 673
-#endif
-    , WebPageProxy_DidChangeViewportProperties = 674
-    , WebPageProxy_DidReceiveEvent = 675
-    , WebPageProxy_SetCursor = 676
-    , WebPageProxy_SetCursorHiddenUntilMouseMoves = 677
-    , WebPageProxy_SetStatusText = 678
-    , WebPageProxy_SetFocus = 679
-    , WebPageProxy_TakeFocus = 680
-    , WebPageProxy_FocusedFrameChanged = 681
-    , WebPageProxy_SetRenderTreeSize = 682
-    , WebPageProxy_SetToolbarsAreVisible = 683
-    , WebPageProxy_GetToolbarsAreVisible = 684
-    , WebPageProxy_SetMenuBarIsVisible = 685
-    , WebPageProxy_GetMenuBarIsVisible = 686
-    , WebPageProxy_SetStatusBarIsVisible = 687
-    , WebPageProxy_GetStatusBarIsVisible = 688
-    , WebPageProxy_SetIsResizable = 689
-    , WebPageProxy_SetWindowFrame = 690
-    , WebPageProxy_GetWindowFrame = 691
-    , WebPageProxy_ScreenToRootView = 692
-    , WebPageProxy_RootViewToScreen = 693
-    , WebPageProxy_AccessibilityScreenToRootView = 694
-    , WebPageProxy_RootViewToAccessibilityScreen = 695
-#if PLATFORM(COCOA)
-    , WebPageProxy_ShowValidationMessage = 696
-#endif
-#if PLATFORM(COCOA)
-    , WebPageProxy_HideValidationMessage = 697
-#endif
-    , WebPageProxy_RunBeforeUnloadConfirmPanel = 698
-    , WebPageProxy_PageDidScroll = 699
-    , WebPageProxy_RunOpenPanel = 700
-    , WebPageProxy_ShowShareSheet = 701
-    , WebPageProxy_ShowShareSheetReply = 702
-    , WebPageProxy_PrintFrame = 703
-    , WebPageProxy_RunModal = 704
-    , WebPageProxy_NotifyScrollerThumbIsVisibleInRect = 705
-    , WebPageProxy_RecommendedScrollbarStyleDidChange = 706
-    , WebPageProxy_DidChangeScrollbarsForMainFrame = 707
-    , WebPageProxy_DidChangeScrollOffsetPinningForMainFrame = 708
-    , WebPageProxy_DidChangePageCount = 709
-    , WebPageProxy_PageExtendedBackgroundColorDidChange = 710
+    , WebPageProxy_ResolveWebGLPolicyForURL = 674
+#endif
+    , WebPageProxy_DidChangeViewportProperties = 675
+    , WebPageProxy_DidReceiveEvent = 676
+    , WebPageProxy_SetCursor = 677
+    , WebPageProxy_SetCursorHiddenUntilMouseMoves = 678
+    , WebPageProxy_SetStatusText = 679
+    , WebPageProxy_SetFocus = 680
+    , WebPageProxy_TakeFocus = 681
+    , WebPageProxy_FocusedFrameChanged = 682
+    , WebPageProxy_SetRenderTreeSize = 683
+    , WebPageProxy_SetToolbarsAreVisible = 684
+    , WebPageProxy_GetToolbarsAreVisible = 685
+    , WebPageProxy_SetMenuBarIsVisible = 686
+    , WebPageProxy_GetMenuBarIsVisible = 687
+    , WebPageProxy_SetStatusBarIsVisible = 688
+    , WebPageProxy_GetStatusBarIsVisible = 689
+    , WebPageProxy_SetIsResizable = 690
+    , WebPageProxy_SetWindowFrame = 691
+    , WebPageProxy_GetWindowFrame = 692
+    , WebPageProxy_ScreenToRootView = 693
+    , WebPageProxy_RootViewToScreen = 694
+    , WebPageProxy_AccessibilityScreenToRootView = 695
+    , WebPageProxy_RootViewToAccessibilityScreen = 696
+#if PLATFORM(COCOA)
+    , WebPageProxy_ShowValidationMessage = 697
+#endif
+#if PLATFORM(COCOA)
+    , WebPageProxy_HideValidationMessage = 698
+#endif
+    , WebPageProxy_RunBeforeUnloadConfirmPanel = 699
+    , WebPageProxy_PageDidScroll = 700
+    , WebPageProxy_RunOpenPanel = 701
+    , WebPageProxy_ShowShareSheet = 702
+    , WebPageProxy_ShowShareSheetReply = 703
+    , WebPageProxy_PrintFrame = 704
+    , WebPageProxy_RunModal = 705
+    , WebPageProxy_NotifyScrollerThumbIsVisibleInRect = 706
+    , WebPageProxy_RecommendedScrollbarStyleDidChange = 707
+    , WebPageProxy_DidChangeScrollbarsForMainFrame = 708
+    , WebPageProxy_DidChangeScrollOffsetPinningForMainFrame = 709
+    , WebPageProxy_DidChangePageCount = 710
+    , WebPageProxy_PageExtendedBackgroundColorDidChange = 711
 #if ENABLE(NETSCAPE_PLUGIN_API)
-    , WebPageProxy_DidFailToInitializePlugin = 711
+    , WebPageProxy_DidFailToInitializePlugin = 712
 #endif
 #if ENABLE(NETSCAPE_PLUGIN_API)
-    , WebPageProxy_DidBlockInsecurePluginVersion = 712
+    , WebPageProxy_DidBlockInsecurePluginVersion = 713
 #endif
-    , WebPageProxy_SetCanShortCircuitHorizontalWheelEvents = 713
-    , WebPageProxy_DidChangeContentSize = 714
-    , WebPageProxy_DidChangeIntrinsicContentSize = 715
+    , WebPageProxy_SetCanShortCircuitHorizontalWheelEvents = 714
+    , WebPageProxy_DidChangeContentSize = 715
+    , WebPageProxy_DidChangeIntrinsicContentSize = 716
 #if ENABLE(INPUT_TYPE_COLOR)
-    , WebPageProxy_ShowColorPicker = 716
+    , WebPageProxy_ShowColorPicker = 717
 #endif
 #if ENABLE(INPUT_TYPE_COLOR)
-    , WebPageProxy_SetColorPickerColor = 717
+    , WebPageProxy_SetColorPickerColor = 718
 #endif
 #if ENABLE(INPUT_TYPE_COLOR)
-    , WebPageProxy_EndColorPicker = 718
+    , WebPageProxy_EndColorPicker = 719
 #endif
 #if ENABLE(DATALIST_ELEMENT)
-    , WebPageProxy_ShowDataListSuggestions = 719
+    , WebPageProxy_ShowDataListSuggestions = 720
 #endif
 #if ENABLE(DATALIST_ELEMENT)
-    , WebPageProxy_HandleKeydownInDataList = 720
+    , WebPageProxy_HandleKeydownInDataList = 721
 #endif
 #if ENABLE(DATALIST_ELEMENT)
-    , WebPageProxy_EndDataListSuggestions = 721
-#endif
-    , WebPageProxy_DecidePolicyForResponse = 722
-    , WebPageProxy_DecidePolicyForNavigationActionAsync = 723
-    , WebPageProxy_DecidePolicyForNavigationActionSync = 724
-    , WebPageProxy_DecidePolicyForNewWindowAction = 725
-    , WebPageProxy_UnableToImplementPolicy = 726
-    , WebPageProxy_DidChangeProgress = 727
-    , WebPageProxy_DidFinishProgress = 728
-    , WebPageProxy_DidStartProgress = 729
-    , WebPageProxy_SetNetworkRequestsInProgress = 730
-    , WebPageProxy_DidCreateMainFrame = 731
-    , WebPageProxy_DidCreateSubframe = 732
-    , WebPageProxy_DidCreateWindow = 733
-    , WebPageProxy_DidStartProvisionalLoadForFrame = 734
-    , WebPageProxy_DidReceiveServerRedirectForProvisionalLoadForFrame = 735
-    , WebPageProxy_WillPerformClientRedirectForFrame = 736
-    , WebPageProxy_DidCancelClientRedirectForFrame = 737
-    , WebPageProxy_DidChangeProvisionalURLForFrame = 738
-    , WebPageProxy_DidFailProvisionalLoadForFrame = 739
-    , WebPageProxy_DidCommitLoadForFrame = 740
-    , WebPageProxy_DidFailLoadForFrame = 741
-    , WebPageProxy_DidFinishDocumentLoadForFrame = 742
-    , WebPageProxy_DidFinishLoadForFrame = 743
-    , WebPageProxy_DidFirstLayoutForFrame = 744
-    , WebPageProxy_DidFirstVisuallyNonEmptyLayoutForFrame = 745
-    , WebPageProxy_DidReachLayoutMilestone = 746
-    , WebPageProxy_DidReceiveTitleForFrame = 747
-    , WebPageProxy_DidDisplayInsecureContentForFrame = 748
-    , WebPageProxy_DidRunInsecureContentForFrame = 749
-    , WebPageProxy_DidDetectXSSForFrame = 750
-    , WebPageProxy_DidSameDocumentNavigationForFrame = 751
-    , WebPageProxy_DidChangeMainDocument = 752
-    , WebPageProxy_DidExplicitOpenForFrame = 753
-    , WebPageProxy_DidDestroyNavigation = 754
-    , WebPageProxy_MainFramePluginHandlesPageScaleGestureDidChange = 755
-    , WebPageProxy_DidNavigateWithNavigationData = 756
-    , WebPageProxy_DidPerformClientRedirect = 757
-    , WebPageProxy_DidPerformServerRedirect = 758
-    , WebPageProxy_DidUpdateHistoryTitle = 759
-    , WebPageProxy_DidFinishLoadingDataForCustomContentProvider = 760
-    , WebPageProxy_WillSubmitForm = 761
-    , WebPageProxy_VoidCallback = 762
-    , WebPageProxy_DataCallback = 763
-    , WebPageProxy_ImageCallback = 764
-    , WebPageProxy_StringCallback = 765
-    , WebPageProxy_BoolCallback = 766
-    , WebPageProxy_InvalidateStringCallback = 767
-    , WebPageProxy_ScriptValueCallback = 768
-    , WebPageProxy_ComputedPagesCallback = 769
-    , WebPageProxy_ValidateCommandCallback = 770
-    , WebPageProxy_EditingRangeCallback = 771
-    , WebPageProxy_UnsignedCallback = 772
-    , WebPageProxy_RectForCharacterRangeCallback = 773
+    , WebPageProxy_EndDataListSuggestions = 722
+#endif
+    , WebPageProxy_DecidePolicyForResponse = 723
+    , WebPageProxy_DecidePolicyForNavigationActionAsync = 724
+    , WebPageProxy_DecidePolicyForNavigationActionSync = 725
+    , WebPageProxy_DecidePolicyForNewWindowAction = 726
+    , WebPageProxy_UnableToImplementPolicy = 727
+    , WebPageProxy_DidChangeProgress = 728
+    , WebPageProxy_DidFinishProgress = 729
+    , WebPageProxy_DidStartProgress = 730
+    , WebPageProxy_SetNetworkRequestsInProgress = 731
+    , WebPageProxy_DidCreateMainFrame = 732
+    , WebPageProxy_DidCreateSubframe = 733
+    , WebPageProxy_DidCreateWindow = 734
+    , WebPageProxy_DidStartProvisionalLoadForFrame = 735
+    , WebPageProxy_DidReceiveServerRedirectForProvisionalLoadForFrame = 736
+    , WebPageProxy_WillPerformClientRedirectForFrame = 737
+    , WebPageProxy_DidCancelClientRedirectForFrame = 738
+    , WebPageProxy_DidChangeProvisionalURLForFrame = 739
+    , WebPageProxy_DidFailProvisionalLoadForFrame = 740
+    , WebPageProxy_DidCommitLoadForFrame = 741
+    , WebPageProxy_DidFailLoadForFrame = 742
+    , WebPageProxy_DidFinishDocumentLoadForFrame = 743
+    , WebPageProxy_DidFinishLoadForFrame = 744
+    , WebPageProxy_DidFirstLayoutForFrame = 745
+    , WebPageProxy_DidFirstVisuallyNonEmptyLayoutForFrame = 746
+    , WebPageProxy_DidReachLayoutMilestone = 747
+    , WebPageProxy_DidReceiveTitleForFrame = 748
+    , WebPageProxy_DidDisplayInsecureContentForFrame = 749
+    , WebPageProxy_DidRunInsecureContentForFrame = 750
+    , WebPageProxy_DidDetectXSSForFrame = 751
+    , WebPageProxy_DidSameDocumentNavigationForFrame = 752
+    , WebPageProxy_DidChangeMainDocument = 753
+    , WebPageProxy_DidExplicitOpenForFrame = 754
+    , WebPageProxy_DidDestroyNavigation = 755
+    , WebPageProxy_MainFramePluginHandlesPageScaleGestureDidChange = 756
+    , WebPageProxy_DidNavigateWithNavigationData = 757
+    , WebPageProxy_DidPerformClientRedirect = 758
+    , WebPageProxy_DidPerformServerRedirect = 759
+    , WebPageProxy_DidUpdateHistoryTitle = 760
+    , WebPageProxy_DidFinishLoadingDataForCustomContentProvider = 761
+    , WebPageProxy_WillSubmitForm = 762
+    , WebPageProxy_VoidCallback = 763
+    , WebPageProxy_DataCallback = 764
+    , WebPageProxy_ImageCallback = 765
+    , WebPageProxy_StringCallback = 766
+    , WebPageProxy_BoolCallback = 767
+    , WebPageProxy_InvalidateStringCallback = 768
+    , WebPageProxy_ScriptValueCallback = 769
+    , WebPageProxy_ComputedPagesCallback = 770
+    , WebPageProxy_ValidateCommandCallback = 771
+    , WebPageProxy_EditingRangeCallback = 772
+    , WebPageProxy_UnsignedCallback = 773
+    , WebPageProxy_RectForCharacterRangeCallback = 774
 #if ENABLE(APPLICATION_MANIFEST)
-    , WebPageProxy_ApplicationManifestCallback = 774
+    , WebPageProxy_ApplicationManifestCallback = 775
 #endif
 #if PLATFORM(MAC)
-    , WebPageProxy_AttributedStringForCharacterRangeCallback = 775
+    , WebPageProxy_AttributedStringForCharacterRangeCallback = 776
 #endif
 #if PLATFORM(MAC)
-    , WebPageProxy_FontAtSelectionCallback = 776
+    , WebPageProxy_FontAtSelectionCallback = 777
 #endif
-    , WebPageProxy_FontAttributesCallback = 777
+    , WebPageProxy_FontAttributesCallback = 778
 #if PLATFORM(IOS_FAMILY)
-    , WebPageProxy_GestureCallback = 778
+    , WebPageProxy_GestureCallback = 779
 #endif
 #if PLATFORM(IOS_FAMILY)
-    , WebPageProxy_TouchesCallback = 779
+    , WebPageProxy_TouchesCallback = 780
 #endif
 #if PLATFORM(IOS_FAMILY)
-    , WebPageProxy_SelectionContextCallback = 780
+    , WebPageProxy_SelectionContextCallback = 781
 #endif
 #if PLATFORM(IOS_FAMILY)
-    , WebPageProxy_InterpretKeyEvent = 781
+    , WebPageProxy_InterpretKeyEvent = 782
 #endif
 #if PLATFORM(IOS_FAMILY)
-    , WebPageProxy_DidReceivePositionInformation = 782
+    , WebPageProxy_DidReceivePositionInformation = 783
 #endif
 #if PLATFORM(IOS_FAMILY)
-    , WebPageProxy_SaveImageToLibrary = 783
+    , WebPageProxy_SaveImageToLibrary = 784
 #endif
 #if PLATFORM(IOS_FAMILY)
-    , WebPageProxy_ShowPlaybackTargetPicker = 784
+    , WebPageProxy_ShowPlaybackTargetPicker = 785
 #endif
 #if PLATFORM(IOS_FAMILY)
-    , WebPageProxy_CommitPotentialTapFailed = 785
+    , WebPageProxy_CommitPotentialTapFailed = 786
 #endif
 #if PLATFORM(IOS_FAMILY)
-    , WebPageProxy_DidNotHandleTapAsClick = 786
+    , WebPageProxy_DidNotHandleTapAsClick = 787
 #endif
 #if PLATFORM(IOS_FAMILY)
-    , WebPageProxy_DidCompleteSyntheticClick = 787
+    , WebPageProxy_DidCompleteSyntheticClick = 788
 #endif
 #if PLATFORM(IOS_FAMILY)
-    , WebPageProxy_DisableDoubleTapGesturesDuringTapIfNecessary = 788
+    , WebPageProxy_DisableDoubleTapGesturesDuringTapIfNecessary = 789
 #endif
 #if PLATFORM(IOS_FAMILY)
-    , WebPageProxy_HandleSmartMagnificationInformationForPotentialTap = 789
+    , WebPageProxy_HandleSmartMagnificationInformationForPotentialTap = 790
 #endif
 #if PLATFORM(IOS_FAMILY)
-    , WebPageProxy_SelectionRectsCallback = 790
+    , WebPageProxy_SelectionRectsCallback = 791
 #endif
 #if ENABLE(DATA_DETECTION)
-    , WebPageProxy_SetDataDetectionResult = 791
+    , WebPageProxy_SetDataDetectionResult = 792
 #endif
 #if PLATFORM(GTK) || PLATFORM(HBD)
-    , WebPageProxy_PrintFinishedCallback = 792
+    , WebPageProxy_PrintFinishedCallback = 793
 #endif
 #if PLATFORM(COCOA)
-    , WebPageProxy_DrawToPDFCallback = 793
+    , WebPageProxy_DrawToPDFCallback = 794
 #endif
 #if PLATFORM(COCOA)
-    , WebPageProxy_NowPlayingInfoCallback = 794
+    , WebPageProxy_NowPlayingInfoCallback = 795
 #endif
-    , WebPageProxy_FindStringCallback = 795
-    , WebPageProxy_PageScaleFactorDidChange = 796
-    , WebPageProxy_PluginScaleFactorDidChange = 797
-    , WebPageProxy_PluginZoomFactorDidChange = 798
+    , WebPageProxy_FindStringCallback = 796
+    , WebPageProxy_PageScaleFactorDidChange = 797
+    , WebPageProxy_PluginScaleFactorDidChange = 798
+    , WebPageProxy_PluginZoomFactorDidChange = 799
 #if USE(ATK)
-    , WebPageProxy_BindAccessibilityTree = 799
+    , WebPageProxy_BindAccessibilityTree = 800
 #endif
 #if PLATFORM(GTK) || PLATFORM(WPE) || PLATFORM(HBD)
-    , WebPageProxy_SetInputMethodState = 800
-#endif
-    , WebPageProxy_BackForwardAddItem = 801
-    , WebPageProxy_BackForwardGoToItem = 802
-    , WebPageProxy_BackForwardItemAtIndex = 803
-    , WebPageProxy_BackForwardListCounts = 804
-    , WebPageProxy_BackForwardClear = 805
-    , WebPageProxy_WillGoToBackForwardListItem = 806
-    , WebPageProxy_RegisterEditCommandForUndo = 807
-    , WebPageProxy_ClearAllEditCommands = 808
-    , WebPageProxy_RegisterInsertionUndoGrouping = 809
-    , WebPageProxy_CanUndoRedo = 810
-    , WebPageProxy_ExecuteUndoRedo = 811
-    , WebPageProxy_LogDiagnosticMessage = 812
-    , WebPageProxy_LogDiagnosticMessageWithResult = 813
-    , WebPageProxy_LogDiagnosticMessageWithValue = 814
-    , WebPageProxy_LogDiagnosticMessageWithEnhancedPrivacy = 815
-    , WebPageProxy_LogDiagnosticMessageWithValueDictionary = 816
-    , WebPageProxy_LogScrollingEvent = 817
-    , WebPageProxy_EditorStateChanged = 818
-    , WebPageProxy_CompositionWasCanceled = 819
-    , WebPageProxy_SetHasHadSelectionChangesFromUserInteraction = 820
+    , WebPageProxy_SetInputMethodState = 801
+#endif
+    , WebPageProxy_BackForwardAddItem = 802
+    , WebPageProxy_BackForwardGoToItem = 803
+    , WebPageProxy_BackForwardItemAtIndex = 804
+    , WebPageProxy_BackForwardListCounts = 805
+    , WebPageProxy_BackForwardClear = 806
+    , WebPageProxy_WillGoToBackForwardListItem = 807
+    , WebPageProxy_RegisterEditCommandForUndo = 808
+    , WebPageProxy_ClearAllEditCommands = 809
+    , WebPageProxy_RegisterInsertionUndoGrouping = 810
+    , WebPageProxy_CanUndoRedo = 811
+    , WebPageProxy_ExecuteUndoRedo = 812
+    , WebPageProxy_LogDiagnosticMessage = 813
+    , WebPageProxy_LogDiagnosticMessageWithResult = 814
+    , WebPageProxy_LogDiagnosticMessageWithValue = 815
+    , WebPageProxy_LogDiagnosticMessageWithEnhancedPrivacy = 816
+    , WebPageProxy_LogDiagnosticMessageWithValueDictionary = 817
+    , WebPageProxy_LogScrollingEvent = 818
+    , WebPageProxy_EditorStateChanged = 819
+    , WebPageProxy_CompositionWasCanceled = 820
+    , WebPageProxy_SetHasHadSelectionChangesFromUserInteraction = 821
 #if HAVE(TOUCH_BAR)
-    , WebPageProxy_SetIsTouchBarUpdateSupressedForHiddenContentEditable = 821
+    , WebPageProxy_SetIsTouchBarUpdateSupressedForHiddenContentEditable = 822
 #endif
 #if HAVE(TOUCH_BAR)
-    , WebPageProxy_SetIsNeverRichlyEditableForTouchBar = 822
-#endif
-    , WebPageProxy_RequestDOMPasteAccess = 823
-    , WebPageProxy_DidCountStringMatches = 824
-    , WebPageProxy_SetTextIndicator = 825
-    , WebPageProxy_ClearTextIndicator = 826
-    , WebPageProxy_DidFindString = 827
-    , WebPageProxy_DidFailToFindString = 828
-    , WebPageProxy_DidFindStringMatches = 829
-    , WebPageProxy_DidGetImageForFindMatch = 830
-    , WebPageProxy_ShowPopupMenu = 831
-    , WebPageProxy_HidePopupMenu = 832
+    , WebPageProxy_SetIsNeverRichlyEditableForTouchBar = 823
+#endif
+    , WebPageProxy_RequestDOMPasteAccess = 824
+    , WebPageProxy_DidCountStringMatches = 825
+    , WebPageProxy_SetTextIndicator = 826
+    , WebPageProxy_ClearTextIndicator = 827
+    , WebPageProxy_DidFindString = 828
+    , WebPageProxy_DidFailToFindString = 829
+    , WebPageProxy_DidFindStringMatches = 830
+    , WebPageProxy_DidGetImageForFindMatch = 831
+    , WebPageProxy_ShowPopupMenu = 832
+    , WebPageProxy_HidePopupMenu = 833
 #if ENABLE(CONTEXT_MENUS)
-    , WebPageProxy_ShowContextMenu = 833
+    , WebPageProxy_ShowContextMenu = 834
 #endif
-    , WebPageProxy_ExceededDatabaseQuota = 834
-    , WebPageProxy_ReachedApplicationCacheOriginQuota = 835
-    , WebPageProxy_RequestGeolocationPermissionForFrame = 836
-    , WebPageProxy_RevokeGeolocationAuthorizationToken = 837
+    , WebPageProxy_ExceededDatabaseQuota = 835
+    , WebPageProxy_ReachedApplicationCacheOriginQuota = 836
+    , WebPageProxy_RequestGeolocationPermissionForFrame = 837
+    , WebPageProxy_RevokeGeolocationAuthorizationToken = 838
 #if ENABLE(MEDIA_STREAM)
-    , WebPageProxy_RequestUserMediaPermissionForFrame = 838
+    , WebPageProxy_RequestUserMediaPermissionForFrame = 839
 #endif
 #if ENABLE(MEDIA_STREAM)
-    , WebPageProxy_EnumerateMediaDevicesForFrame = 839
-    , WebPageProxy_EnumerateMediaDevicesForFrameReply = 840
+    , WebPageProxy_EnumerateMediaDevicesForFrame = 840
+    , WebPageProxy_EnumerateMediaDevicesForFrameReply = 841
 #endif
 #if ENABLE(MEDIA_STREAM)
-    , WebPageProxy_BeginMonitoringCaptureDevices = 841
+    , WebPageProxy_BeginMonitoringCaptureDevices = 842
 #endif
-    , WebPageProxy_RequestNotificationPermission = 842
-    , WebPageProxy_ShowNotification = 843
-    , WebPageProxy_CancelNotification = 844
-    , WebPageProxy_ClearNotifications = 845
-    , WebPageProxy_DidDestroyNotification = 846
+    , WebPageProxy_RequestNotificationPermission = 843
+    , WebPageProxy_ShowNotification = 844
+    , WebPageProxy_CancelNotification = 845
+    , WebPageProxy_ClearNotifications = 846
+    , WebPageProxy_DidDestroyNotification = 847
 #if USE(UNIFIED_TEXT_CHECKING)
-    , WebPageProxy_CheckTextOfParagraph = 847
-#endif
-    , WebPageProxy_CheckSpellingOfString = 848
-    , WebPageProxy_CheckGrammarOfString = 849
-    , WebPageProxy_SpellingUIIsShowing = 850
-    , WebPageProxy_UpdateSpellingUIWithMisspelledWord = 851
-    , WebPageProxy_UpdateSpellingUIWithGrammarString = 852
-    , WebPageProxy_GetGuessesForWord = 853
-    , WebPageProxy_LearnWord = 854
-    , WebPageProxy_IgnoreWord = 855
-    , WebPageProxy_RequestCheckingOfString = 856
+    , WebPageProxy_CheckTextOfParagraph = 848
+#endif
+    , WebPageProxy_CheckSpellingOfString = 849
+    , WebPageProxy_CheckGrammarOfString = 850
+    , WebPageProxy_SpellingUIIsShowing = 851
+    , WebPageProxy_UpdateSpellingUIWithMisspelledWord = 852
+    , WebPageProxy_UpdateSpellingUIWithGrammarString = 853
+    , WebPageProxy_GetGuessesForWord = 854
+    , WebPageProxy_LearnWord = 855
+    , WebPageProxy_IgnoreWord = 856
+    , WebPageProxy_RequestCheckingOfString = 857
 #if ENABLE(DRAG_SUPPORT)
-    , WebPageProxy_DidPerformDragControllerAction = 857
+    , WebPageProxy_DidPerformDragControllerAction = 858
 #endif
 #if ENABLE(DRAG_SUPPORT)
-    , WebPageProxy_DidEndDragging = 858
+    , WebPageProxy_DidEndDragging = 859
 #endif
 #if PLATFORM(COCOA) && ENABLE(DRAG_SUPPORT)
-    , WebPageProxy_StartDrag = 859
+    , WebPageProxy_StartDrag = 860
 #endif
 #if PLATFORM(COCOA) && ENABLE(DRAG_SUPPORT)
-    , WebPageProxy_SetPromisedDataForImage = 860
+    , WebPageProxy_SetPromisedDataForImage = 861
 #endif
 #if (PLATFORM(GTK) || PLATFORM(HBD)) && ENABLE(DRAG_SUPPORT)
-    , WebPageProxy_StartDrag = 861
+    , WebPageProxy_StartDrag = 862
 #endif
 #if ENABLE(DRAG_SUPPORT)
-    , WebPageProxy_DidPerformDragOperation = 862
+    , WebPageProxy_DidPerformDragOperation = 863
 #endif
 #if ENABLE(DATA_INTERACTION)
-    , WebPageProxy_DidHandleDragStartRequest = 863
+    , WebPageProxy_DidHandleDragStartRequest = 864
 #endif
 #if ENABLE(DATA_INTERACTION)
-    , WebPageProxy_DidHandleAdditionalDragItemsRequest = 864
+    , WebPageProxy_DidHandleAdditionalDragItemsRequest = 865
 #endif
 #if ENABLE(DATA_INTERACTION)
-    , WebPageProxy_WillReceiveEditDragSnapshot = 865
+    , WebPageProxy_WillReceiveEditDragSnapshot = 866
 #endif
 #if ENABLE(DATA_INTERACTION)
-    , WebPageProxy_DidReceiveEditDragSnapshot = 866
+    , WebPageProxy_DidReceiveEditDragSnapshot = 867
 #endif
 #if PLATFORM(COCOA)
-    , WebPageProxy_DidPerformDictionaryLookup = 867
+    , WebPageProxy_DidPerformDictionaryLookup = 868
 #endif
 #if PLATFORM(COCOA)
-    , WebPageProxy_ExecuteSavedCommandBySelector = 868
+    , WebPageProxy_ExecuteSavedCommandBySelector = 869
 #endif
 #if PLATFORM(COCOA)
-    , WebPageProxy_RegisterWebProcessAccessibilityToken = 869
+    , WebPageProxy_RegisterWebProcessAccessibilityToken = 870
 #endif
 #if PLATFORM(COCOA)
-    , WebPageProxy_PluginFocusOrWindowFocusChanged = 870
+    , WebPageProxy_PluginFocusOrWindowFocusChanged = 871
 #endif
 #if PLATFORM(COCOA)
-    , WebPageProxy_SetPluginComplexTextInputState = 871
+    , WebPageProxy_SetPluginComplexTextInputState = 872
 #endif
 #if PLATFORM(COCOA)
-    , WebPageProxy_GetIsSpeaking = 872
+    , WebPageProxy_GetIsSpeaking = 873
 #endif
 #if PLATFORM(COCOA)
-    , WebPageProxy_Speak = 873
+    , WebPageProxy_Speak = 874
 #endif
 #if PLATFORM(COCOA)
-    , WebPageProxy_StopSpeaking = 874
+    , WebPageProxy_StopSpeaking = 875
 #endif
 #if PLATFORM(COCOA)
-    , WebPageProxy_MakeFirstResponder = 875
+    , WebPageProxy_MakeFirstResponder = 876
 #endif
 #if PLATFORM(COCOA)
-    , WebPageProxy_AssistiveTechnologyMakeFirstResponder = 876
+    , WebPageProxy_AssistiveTechnologyMakeFirstResponder = 877
 #endif
 #if PLATFORM(COCOA)
-    , WebPageProxy_SearchWithSpotlight = 877
+    , WebPageProxy_SearchWithSpotlight = 878
 #endif
 #if PLATFORM(COCOA)
-    , WebPageProxy_SearchTheWeb = 878
+    , WebPageProxy_SearchTheWeb = 879
 #endif
 #if HAVE(TOUCH_BAR)
-    , WebPageProxy_TouchBarMenuDataChanged = 879
+    , WebPageProxy_TouchBarMenuDataChanged = 880
 #endif
 #if HAVE(TOUCH_BAR)
-    , WebPageProxy_TouchBarMenuItemDataAdded = 880
+    , WebPageProxy_TouchBarMenuItemDataAdded = 881
 #endif
 #if HAVE(TOUCH_BAR)
-    , WebPageProxy_TouchBarMenuItemDataRemoved = 881
+    , WebPageProxy_TouchBarMenuItemDataRemoved = 882
 #endif
 #if USE(APPKIT)
-    , WebPageProxy_SubstitutionsPanelIsShowing = 882
+    , WebPageProxy_SubstitutionsPanelIsShowing = 883
 #endif
 #if USE(AUTOMATIC_TEXT_REPLACEMENT)
-    , WebPageProxy_toggleSmartInsertDelete = 883
+    , WebPageProxy_toggleSmartInsertDelete = 884
 #endif
 #if USE(AUTOMATIC_TEXT_REPLACEMENT)
-    , WebPageProxy_toggleAutomaticQuoteSubstitution = 884
+    , WebPageProxy_toggleAutomaticQuoteSubstitution = 885
 #endif
 #if USE(AUTOMATIC_TEXT_REPLACEMENT)
-    , WebPageProxy_toggleAutomaticLinkDetection = 885
+    , WebPageProxy_toggleAutomaticLinkDetection = 886
 #endif
 #if USE(AUTOMATIC_TEXT_REPLACEMENT)
-    , WebPageProxy_toggleAutomaticDashSubstitution = 886
+    , WebPageProxy_toggleAutomaticDashSubstitution = 887
 #endif
 #if USE(AUTOMATIC_TEXT_REPLACEMENT)
-    , WebPageProxy_toggleAutomaticTextReplacement = 887
+    , WebPageProxy_toggleAutomaticTextReplacement = 888
 #endif
 #if PLATFORM(MAC)
-    , WebPageProxy_ShowCorrectionPanel = 888
+    , WebPageProxy_ShowCorrectionPanel = 889
 #endif
 #if PLATFORM(MAC)
-    , WebPageProxy_DismissCorrectionPanel = 889
+    , WebPageProxy_DismissCorrectionPanel = 890
 #endif
 #if PLATFORM(MAC)
-    , WebPageProxy_DismissCorrectionPanelSoon = 890
+    , WebPageProxy_DismissCorrectionPanelSoon = 891
 #endif
 #if PLATFORM(MAC)
-    , WebPageProxy_RecordAutocorrectionResponse = 891
+    , WebPageProxy_RecordAutocorrectionResponse = 892
 #endif
 #if PLATFORM(MAC)
-    , WebPageProxy_SetEditableElementIsFocused = 892
+    , WebPageProxy_SetEditableElementIsFocused = 893
 #endif
 #if USE(DICTATION_ALTERNATIVES)
-    , WebPageProxy_ShowDictationAlternativeUI = 893
+    , WebPageProxy_ShowDictationAlternativeUI = 894
 #endif
 #if USE(DICTATION_ALTERNATIVES)
-    , WebPageProxy_RemoveDictationAlternatives = 894
+    , WebPageProxy_RemoveDictationAlternatives = 895
 #endif
 #if USE(DICTATION_ALTERNATIVES)
-    , WebPageProxy_DictationAlternatives = 895
+    , WebPageProxy_DictationAlternatives = 896
 #endif
 #if PLATFORM(X11) && ENABLE(NETSCAPE_PLUGIN_API)
-    , WebPageProxy_CreatePluginContainer = 896
+    , WebPageProxy_CreatePluginContainer = 897
 #endif
 #if PLATFORM(X11) && ENABLE(NETSCAPE_PLUGIN_API)
-    , WebPageProxy_WindowedPluginGeometryDidChange = 897
+    , WebPageProxy_WindowedPluginGeometryDidChange = 898
 #endif
 #if PLATFORM(X11) && ENABLE(NETSCAPE_PLUGIN_API)
-    , WebPageProxy_WindowedPluginVisibilityDidChange = 898
+    , WebPageProxy_WindowedPluginVisibilityDidChange = 899
 #endif
 #if PLATFORM(IOS_FAMILY)
-    , WebPageProxy_CouldNotRestorePageState = 899
+    , WebPageProxy_CouldNotRestorePageState = 900
 #endif
 #if PLATFORM(IOS_FAMILY)
-    , WebPageProxy_RestorePageState = 900
+    , WebPageProxy_RestorePageState = 901
 #endif
 #if PLATFORM(IOS_FAMILY)
-    , WebPageProxy_RestorePageCenterAndScale = 901
+    , WebPageProxy_RestorePageCenterAndScale = 902
 #endif
 #if PLATFORM(IOS_FAMILY)
-    , WebPageProxy_DidGetTapHighlightGeometries = 902
+    , WebPageProxy_DidGetTapHighlightGeometries = 903
 #endif
 #if PLATFORM(IOS_FAMILY)
-    , WebPageProxy_ElementDidFocus = 903
+    , WebPageProxy_ElementDidFocus = 904
 #endif
 #if PLATFORM(IOS_FAMILY)
-    , WebPageProxy_ElementDidBlur = 904
+    , WebPageProxy_ElementDidBlur = 905
 #endif
 #if PLATFORM(IOS_FAMILY)
-    , WebPageProxy_UpdateInputContextAfterBlurringAndRefocusingElement = 905
+    , WebPageProxy_UpdateInputContextAfterBlurringAndRefocusingElement = 906
 #endif
 #if PLATFORM(IOS_FAMILY)
-    , WebPageProxy_FocusedElementDidChangeInputMode = 906
+    , WebPageProxy_FocusedElementDidChangeInputMode = 907
 #endif
 #if PLATFORM(IOS_FAMILY)
-    , WebPageProxy_ScrollingNodeScrollWillStartScroll = 907
+    , WebPageProxy_ScrollingNodeScrollWillStartScroll = 908
 #endif
 #if PLATFORM(IOS_FAMILY)
-    , WebPageProxy_ScrollingNodeScrollDidEndScroll = 908
+    , WebPageProxy_ScrollingNodeScrollDidEndScroll = 909
 #endif
 #if PLATFORM(IOS_FAMILY)
-    , WebPageProxy_ShowInspectorHighlight = 909
+    , WebPageProxy_ShowInspectorHighlight = 910
 #endif
 #if PLATFORM(IOS_FAMILY)
-    , WebPageProxy_HideInspectorHighlight = 910
+    , WebPageProxy_HideInspectorHighlight = 911
 #endif
 #if PLATFORM(IOS_FAMILY)
-    , WebPageProxy_FocusedElementInformationCallback = 911
+    , WebPageProxy_FocusedElementInformationCallback = 912
 #endif
 #if PLATFORM(IOS_FAMILY)
-    , WebPageProxy_ShowInspectorIndication = 912
+    , WebPageProxy_ShowInspectorIndication = 913
 #endif
 #if PLATFORM(IOS_FAMILY)
-    , WebPageProxy_HideInspectorIndication = 913
+    , WebPageProxy_HideInspectorIndication = 914
 #endif
 #if PLATFORM(IOS_FAMILY)
-    , WebPageProxy_EnableInspectorNodeSearch = 914
+    , WebPageProxy_EnableInspectorNodeSearch = 915
 #endif
 #if PLATFORM(IOS_FAMILY)
-    , WebPageProxy_DisableInspectorNodeSearch = 915
+    , WebPageProxy_DisableInspectorNodeSearch = 916
 #endif
 #if PLATFORM(IOS_FAMILY)
-    , WebPageProxy_UpdateStringForFind = 916
+    , WebPageProxy_UpdateStringForFind = 917
 #endif
 #if PLATFORM(IOS_FAMILY)
-    , WebPageProxy_HandleAutocorrectionContext = 917
+    , WebPageProxy_HandleAutocorrectionContext = 918
 #endif
 #if PLATFORM(IOS_FAMILY)
-    , WebPageProxy_ShowDataDetectorsUIForPositionInformation = 918
+    , WebPageProxy_ShowDataDetectorsUIForPositionInformation = 919
 #endif
-    , WebPageProxy_DidChangeInspectorFrontendCount = 919
-    , WebPageProxy_CreateInspectorTarget = 920
-    , WebPageProxy_DestroyInspectorTarget = 921
-    , WebPageProxy_SendMessageToInspectorFrontend = 922
-    , WebPageProxy_SaveRecentSearches = 923
-    , WebPageProxy_LoadRecentSearches = 924
-    , WebPageProxy_SavePDFToFileInDownloadsFolder = 925
+    , WebPageProxy_DidChangeInspectorFrontendCount = 920
+    , WebPageProxy_CreateInspectorTarget = 921
+    , WebPageProxy_DestroyInspectorTarget = 922
+    , WebPageProxy_SendMessageToInspectorFrontend = 923
+    , WebPageProxy_SaveRecentSearches = 924
+    , WebPageProxy_LoadRecentSearches = 925
+    , WebPageProxy_SavePDFToFileInDownloadsFolder = 926
 #if PLATFORM(COCOA)
-    , WebPageProxy_SavePDFToTemporaryFolderAndOpenWithNativeApplication = 926
+    , WebPageProxy_SavePDFToTemporaryFolderAndOpenWithNativeApplication = 927
 #endif
 #if PLATFORM(COCOA)
-    , WebPageProxy_OpenPDFFromTemporaryFolderWithNativeApplication = 927
+    , WebPageProxy_OpenPDFFromTemporaryFolderWithNativeApplication = 928
 #endif
 #if ENABLE(PDFKIT_PLUGIN)
-    , WebPageProxy_ShowPDFContextMenu = 928
+    , WebPageProxy_ShowPDFContextMenu = 929
 #endif
 #if ENABLE(NETSCAPE_PLUGIN_API)
-    , WebPageProxy_FindPlugin = 929
+    , WebPageProxy_FindPlugin = 930
 #endif
-    , WebPageProxy_DidUpdateActivityState = 930
+    , WebPageProxy_DidUpdateActivityState = 931
 #if ENABLE(WEB_CRYPTO)
-    , WebPageProxy_WrapCryptoKey = 931
+    , WebPageProxy_WrapCryptoKey = 932
 #endif
 #if ENABLE(WEB_CRYPTO)
-    , WebPageProxy_UnwrapCryptoKey = 932
+    , WebPageProxy_UnwrapCryptoKey = 933
 #endif
 #if (ENABLE(TELEPHONE_NUMBER_DETECTION) && PLATFORM(MAC))
-    , WebPageProxy_ShowTelephoneNumberMenu = 933
+    , WebPageProxy_ShowTelephoneNumberMenu = 934
 #endif
 #if USE(QUICK_LOOK)
-    , WebPageProxy_DidStartLoadForQuickLookDocumentInMainFrame = 934
+    , WebPageProxy_DidStartLoadForQuickLookDocumentInMainFrame = 935
 #endif
 #if USE(QUICK_LOOK)
-    , WebPageProxy_DidFinishLoadForQuickLookDocumentInMainFrame = 935
+    , WebPageProxy_DidFinishLoadForQuickLookDocumentInMainFrame = 936
 #endif
 #if USE(QUICK_LOOK)
-    , WebPageProxy_RequestPasswordForQuickLookDocumentInMainFrame = 936
-    , WebPageProxy_RequestPasswordForQuickLookDocumentInMainFrameReply = 937
+    , WebPageProxy_RequestPasswordForQuickLookDocumentInMainFrame = 937
+    , WebPageProxy_RequestPasswordForQuickLookDocumentInMainFrameReply = 938
 #endif
 #if ENABLE(CONTENT_FILTERING)
-    , WebPageProxy_ContentFilterDidBlockLoadForFrame = 938
+    , WebPageProxy_ContentFilterDidBlockLoadForFrame = 939
 #endif
-    , WebPageProxy_IsPlayingMediaDidChange = 939
-    , WebPageProxy_HandleAutoplayEvent = 940
+    , WebPageProxy_IsPlayingMediaDidChange = 940
+    , WebPageProxy_HandleAutoplayEvent = 941
 #if ENABLE(MEDIA_SESSION)
-    , WebPageProxy_HasMediaSessionWithActiveMediaElementsDidChange = 941
+    , WebPageProxy_HasMediaSessionWithActiveMediaElementsDidChange = 942
 #endif
 #if ENABLE(MEDIA_SESSION)
-    , WebPageProxy_MediaSessionMetadataDidChange = 942
+    , WebPageProxy_MediaSessionMetadataDidChange = 943
 #endif
 #if ENABLE(MEDIA_SESSION)
-    , WebPageProxy_FocusedContentMediaElementDidChange = 943
+    , WebPageProxy_FocusedContentMediaElementDidChange = 944
 #endif
 #if PLATFORM(MAC)
-    , WebPageProxy_DidPerformImmediateActionHitTest = 944
+    , WebPageProxy_DidPerformImmediateActionHitTest = 945
 #endif
-    , WebPageProxy_HandleMessage = 945
-    , WebPageProxy_HandleSynchronousMessage = 946
-    , WebPageProxy_HandleAutoFillButtonClick = 947
-    , WebPageProxy_DidResignInputElementStrongPasswordAppearance = 948
-    , WebPageProxy_ContentRuleListNotification = 949
+    , WebPageProxy_HandleMessage = 946
+    , WebPageProxy_HandleSynchronousMessage = 947
+    , WebPageProxy_HandleAutoFillButtonClick = 948
+    , WebPageProxy_DidResignInputElementStrongPasswordAppearance = 949
+    , WebPageProxy_ContentRuleListNotification = 950
 #if ENABLE(WIRELESS_PLAYBACK_TARGET) && !PLATFORM(IOS_FAMILY)
-    , WebPageProxy_AddPlaybackTargetPickerClient = 950
+    , WebPageProxy_AddPlaybackTargetPickerClient = 951
 #endif
 #if ENABLE(WIRELESS_PLAYBACK_TARGET) && !PLATFORM(IOS_FAMILY)
-    , WebPageProxy_RemovePlaybackTargetPickerClient = 951
+    , WebPageProxy_RemovePlaybackTargetPickerClient = 952
 #endif
 #if ENABLE(WIRELESS_PLAYBACK_TARGET) && !PLATFORM(IOS_FAMILY)
-    , WebPageProxy_ShowPlaybackTargetPicker = 952
+    , WebPageProxy_ShowPlaybackTargetPicker = 953
 #endif
 #if ENABLE(WIRELESS_PLAYBACK_TARGET) && !PLATFORM(IOS_FAMILY)
-    , WebPageProxy_PlaybackTargetPickerClientStateDidChange = 953
+    , WebPageProxy_PlaybackTargetPickerClientStateDidChange = 954
 #endif
 #if ENABLE(WIRELESS_PLAYBACK_TARGET) && !PLATFORM(IOS_FAMILY)
-    , WebPageProxy_SetMockMediaPlaybackTargetPickerEnabled = 954
+    , WebPageProxy_SetMockMediaPlaybackTargetPickerEnabled = 955
 #endif
 #if ENABLE(WIRELESS_PLAYBACK_TARGET) && !PLATFORM(IOS_FAMILY)
-    , WebPageProxy_SetMockMediaPlaybackTargetPickerState = 955
+    , WebPageProxy_SetMockMediaPlaybackTargetPickerState = 956
 #endif
 #if ENABLE(WIRELESS_PLAYBACK_TARGET) && !PLATFORM(IOS_FAMILY)
-    , WebPageProxy_MockMediaPlaybackTargetPickerDismissPopup = 956
+    , WebPageProxy_MockMediaPlaybackTargetPickerDismissPopup = 957
 #endif
 #if ENABLE(VIDEO_PRESENTATION_MODE)
-    , WebPageProxy_SetMockVideoPresentationModeEnabled = 957
+    , WebPageProxy_SetMockVideoPresentationModeEnabled = 958
 #endif
 #if ENABLE(POINTER_LOCK)
-    , WebPageProxy_RequestPointerLock = 958
+    , WebPageProxy_RequestPointerLock = 959
 #endif
 #if ENABLE(POINTER_LOCK)
-    , WebPageProxy_RequestPointerUnlock = 959
+    , WebPageProxy_RequestPointerUnlock = 960
 #endif
-    , WebPageProxy_DidFailToSuspendAfterProcessSwap = 960
-    , WebPageProxy_DidSuspendAfterProcessSwap = 961
-    , WebPageProxy_ImageOrMediaDocumentSizeChanged = 962
-    , WebPageProxy_UseFixedLayoutDidChange = 963
-    , WebPageProxy_FixedLayoutSizeDidChange = 964
+    , WebPageProxy_DidFailToSuspendAfterProcessSwap = 961
+    , WebPageProxy_DidSuspendAfterProcessSwap = 962
+    , WebPageProxy_ImageOrMediaDocumentSizeChanged = 963
+    , WebPageProxy_UseFixedLayoutDidChange = 964
+    , WebPageProxy_FixedLayoutSizeDidChange = 965
 #if ENABLE(VIDEO) && USE(GSTREAMER)
-    , WebPageProxy_RequestInstallMissingMediaPlugins = 965
+    , WebPageProxy_RequestInstallMissingMediaPlugins = 966
 #endif
-    , WebPageProxy_DidRestoreScrollPosition = 966
-    , WebPageProxy_GetLoadDecisionForIcon = 967
-    , WebPageProxy_FinishedLoadingIcon = 968
+    , WebPageProxy_DidRestoreScrollPosition = 967
+    , WebPageProxy_GetLoadDecisionForIcon = 968
+    , WebPageProxy_FinishedLoadingIcon = 969
 #if PLATFORM(MAC)
-    , WebPageProxy_DidHandleAcceptedCandidate = 969
+    , WebPageProxy_DidHandleAcceptedCandidate = 970
 #endif
-    , WebPageProxy_SetIsUsingHighPerformanceWebGL = 970
-    , WebPageProxy_StartURLSchemeTask = 971
-    , WebPageProxy_StopURLSchemeTask = 972
-    , WebPageProxy_LoadSynchronousURLSchemeTask = 973
+    , WebPageProxy_SetIsUsingHighPerformanceWebGL = 971
+    , WebPageProxy_StartURLSchemeTask = 972
+    , WebPageProxy_StopURLSchemeTask = 973
+    , WebPageProxy_LoadSynchronousURLSchemeTask = 974
 #if ENABLE(DEVICE_ORIENTATION)
-    , WebPageProxy_ShouldAllowDeviceOrientationAndMotionAccess = 974
-    , WebPageProxy_ShouldAllowDeviceOrientationAndMotionAccessReply = 975
+    , WebPageProxy_ShouldAllowDeviceOrientationAndMotionAccess = 975
+    , WebPageProxy_ShouldAllowDeviceOrientationAndMotionAccessReply = 976
 #endif
 #if ENABLE(ATTACHMENT_ELEMENT)
-    , WebPageProxy_RegisterAttachmentIdentifierFromData = 976
+    , WebPageProxy_RegisterAttachmentIdentifierFromData = 977
 #endif
 #if ENABLE(ATTACHMENT_ELEMENT)
-    , WebPageProxy_RegisterAttachmentIdentifierFromFilePath = 977
+    , WebPageProxy_RegisterAttachmentIdentifierFromFilePath = 978
 #endif
 #if ENABLE(ATTACHMENT_ELEMENT)
-    , WebPageProxy_RegisterAttachmentIdentifier = 978
+    , WebPageProxy_RegisterAttachmentIdentifier = 979
 #endif
 #if ENABLE(ATTACHMENT_ELEMENT)
-    , WebPageProxy_RegisterAttachmentsFromSerializedData = 979
+    , WebPageProxy_RegisterAttachmentsFromSerializedData = 980
 #endif
 #if ENABLE(ATTACHMENT_ELEMENT)
-    , WebPageProxy_CloneAttachmentData = 980
+    , WebPageProxy_CloneAttachmentData = 981
 #endif
 #if ENABLE(ATTACHMENT_ELEMENT)
-    , WebPageProxy_DidInsertAttachmentWithIdentifier = 981
+    , WebPageProxy_DidInsertAttachmentWithIdentifier = 982
 #endif
 #if ENABLE(ATTACHMENT_ELEMENT)
-    , WebPageProxy_DidRemoveAttachmentWithIdentifier = 982
+    , WebPageProxy_DidRemoveAttachmentWithIdentifier = 983
 #endif
 #if ENABLE(ATTACHMENT_ELEMENT)
-    , WebPageProxy_SerializedAttachmentDataForIdentifiers = 983
+    , WebPageProxy_SerializedAttachmentDataForIdentifiers = 984
 #endif
 #if ENABLE(ATTACHMENT_ELEMENT)
-    , WebPageProxy_WritePromisedAttachmentToPasteboard = 984
+    , WebPageProxy_WritePromisedAttachmentToPasteboard = 985
 #endif
-    , WebPageProxy_SignedPublicKeyAndChallengeString = 985
+    , WebPageProxy_SignedPublicKeyAndChallengeString = 986
 #if ENABLE(SPEECH_SYNTHESIS)
-    , WebPageProxy_SpeechSynthesisVoiceList = 986
+    , WebPageProxy_SpeechSynthesisVoiceList = 987
 #endif
 #if ENABLE(SPEECH_SYNTHESIS)
-    , WebPageProxy_SpeechSynthesisSpeak = 987
-    , WebPageProxy_SpeechSynthesisSpeakReply = 988
+    , WebPageProxy_SpeechSynthesisSpeak = 988
+    , WebPageProxy_SpeechSynthesisSpeakReply = 989
 #endif
 #if ENABLE(SPEECH_SYNTHESIS)
-    , WebPageProxy_SpeechSynthesisSetFinishedCallback = 989
-    , WebPageProxy_SpeechSynthesisSetFinishedCallbackReply = 990
+    , WebPageProxy_SpeechSynthesisSetFinishedCallback = 990
+    , WebPageProxy_SpeechSynthesisSetFinishedCallbackReply = 991
 #endif
 #if ENABLE(SPEECH_SYNTHESIS)
-    , WebPageProxy_SpeechSynthesisCancel = 991
+    , WebPageProxy_SpeechSynthesisCancel = 992
 #endif
 #if ENABLE(SPEECH_SYNTHESIS)
-    , WebPageProxy_SpeechSynthesisPause = 992
-    , WebPageProxy_SpeechSynthesisPauseReply = 993
+    , WebPageProxy_SpeechSynthesisPause = 993
+    , WebPageProxy_SpeechSynthesisPauseReply = 994
 #endif
 #if ENABLE(SPEECH_SYNTHESIS)
-    , WebPageProxy_SpeechSynthesisResume = 994
-    , WebPageProxy_SpeechSynthesisResumeReply = 995
+    , WebPageProxy_SpeechSynthesisResume = 995
+    , WebPageProxy_SpeechSynthesisResumeReply = 996
 #endif
-    , WebPageProxy_ConfigureLoggingChannel = 996
+    , WebPageProxy_ConfigureLoggingChannel = 997
 #if PLATFORM(GTK) || PLATFORM(HBD)
-    , WebPageProxy_ShowEmojiPicker = 997
-    , WebPageProxy_ShowEmojiPickerReply = 998
+    , WebPageProxy_ShowEmojiPicker = 998
+    , WebPageProxy_ShowEmojiPickerReply = 999
 #endif
 #if HAVE(VISIBILITY_PROPAGATION_VIEW)
-    , WebPageProxy_DidCreateContextForVisibilityPropagation = 999
+    , WebPageProxy_DidCreateContextForVisibilityPropagation = 1000
 #endif
 #if ENABLE(WEB_AUTHN)
-    , WebPageProxy_SetMockWebAuthenticationConfiguration = 1000
+    , WebPageProxy_SetMockWebAuthenticationConfiguration = 1001
 #endif
 #if PLATFORM(GTK) || PLATFORM(WPE) || PLATFORM(HBD)
-    , WebPageProxy_SendMessageToWebView = 1001
+    , WebPageProxy_SendMessageToWebView = 1002
 #endif
 #if PLATFORM(GTK) || PLATFORM(WPE) || PLATFORM(HBD)
-    , WebPageProxy_SendMessageToWebViewWithReply = 1002
-    , WebPageProxy_SendMessageToWebViewWithReplyReply = 1003
+    , WebPageProxy_SendMessageToWebViewWithReply = 1003
+    , WebPageProxy_SendMessageToWebViewWithReplyReply = 1004
 #endif
-    , WebPageProxy_DidFindTextManipulationItems = 1004
+    , WebPageProxy_DidFindTextManipulationItems = 1005
 #if ENABLE(MEDIA_USAGE)
-    , WebPageProxy_AddMediaUsageManagerSession = 1005
+    , WebPageProxy_AddMediaUsageManagerSession = 1006
 #endif
 #if ENABLE(MEDIA_USAGE)
-    , WebPageProxy_UpdateMediaUsageManagerSessionState = 1006
+    , WebPageProxy_UpdateMediaUsageManagerSessionState = 1007
 #endif
 #if ENABLE(MEDIA_USAGE)
-    , WebPageProxy_RemoveMediaUsageManagerSession = 1007
+    , WebPageProxy_RemoveMediaUsageManagerSession = 1008
 #endif
-    , WebPageProxy_SetHasExecutedAppBoundBehaviorBeforeNavigation = 1008
+    , WebPageProxy_SetHasExecutedAppBoundBehaviorBeforeNavigation = 1009
 #if PLATFORM(IOS_FAMILY)
-    , WebPasteboardProxy_WriteURLToPasteboard = 1009
+    , WebPasteboardProxy_WriteURLToPasteboard = 1010
 #endif
 #if PLATFORM(IOS_FAMILY)
-    , WebPasteboardProxy_WriteWebContentToPasteboard = 1010
+    , WebPasteboardProxy_WriteWebContentToPasteboard = 1011
 #endif
 #if PLATFORM(IOS_FAMILY)
-    , WebPasteboardProxy_WriteImageToPasteboard = 1011
+    , WebPasteboardProxy_WriteImageToPasteboard = 1012
 #endif
 #if PLATFORM(IOS_FAMILY)
-    , WebPasteboardProxy_WriteStringToPasteboard = 1012
+    , WebPasteboardProxy_WriteStringToPasteboard = 1013
 #endif
 #if PLATFORM(IOS_FAMILY)
-    , WebPasteboardProxy_UpdateSupportedTypeIdentifiers = 1013
+    , WebPasteboardProxy_UpdateSupportedTypeIdentifiers = 1014
 #endif
-    , WebPasteboardProxy_WriteCustomData = 1014
-    , WebPasteboardProxy_TypesSafeForDOMToReadAndWrite = 1015
-    , WebPasteboardProxy_AllPasteboardItemInfo = 1016
-    , WebPasteboardProxy_InformationForItemAtIndex = 1017
-    , WebPasteboardProxy_GetPasteboardItemsCount = 1018
-    , WebPasteboardProxy_ReadStringFromPasteboard = 1019
-    , WebPasteboardProxy_ReadURLFromPasteboard = 1020
-    , WebPasteboardProxy_ReadBufferFromPasteboard = 1021
-    , WebPasteboardProxy_ContainsStringSafeForDOMToReadForType = 1022
+    , WebPasteboardProxy_WriteCustomData = 1015
+    , WebPasteboardProxy_TypesSafeForDOMToReadAndWrite = 1016
+    , WebPasteboardProxy_AllPasteboardItemInfo = 1017
+    , WebPasteboardProxy_InformationForItemAtIndex = 1018
+    , WebPasteboardProxy_GetPasteboardItemsCount = 1019
+    , WebPasteboardProxy_ReadStringFromPasteboard = 1020
+    , WebPasteboardProxy_ReadURLFromPasteboard = 1021
+    , WebPasteboardProxy_ReadBufferFromPasteboard = 1022
+    , WebPasteboardProxy_ContainsStringSafeForDOMToReadForType = 1023
 #if PLATFORM(COCOA)
-    , WebPasteboardProxy_GetNumberOfFiles = 1023
+    , WebPasteboardProxy_GetNumberOfFiles = 1024
 #endif
 #if PLATFORM(COCOA)
-    , WebPasteboardProxy_GetPasteboardTypes = 1024
+    , WebPasteboardProxy_GetPasteboardTypes = 1025
 #endif
 #if PLATFORM(COCOA)
-    , WebPasteboardProxy_GetPasteboardPathnamesForType = 1025
+    , WebPasteboardProxy_GetPasteboardPathnamesForType = 1026
 #endif
 #if PLATFORM(COCOA)
-    , WebPasteboardProxy_GetPasteboardStringForType = 1026
+    , WebPasteboardProxy_GetPasteboardStringForType = 1027
 #endif
 #if PLATFORM(COCOA)
-    , WebPasteboardProxy_GetPasteboardStringsForType = 1027
+    , WebPasteboardProxy_GetPasteboardStringsForType = 1028
 #endif
 #if PLATFORM(COCOA)
-    , WebPasteboardProxy_GetPasteboardBufferForType = 1028
+    , WebPasteboardProxy_GetPasteboardBufferForType = 1029
 #endif
 #if PLATFORM(COCOA)
-    , WebPasteboardProxy_GetPasteboardChangeCount = 1029
+    , WebPasteboardProxy_GetPasteboardChangeCount = 1030
 #endif
 #if PLATFORM(COCOA)
-    , WebPasteboardProxy_GetPasteboardColor = 1030
+    , WebPasteboardProxy_GetPasteboardColor = 1031
 #endif
 #if PLATFORM(COCOA)
-    , WebPasteboardProxy_GetPasteboardURL = 1031
+    , WebPasteboardProxy_GetPasteboardURL = 1032
 #endif
 #if PLATFORM(COCOA)
-    , WebPasteboardProxy_AddPasteboardTypes = 1032
+    , WebPasteboardProxy_AddPasteboardTypes = 1033
 #endif
 #if PLATFORM(COCOA)
-    , WebPasteboardProxy_SetPasteboardTypes = 1033
+    , WebPasteboardProxy_SetPasteboardTypes = 1034
 #endif
 #if PLATFORM(COCOA)
-    , WebPasteboardProxy_SetPasteboardURL = 1034
+    , WebPasteboardProxy_SetPasteboardURL = 1035
 #endif
 #if PLATFORM(COCOA)
-    , WebPasteboardProxy_SetPasteboardColor = 1035
+    , WebPasteboardProxy_SetPasteboardColor = 1036
 #endif
 #if PLATFORM(COCOA)
-    , WebPasteboardProxy_SetPasteboardStringForType = 1036
+    , WebPasteboardProxy_SetPasteboardStringForType = 1037
 #endif
 #if PLATFORM(COCOA)
-    , WebPasteboardProxy_SetPasteboardBufferForType = 1037
+    , WebPasteboardProxy_SetPasteboardBufferForType = 1038
 #endif
 #if PLATFORM(COCOA)
-    , WebPasteboardProxy_ContainsURLStringSuitableForLoading = 1038
+    , WebPasteboardProxy_ContainsURLStringSuitableForLoading = 1039
 #endif
 #if PLATFORM(COCOA)
-    , WebPasteboardProxy_URLStringSuitableForLoading = 1039
+    , WebPasteboardProxy_URLStringSuitableForLoading = 1040
 #endif
 #if PLATFORM(GTK) || PLATFORM(HBD)
-    , WebPasteboardProxy_GetTypes = 1040
+    , WebPasteboardProxy_GetTypes = 1041
 #endif
 #if PLATFORM(GTK) || PLATFORM(HBD)
-    , WebPasteboardProxy_ReadText = 1041
+    , WebPasteboardProxy_ReadText = 1042
 #endif
 #if PLATFORM(GTK) || PLATFORM(HBD)
-    , WebPasteboardProxy_ReadFilePaths = 1042
+    , WebPasteboardProxy_ReadFilePaths = 1043
 #endif
 #if PLATFORM(GTK) || PLATFORM(HBD)
-    , WebPasteboardProxy_ReadBuffer = 1043
+    , WebPasteboardProxy_ReadBuffer = 1044
 #endif
 #if PLATFORM(GTK) || PLATFORM(HBD)
-    , WebPasteboardProxy_WriteToClipboard = 1044
+    , WebPasteboardProxy_WriteToClipboard = 1045
 #endif
 #if PLATFORM(GTK) || PLATFORM(HBD)
-    , WebPasteboardProxy_ClearClipboard = 1045
+    , WebPasteboardProxy_ClearClipboard = 1046
 #endif
 #if USE(LIBWPE)
-    , WebPasteboardProxy_GetPasteboardTypes = 1046
+    , WebPasteboardProxy_GetPasteboardTypes = 1047
 #endif
 #if USE(LIBWPE)
-    , WebPasteboardProxy_WriteWebContentToPasteboard = 1047
+    , WebPasteboardProxy_WriteWebContentToPasteboard = 1048
 #endif
 #if USE(LIBWPE)
-    , WebPasteboardProxy_WriteStringToPasteboard = 1048
+    , WebPasteboardProxy_WriteStringToPasteboard = 1049
 #endif
-    , WebProcessPool_HandleMessage = 1049
-    , WebProcessPool_HandleSynchronousMessage = 1050
+    , WebProcessPool_HandleMessage = 1050
+    , WebProcessPool_HandleSynchronousMessage = 1051
 #if ENABLE(GAMEPAD)
-    , WebProcessPool_StartedUsingGamepads = 1051
+    , WebProcessPool_StartedUsingGamepads = 1052
 #endif
 #if ENABLE(GAMEPAD)
-    , WebProcessPool_StoppedUsingGamepads = 1052
-#endif
-    , WebProcessPool_ReportWebContentCPUTime = 1053
-    , WebProcessProxy_UpdateBackForwardItem = 1054
-    , WebProcessProxy_DidDestroyFrame = 1055
-    , WebProcessProxy_DidDestroyUserGestureToken = 1056
-    , WebProcessProxy_ShouldTerminate = 1057
-    , WebProcessProxy_EnableSuddenTermination = 1058
-    , WebProcessProxy_DisableSuddenTermination = 1059
+    , WebProcessPool_StoppedUsingGamepads = 1053
+#endif
+    , WebProcessPool_ReportWebContentCPUTime = 1054
+    , WebProcessProxy_UpdateBackForwardItem = 1055
+    , WebProcessProxy_DidDestroyFrame = 1056
+    , WebProcessProxy_DidDestroyUserGestureToken = 1057
+    , WebProcessProxy_ShouldTerminate = 1058
+    , WebProcessProxy_EnableSuddenTermination = 1059
+    , WebProcessProxy_DisableSuddenTermination = 1060
 #if ENABLE(NETSCAPE_PLUGIN_API)
-    , WebProcessProxy_GetPlugins = 1060
+    , WebProcessProxy_GetPlugins = 1061
 #endif
 #if ENABLE(NETSCAPE_PLUGIN_API)
-    , WebProcessProxy_GetPluginProcessConnection = 1061
+    , WebProcessProxy_GetPluginProcessConnection = 1062
 #endif
-    , WebProcessProxy_GetNetworkProcessConnection = 1062
+    , WebProcessProxy_GetNetworkProcessConnection = 1063
 #if ENABLE(GPU_PROCESS)
-    , WebProcessProxy_GetGPUProcessConnection = 1063
+    , WebProcessProxy_GetGPUProcessConnection = 1064
 #endif
-    , WebProcessProxy_SetIsHoldingLockedFiles = 1064
-    , WebProcessProxy_DidExceedActiveMemoryLimit = 1065
-    , WebProcessProxy_DidExceedInactiveMemoryLimit = 1066
-    , WebProcessProxy_DidExceedCPULimit = 1067
-    , WebProcessProxy_StopResponsivenessTimer = 1068
-    , WebProcessProxy_DidReceiveMainThreadPing = 1069
-    , WebProcessProxy_DidReceiveBackgroundResponsivenessPing = 1070
-    , WebProcessProxy_MemoryPressureStatusChanged = 1071
-    , WebProcessProxy_DidExceedInactiveMemoryLimitWhileActive = 1072
-    , WebProcessProxy_DidCollectPrewarmInformation = 1073
+    , WebProcessProxy_SetIsHoldingLockedFiles = 1065
+    , WebProcessProxy_DidExceedActiveMemoryLimit = 1066
+    , WebProcessProxy_DidExceedInactiveMemoryLimit = 1067
+    , WebProcessProxy_DidExceedCPULimit = 1068
+    , WebProcessProxy_StopResponsivenessTimer = 1069
+    , WebProcessProxy_DidReceiveMainThreadPing = 1070
+    , WebProcessProxy_DidReceiveBackgroundResponsivenessPing = 1071
+    , WebProcessProxy_MemoryPressureStatusChanged = 1072
+    , WebProcessProxy_DidExceedInactiveMemoryLimitWhileActive = 1073
+    , WebProcessProxy_DidCollectPrewarmInformation = 1074
 #if PLATFORM(COCOA)
-    , WebProcessProxy_CacheMediaMIMETypes = 1074
+    , WebProcessProxy_CacheMediaMIMETypes = 1075
 #endif
 #if PLATFORM(MAC)
-    , WebProcessProxy_RequestHighPerformanceGPU = 1075
+    , WebProcessProxy_RequestHighPerformanceGPU = 1076
 #endif
 #if PLATFORM(MAC)
-    , WebProcessProxy_ReleaseHighPerformanceGPU = 1076
+    , WebProcessProxy_ReleaseHighPerformanceGPU = 1077
 #endif
 #if PLATFORM(MAC) && ENABLE(WEBPROCESS_WINDOWSERVER_BLOCKING)
-    , WebProcessProxy_StartDisplayLink = 1077
+    , WebProcessProxy_StartDisplayLink = 1078
 #endif
 #if PLATFORM(MAC) && ENABLE(WEBPROCESS_WINDOWSERVER_BLOCKING)
-    , WebProcessProxy_StopDisplayLink = 1078
+    , WebProcessProxy_StopDisplayLink = 1079
 #endif
-    , WebProcessProxy_AddPlugInAutoStartOriginHash = 1079
-    , WebProcessProxy_PlugInDidReceiveUserInteraction = 1080
+    , WebProcessProxy_AddPlugInAutoStartOriginHash = 1080
+    , WebProcessProxy_PlugInDidReceiveUserInteraction = 1081
 #if PLATFORM(GTK) || PLATFORM(WPE)
-    , WebProcessProxy_SendMessageToWebContext = 1081
+    , WebProcessProxy_SendMessageToWebContext = 1082
 #endif
 #if PLATFORM(GTK) || PLATFORM(WPE)
-    , WebProcessProxy_SendMessageToWebContextWithReply = 1082
-    , WebProcessProxy_SendMessageToWebContextWithReplyReply = 1083
-#endif
-    , WebProcessProxy_DidCreateSleepDisabler = 1084
-    , WebProcessProxy_DidDestroySleepDisabler = 1085
-    , WebAutomationSession_DidEvaluateJavaScriptFunction = 1086
-    , WebAutomationSession_DidTakeScreenshot = 1087
-    , DownloadProxy_DidStart = 1088
-    , DownloadProxy_DidReceiveAuthenticationChallenge = 1089
-    , DownloadProxy_WillSendRequest = 1090
-    , DownloadProxy_DecideDestinationWithSuggestedFilenameAsync = 1091
-    , DownloadProxy_DidReceiveResponse = 1092
-    , DownloadProxy_DidReceiveData = 1093
-    , DownloadProxy_DidCreateDestination = 1094
-    , DownloadProxy_DidFinish = 1095
-    , DownloadProxy_DidFail = 1096
-    , DownloadProxy_DidCancel = 1097
+    , WebProcessProxy_SendMessageToWebContextWithReply = 1083
+    , WebProcessProxy_SendMessageToWebContextWithReplyReply = 1084
+#endif
+    , WebProcessProxy_DidCreateSleepDisabler = 1085
+    , WebProcessProxy_DidDestroySleepDisabler = 1086
+    , WebAutomationSession_DidEvaluateJavaScriptFunction = 1087
+    , WebAutomationSession_DidTakeScreenshot = 1088
+    , DownloadProxy_DidStart = 1089
+    , DownloadProxy_DidReceiveAuthenticationChallenge = 1090
+    , DownloadProxy_WillSendRequest = 1091
+    , DownloadProxy_DecideDestinationWithSuggestedFilenameAsync = 1092
+    , DownloadProxy_DidReceiveResponse = 1093
+    , DownloadProxy_DidReceiveData = 1094
+    , DownloadProxy_DidCreateDestination = 1095
+    , DownloadProxy_DidFinish = 1096
+    , DownloadProxy_DidFail = 1097
+    , DownloadProxy_DidCancel = 1098
 #if HAVE(VISIBILITY_PROPAGATION_VIEW)
-    , GPUProcessProxy_DidCreateContextForVisibilityPropagation = 1098
-#endif
-    , RemoteWebInspectorProxy_FrontendDidClose = 1099
-    , RemoteWebInspectorProxy_Reopen = 1100
-    , RemoteWebInspectorProxy_ResetState = 1101
-    , RemoteWebInspectorProxy_BringToFront = 1102
-    , RemoteWebInspectorProxy_Save = 1103
-    , RemoteWebInspectorProxy_Append = 1104
-    , RemoteWebInspectorProxy_SetForcedAppearance = 1105
-    , RemoteWebInspectorProxy_SetSheetRect = 1106
-    , RemoteWebInspectorProxy_StartWindowDrag = 1107
-    , RemoteWebInspectorProxy_OpenInNewTab = 1108
-    , RemoteWebInspectorProxy_ShowCertificate = 1109
-    , RemoteWebInspectorProxy_SendMessageToBackend = 1110
-    , WebInspectorProxy_OpenLocalInspectorFrontend = 1111
-    , WebInspectorProxy_SetFrontendConnection = 1112
-    , WebInspectorProxy_SendMessageToBackend = 1113
-    , WebInspectorProxy_FrontendLoaded = 1114
-    , WebInspectorProxy_DidClose = 1115
-    , WebInspectorProxy_BringToFront = 1116
-    , WebInspectorProxy_BringInspectedPageToFront = 1117
-    , WebInspectorProxy_Reopen = 1118
-    , WebInspectorProxy_ResetState = 1119
-    , WebInspectorProxy_SetForcedAppearance = 1120
-    , WebInspectorProxy_InspectedURLChanged = 1121
-    , WebInspectorProxy_ShowCertificate = 1122
-    , WebInspectorProxy_ElementSelectionChanged = 1123
-    , WebInspectorProxy_TimelineRecordingChanged = 1124
-    , WebInspectorProxy_SetDeveloperPreferenceOverride = 1125
-    , WebInspectorProxy_Save = 1126
-    , WebInspectorProxy_Append = 1127
-    , WebInspectorProxy_AttachBottom = 1128
-    , WebInspectorProxy_AttachRight = 1129
-    , WebInspectorProxy_AttachLeft = 1130
-    , WebInspectorProxy_Detach = 1131
-    , WebInspectorProxy_AttachAvailabilityChanged = 1132
-    , WebInspectorProxy_SetAttachedWindowHeight = 1133
-    , WebInspectorProxy_SetAttachedWindowWidth = 1134
-    , WebInspectorProxy_SetSheetRect = 1135
-    , WebInspectorProxy_StartWindowDrag = 1136
-    , NetworkProcessProxy_DidReceiveAuthenticationChallenge = 1137
-    , NetworkProcessProxy_NegotiatedLegacyTLS = 1138
-    , NetworkProcessProxy_DidNegotiateModernTLS = 1139
-    , NetworkProcessProxy_DidFetchWebsiteData = 1140
-    , NetworkProcessProxy_DidDeleteWebsiteData = 1141
-    , NetworkProcessProxy_DidDeleteWebsiteDataForOrigins = 1142
-    , NetworkProcessProxy_DidSyncAllCookies = 1143
-    , NetworkProcessProxy_TestProcessIncomingSyncMessagesWhenWaitingForSyncReply = 1144
-    , NetworkProcessProxy_TerminateUnresponsiveServiceWorkerProcesses = 1145
-    , NetworkProcessProxy_SetIsHoldingLockedFiles = 1146
-    , NetworkProcessProxy_LogDiagnosticMessage = 1147
-    , NetworkProcessProxy_LogDiagnosticMessageWithResult = 1148
-    , NetworkProcessProxy_LogDiagnosticMessageWithValue = 1149
-#if ENABLE(RESOURCE_LOAD_STATISTICS)
-    , NetworkProcessProxy_LogTestingEvent = 1150
-#endif
-#if ENABLE(RESOURCE_LOAD_STATISTICS)
-    , NetworkProcessProxy_NotifyResourceLoadStatisticsProcessed = 1151
-#endif
-#if ENABLE(RESOURCE_LOAD_STATISTICS)
-    , NetworkProcessProxy_NotifyWebsiteDataDeletionForRegistrableDomainsFinished = 1152
-#endif
-#if ENABLE(RESOURCE_LOAD_STATISTICS)
-    , NetworkProcessProxy_NotifyWebsiteDataScanForRegistrableDomainsFinished = 1153
-#endif
-#if ENABLE(RESOURCE_LOAD_STATISTICS)
-    , NetworkProcessProxy_NotifyResourceLoadStatisticsTelemetryFinished = 1154
-#endif
-#if ENABLE(RESOURCE_LOAD_STATISTICS)
-    , NetworkProcessProxy_RequestStorageAccessConfirm = 1155
-    , NetworkProcessProxy_RequestStorageAccessConfirmReply = 1156
-#endif
-#if ENABLE(RESOURCE_LOAD_STATISTICS)
-    , NetworkProcessProxy_DeleteWebsiteDataInUIProcessForRegistrableDomains = 1157
-    , NetworkProcessProxy_DeleteWebsiteDataInUIProcessForRegistrableDomainsReply = 1158
-#endif
-#if ENABLE(RESOURCE_LOAD_STATISTICS)
-    , NetworkProcessProxy_DidCommitCrossSiteLoadWithDataTransferFromPrevalentResource = 1159
-#endif
-#if ENABLE(RESOURCE_LOAD_STATISTICS)
-    , NetworkProcessProxy_SetDomainsWithUserInteraction = 1160
+    , GPUProcessProxy_DidCreateContextForVisibilityPropagation = 1099
+#endif
+    , RemoteWebInspectorProxy_FrontendDidClose = 1100
+    , RemoteWebInspectorProxy_Reopen = 1101
+    , RemoteWebInspectorProxy_ResetState = 1102
+    , RemoteWebInspectorProxy_BringToFront = 1103
+    , RemoteWebInspectorProxy_Save = 1104
+    , RemoteWebInspectorProxy_Append = 1105
+    , RemoteWebInspectorProxy_SetForcedAppearance = 1106
+    , RemoteWebInspectorProxy_SetSheetRect = 1107
+    , RemoteWebInspectorProxy_StartWindowDrag = 1108
+    , RemoteWebInspectorProxy_OpenInNewTab = 1109
+    , RemoteWebInspectorProxy_ShowCertificate = 1110
+    , RemoteWebInspectorProxy_SendMessageToBackend = 1111
+    , WebInspectorProxy_OpenLocalInspectorFrontend = 1112
+    , WebInspectorProxy_SetFrontendConnection = 1113
+    , WebInspectorProxy_SendMessageToBackend = 1114
+    , WebInspectorProxy_FrontendLoaded = 1115
+    , WebInspectorProxy_DidClose = 1116
+    , WebInspectorProxy_BringToFront = 1117
+    , WebInspectorProxy_BringInspectedPageToFront = 1118
+    , WebInspectorProxy_Reopen = 1119
+    , WebInspectorProxy_ResetState = 1120
+    , WebInspectorProxy_SetForcedAppearance = 1121
+    , WebInspectorProxy_InspectedURLChanged = 1122
+    , WebInspectorProxy_ShowCertificate = 1123
+    , WebInspectorProxy_ElementSelectionChanged = 1124
+    , WebInspectorProxy_TimelineRecordingChanged = 1125
+    , WebInspectorProxy_SetDeveloperPreferenceOverride = 1126
+    , WebInspectorProxy_Save = 1127
+    , WebInspectorProxy_Append = 1128
+    , WebInspectorProxy_AttachBottom = 1129
+    , WebInspectorProxy_AttachRight = 1130
+    , WebInspectorProxy_AttachLeft = 1131
+    , WebInspectorProxy_Detach = 1132
+    , WebInspectorProxy_AttachAvailabilityChanged = 1133
+    , WebInspectorProxy_SetAttachedWindowHeight = 1134
+    , WebInspectorProxy_SetAttachedWindowWidth = 1135
+    , WebInspectorProxy_SetSheetRect = 1136
+    , WebInspectorProxy_StartWindowDrag = 1137
+    , NetworkProcessProxy_DidReceiveAuthenticationChallenge = 1138
+    , NetworkProcessProxy_NegotiatedLegacyTLS = 1139
+    , NetworkProcessProxy_DidNegotiateModernTLS = 1140
+    , NetworkProcessProxy_DidFetchWebsiteData = 1141
+    , NetworkProcessProxy_DidDeleteWebsiteData = 1142
+    , NetworkProcessProxy_DidDeleteWebsiteDataForOrigins = 1143
+    , NetworkProcessProxy_DidSyncAllCookies = 1144
+    , NetworkProcessProxy_TestProcessIncomingSyncMessagesWhenWaitingForSyncReply = 1145
+    , NetworkProcessProxy_TerminateUnresponsiveServiceWorkerProcesses = 1146
+    , NetworkProcessProxy_SetIsHoldingLockedFiles = 1147
+    , NetworkProcessProxy_LogDiagnosticMessage = 1148
+    , NetworkProcessProxy_LogDiagnosticMessageWithResult = 1149
+    , NetworkProcessProxy_LogDiagnosticMessageWithValue = 1150
+#if ENABLE(RESOURCE_LOAD_STATISTICS)
+    , NetworkProcessProxy_LogTestingEvent = 1151
+#endif
+#if ENABLE(RESOURCE_LOAD_STATISTICS)
+    , NetworkProcessProxy_NotifyResourceLoadStatisticsProcessed = 1152
+#endif
+#if ENABLE(RESOURCE_LOAD_STATISTICS)
+    , NetworkProcessProxy_NotifyWebsiteDataDeletionForRegistrableDomainsFinished = 1153
+#endif
+#if ENABLE(RESOURCE_LOAD_STATISTICS)
+    , NetworkProcessProxy_NotifyWebsiteDataScanForRegistrableDomainsFinished = 1154
+#endif
+#if ENABLE(RESOURCE_LOAD_STATISTICS)
+    , NetworkProcessProxy_NotifyResourceLoadStatisticsTelemetryFinished = 1155
+#endif
+#if ENABLE(RESOURCE_LOAD_STATISTICS)
+    , NetworkProcessProxy_RequestStorageAccessConfirm = 1156
+    , NetworkProcessProxy_RequestStorageAccessConfirmReply = 1157
+#endif
+#if ENABLE(RESOURCE_LOAD_STATISTICS)
+    , NetworkProcessProxy_DeleteWebsiteDataInUIProcessForRegistrableDomains = 1158
+    , NetworkProcessProxy_DeleteWebsiteDataInUIProcessForRegistrableDomainsReply = 1159
+#endif
+#if ENABLE(RESOURCE_LOAD_STATISTICS)
+    , NetworkProcessProxy_DidCommitCrossSiteLoadWithDataTransferFromPrevalentResource = 1160
+#endif
+#if ENABLE(RESOURCE_LOAD_STATISTICS)
+    , NetworkProcessProxy_SetDomainsWithUserInteraction = 1161
 #endif
 #if ENABLE(CONTENT_EXTENSIONS)
-    , NetworkProcessProxy_ContentExtensionRules = 1161
+    , NetworkProcessProxy_ContentExtensionRules = 1162
 #endif
-    , NetworkProcessProxy_RetrieveCacheStorageParameters = 1162
-    , NetworkProcessProxy_TerminateWebProcess = 1163
+    , NetworkProcessProxy_RetrieveCacheStorageParameters = 1163
+    , NetworkProcessProxy_TerminateWebProcess = 1164
 #if ENABLE(SERVICE_WORKER)
-    , NetworkProcessProxy_EstablishWorkerContextConnectionToNetworkProcess = 1164
-    , NetworkProcessProxy_EstablishWorkerContextConnectionToNetworkProcessReply = 1165
+    , NetworkProcessProxy_EstablishWorkerContextConnectionToNetworkProcess = 1165
+    , NetworkProcessProxy_EstablishWorkerContextConnectionToNetworkProcessReply = 1166
 #endif
 #if ENABLE(SERVICE_WORKER)
-    , NetworkProcessProxy_WorkerContextConnectionNoLongerNeeded = 1166
+    , NetworkProcessProxy_WorkerContextConnectionNoLongerNeeded = 1167
 #endif
 #if ENABLE(SERVICE_WORKER)
-    , NetworkProcessProxy_RegisterServiceWorkerClientProcess = 1167
+    , NetworkProcessProxy_RegisterServiceWorkerClientProcess = 1168
 #endif
 #if ENABLE(SERVICE_WORKER)
-    , NetworkProcessProxy_UnregisterServiceWorkerClientProcess = 1168
-#endif
-    , NetworkProcessProxy_SetWebProcessHasUploads = 1169
-    , NetworkProcessProxy_GetAppBoundDomains = 1170
-    , NetworkProcessProxy_GetAppBoundDomainsReply = 1171
-    , NetworkProcessProxy_RequestStorageSpace = 1172
-    , NetworkProcessProxy_RequestStorageSpaceReply = 1173
-    , NetworkProcessProxy_ResourceLoadDidSendRequest = 1174
-    , NetworkProcessProxy_ResourceLoadDidPerformHTTPRedirection = 1175
-    , NetworkProcessProxy_ResourceLoadDidReceiveChallenge = 1176
-    , NetworkProcessProxy_ResourceLoadDidReceiveResponse = 1177
-    , NetworkProcessProxy_ResourceLoadDidCompleteWithError = 1178
-    , PluginProcessProxy_DidCreateWebProcessConnection = 1179
-    , PluginProcessProxy_DidGetSitesWithData = 1180
-    , PluginProcessProxy_DidDeleteWebsiteData = 1181
-    , PluginProcessProxy_DidDeleteWebsiteDataForHostNames = 1182
-#if PLATFORM(COCOA)
-    , PluginProcessProxy_SetModalWindowIsShowing = 1183
-#endif
-#if PLATFORM(COCOA)
-    , PluginProcessProxy_SetFullscreenWindowIsShowing = 1184
-#endif
-#if PLATFORM(COCOA)
-    , PluginProcessProxy_LaunchProcess = 1185
-#endif
-#if PLATFORM(COCOA)
-    , PluginProcessProxy_LaunchApplicationAtURL = 1186
-#endif
-#if PLATFORM(COCOA)
-    , PluginProcessProxy_OpenURL = 1187
-#endif
-#if PLATFORM(COCOA)
-    , PluginProcessProxy_OpenFile = 1188
-#endif
-    , WebUserContentControllerProxy_DidPostMessage = 1189
-    , WebUserContentControllerProxy_DidPostMessageReply = 1190
-    , WebProcess_InitializeWebProcess = 1191
-    , WebProcess_SetWebsiteDataStoreParameters = 1192
-    , WebProcess_CreateWebPage = 1193
-    , WebProcess_PrewarmGlobally = 1194
-    , WebProcess_PrewarmWithDomainInformation = 1195
-    , WebProcess_SetCacheModel = 1196
-    , WebProcess_RegisterURLSchemeAsEmptyDocument = 1197
-    , WebProcess_RegisterURLSchemeAsSecure = 1198
-    , WebProcess_RegisterURLSchemeAsBypassingContentSecurityPolicy = 1199
-    , WebProcess_SetDomainRelaxationForbiddenForURLScheme = 1200
-    , WebProcess_RegisterURLSchemeAsLocal = 1201
-    , WebProcess_RegisterURLSchemeAsNoAccess = 1202
-    , WebProcess_RegisterURLSchemeAsDisplayIsolated = 1203
-    , WebProcess_RegisterURLSchemeAsCORSEnabled = 1204
-    , WebProcess_RegisterURLSchemeAsCachePartitioned = 1205
-    , WebProcess_RegisterURLSchemeAsCanDisplayOnlyIfCanRequest = 1206
-    , WebProcess_SetDefaultRequestTimeoutInterval = 1207
-    , WebProcess_SetAlwaysUsesComplexTextCodePath = 1208
-    , WebProcess_SetShouldUseFontSmoothing = 1209
-    , WebProcess_SetResourceLoadStatisticsEnabled = 1210
-    , WebProcess_ClearResourceLoadStatistics = 1211
-    , WebProcess_UserPreferredLanguagesChanged = 1212
-    , WebProcess_FullKeyboardAccessModeChanged = 1213
-    , WebProcess_DidAddPlugInAutoStartOriginHash = 1214
-    , WebProcess_ResetPlugInAutoStartOriginHashes = 1215
-    , WebProcess_SetPluginLoadClientPolicy = 1216
-    , WebProcess_ResetPluginLoadClientPolicies = 1217
-    , WebProcess_ClearPluginClientPolicies = 1218
-    , WebProcess_RefreshPlugins = 1219
-    , WebProcess_StartMemorySampler = 1220
-    , WebProcess_StopMemorySampler = 1221
-    , WebProcess_SetTextCheckerState = 1222
-    , WebProcess_SetEnhancedAccessibility = 1223
-    , WebProcess_GarbageCollectJavaScriptObjects = 1224
-    , WebProcess_SetJavaScriptGarbageCollectorTimerEnabled = 1225
-    , WebProcess_SetInjectedBundleParameter = 1226
-    , WebProcess_SetInjectedBundleParameters = 1227
-    , WebProcess_HandleInjectedBundleMessage = 1228
-    , WebProcess_FetchWebsiteData = 1229
-    , WebProcess_FetchWebsiteDataReply = 1230
-    , WebProcess_DeleteWebsiteData = 1231
-    , WebProcess_DeleteWebsiteDataReply = 1232
-    , WebProcess_DeleteWebsiteDataForOrigins = 1233
-    , WebProcess_DeleteWebsiteDataForOriginsReply = 1234
-    , WebProcess_SetHiddenPageDOMTimerThrottlingIncreaseLimit = 1235
-#if PLATFORM(COCOA)
-    , WebProcess_SetQOS = 1236
-#endif
-    , WebProcess_SetMemoryCacheDisabled = 1237
+    , NetworkProcessProxy_UnregisterServiceWorkerClientProcess = 1169
+#endif
+    , NetworkProcessProxy_SetWebProcessHasUploads = 1170
+    , NetworkProcessProxy_GetAppBoundDomains = 1171
+    , NetworkProcessProxy_GetAppBoundDomainsReply = 1172
+    , NetworkProcessProxy_RequestStorageSpace = 1173
+    , NetworkProcessProxy_RequestStorageSpaceReply = 1174
+    , NetworkProcessProxy_ResourceLoadDidSendRequest = 1175
+    , NetworkProcessProxy_ResourceLoadDidPerformHTTPRedirection = 1176
+    , NetworkProcessProxy_ResourceLoadDidReceiveChallenge = 1177
+    , NetworkProcessProxy_ResourceLoadDidReceiveResponse = 1178
+    , NetworkProcessProxy_ResourceLoadDidCompleteWithError = 1179
+    , PluginProcessProxy_DidCreateWebProcessConnection = 1180
+    , PluginProcessProxy_DidGetSitesWithData = 1181
+    , PluginProcessProxy_DidDeleteWebsiteData = 1182
+    , PluginProcessProxy_DidDeleteWebsiteDataForHostNames = 1183
+#if PLATFORM(COCOA)
+    , PluginProcessProxy_SetModalWindowIsShowing = 1184
+#endif
+#if PLATFORM(COCOA)
+    , PluginProcessProxy_SetFullscreenWindowIsShowing = 1185
+#endif
+#if PLATFORM(COCOA)
+    , PluginProcessProxy_LaunchProcess = 1186
+#endif
+#if PLATFORM(COCOA)
+    , PluginProcessProxy_LaunchApplicationAtURL = 1187
+#endif
+#if PLATFORM(COCOA)
+    , PluginProcessProxy_OpenURL = 1188
+#endif
+#if PLATFORM(COCOA)
+    , PluginProcessProxy_OpenFile = 1189
+#endif
+    , WebUserContentControllerProxy_DidPostMessage = 1190
+    , WebUserContentControllerProxy_DidPostMessageReply = 1191
+    , WebProcess_InitializeWebProcess = 1192
+    , WebProcess_SetWebsiteDataStoreParameters = 1193
+    , WebProcess_CreateWebPage = 1194
+    , WebProcess_PrewarmGlobally = 1195
+    , WebProcess_PrewarmWithDomainInformation = 1196
+    , WebProcess_SetCacheModel = 1197
+    , WebProcess_RegisterURLSchemeAsEmptyDocument = 1198
+    , WebProcess_RegisterURLSchemeAsSecure = 1199
+    , WebProcess_RegisterURLSchemeAsBypassingContentSecurityPolicy = 1200
+    , WebProcess_SetDomainRelaxationForbiddenForURLScheme = 1201
+    , WebProcess_RegisterURLSchemeAsLocal = 1202
+    , WebProcess_RegisterURLSchemeAsNoAccess = 1203
+    , WebProcess_RegisterURLSchemeAsDisplayIsolated = 1204
+    , WebProcess_RegisterURLSchemeAsCORSEnabled = 1205
+    , WebProcess_RegisterURLSchemeAsCachePartitioned = 1206
+    , WebProcess_RegisterURLSchemeAsCanDisplayOnlyIfCanRequest = 1207
+    , WebProcess_SetDefaultRequestTimeoutInterval = 1208
+    , WebProcess_SetAlwaysUsesComplexTextCodePath = 1209
+    , WebProcess_SetShouldUseFontSmoothing = 1210
+    , WebProcess_SetResourceLoadStatisticsEnabled = 1211
+    , WebProcess_ClearResourceLoadStatistics = 1212
+    , WebProcess_UserPreferredLanguagesChanged = 1213
+    , WebProcess_FullKeyboardAccessModeChanged = 1214
+    , WebProcess_DidAddPlugInAutoStartOriginHash = 1215
+    , WebProcess_ResetPlugInAutoStartOriginHashes = 1216
+    , WebProcess_SetPluginLoadClientPolicy = 1217
+    , WebProcess_ResetPluginLoadClientPolicies = 1218
+    , WebProcess_ClearPluginClientPolicies = 1219
+    , WebProcess_RefreshPlugins = 1220
+    , WebProcess_StartMemorySampler = 1221
+    , WebProcess_StopMemorySampler = 1222
+    , WebProcess_SetTextCheckerState = 1223
+    , WebProcess_SetEnhancedAccessibility = 1224
+    , WebProcess_GarbageCollectJavaScriptObjects = 1225
+    , WebProcess_SetJavaScriptGarbageCollectorTimerEnabled = 1226
+    , WebProcess_SetInjectedBundleParameter = 1227
+    , WebProcess_SetInjectedBundleParameters = 1228
+    , WebProcess_HandleInjectedBundleMessage = 1229
+    , WebProcess_FetchWebsiteData = 1230
+    , WebProcess_FetchWebsiteDataReply = 1231
+    , WebProcess_DeleteWebsiteData = 1232
+    , WebProcess_DeleteWebsiteDataReply = 1233
+    , WebProcess_DeleteWebsiteDataForOrigins = 1234
+    , WebProcess_DeleteWebsiteDataForOriginsReply = 1235
+    , WebProcess_SetHiddenPageDOMTimerThrottlingIncreaseLimit = 1236
+#if PLATFORM(COCOA)
+    , WebProcess_SetQOS = 1237
+#endif
+    , WebProcess_SetMemoryCacheDisabled = 1238
 #if ENABLE(SERVICE_CONTROLS)
-    , WebProcess_SetEnabledServices = 1238
-#endif
-    , WebProcess_EnsureAutomationSessionProxy = 1239
-    , WebProcess_DestroyAutomationSessionProxy = 1240
-    , WebProcess_PrepareToSuspend = 1241
-    , WebProcess_PrepareToSuspendReply = 1242
-    , WebProcess_ProcessDidResume = 1243
-    , WebProcess_MainThreadPing = 1244
-    , WebProcess_BackgroundResponsivenessPing = 1245
+    , WebProcess_SetEnabledServices = 1239
+#endif
+    , WebProcess_EnsureAutomationSessionProxy = 1240
+    , WebProcess_DestroyAutomationSessionProxy = 1241
+    , WebProcess_PrepareToSuspend = 1242
+    , WebProcess_PrepareToSuspendReply = 1243
+    , WebProcess_ProcessDidResume = 1244
+    , WebProcess_MainThreadPing = 1245
+    , WebProcess_BackgroundResponsivenessPing = 1246
 #if ENABLE(GAMEPAD)
-    , WebProcess_SetInitialGamepads = 1246
+    , WebProcess_SetInitialGamepads = 1247
 #endif
 #if ENABLE(GAMEPAD)
-    , WebProcess_GamepadConnected = 1247
+    , WebProcess_GamepadConnected = 1248
 #endif
 #if ENABLE(GAMEPAD)
-    , WebProcess_GamepadDisconnected = 1248
+    , WebProcess_GamepadDisconnected = 1249
 #endif
 #if ENABLE(SERVICE_WORKER)
-    , WebProcess_EstablishWorkerContextConnectionToNetworkProcess = 1249
-    , WebProcess_EstablishWorkerContextConnectionToNetworkProcessReply = 1250
+    , WebProcess_EstablishWorkerContextConnectionToNetworkProcess = 1250
+    , WebProcess_EstablishWorkerContextConnectionToNetworkProcessReply = 1251
 #endif
-    , WebProcess_SetHasSuspendedPageProxy = 1251
-    , WebProcess_SetIsInProcessCache = 1252
-    , WebProcess_MarkIsNoLongerPrewarmed = 1253
-    , WebProcess_GetActivePagesOriginsForTesting = 1254
-    , WebProcess_GetActivePagesOriginsForTestingReply = 1255
+    , WebProcess_SetHasSuspendedPageProxy = 1252
+    , WebProcess_SetIsInProcessCache = 1253
+    , WebProcess_MarkIsNoLongerPrewarmed = 1254
+    , WebProcess_GetActivePagesOriginsForTesting = 1255
+    , WebProcess_GetActivePagesOriginsForTestingReply = 1256
 #if PLATFORM(COCOA)
-    , WebProcess_SetScreenProperties = 1256
+    , WebProcess_SetScreenProperties = 1257
 #endif
 #if PLATFORM(MAC) && ENABLE(WEBPROCESS_WINDOWSERVER_BLOCKING)
-    , WebProcess_ScrollerStylePreferenceChanged = 1257
+    , WebProcess_ScrollerStylePreferenceChanged = 1258
 #endif
 #if PLATFORM(MAC) && ENABLE(WEBPROCESS_WINDOWSERVER_BLOCKING)
-    , WebProcess_DisplayConfigurationChanged = 1258
+    , WebProcess_DisplayConfigurationChanged = 1259
 #endif
 #if PLATFORM(IOS_FAMILY) && !PLATFORM(MACCATALYST)
-    , WebProcess_BacklightLevelDidChange = 1259
+    , WebProcess_BacklightLevelDidChange = 1260
 #endif
-    , WebProcess_IsJITEnabled = 1260
-    , WebProcess_IsJITEnabledReply = 1261
+    , WebProcess_IsJITEnabled = 1261
+    , WebProcess_IsJITEnabledReply = 1262
 #if PLATFORM(COCOA)
-    , WebProcess_SetMediaMIMETypes = 1262
+    , WebProcess_SetMediaMIMETypes = 1263
 #endif
 #if (PLATFORM(COCOA) && ENABLE(REMOTE_INSPECTOR))
-    , WebProcess_EnableRemoteWebInspector = 1263
+    , WebProcess_EnableRemoteWebInspector = 1264
 #endif
 #if ENABLE(MEDIA_STREAM)
-    , WebProcess_AddMockMediaDevice = 1264
+    , WebProcess_AddMockMediaDevice = 1265
 #endif
 #if ENABLE(MEDIA_STREAM)
-    , WebProcess_ClearMockMediaDevices = 1265
+    , WebProcess_ClearMockMediaDevices = 1266
 #endif
 #if ENABLE(MEDIA_STREAM)
-    , WebProcess_RemoveMockMediaDevice = 1266
+    , WebProcess_RemoveMockMediaDevice = 1267
 #endif
 #if ENABLE(MEDIA_STREAM)
-    , WebProcess_ResetMockMediaDevices = 1267
+    , WebProcess_ResetMockMediaDevices = 1268
 #endif
 #if (ENABLE(MEDIA_STREAM) && ENABLE(SANDBOX_EXTENSIONS))
-    , WebProcess_GrantUserMediaDeviceSandboxExtensions = 1268
+    , WebProcess_GrantUserMediaDeviceSandboxExtensions = 1269
 #endif
 #if (ENABLE(MEDIA_STREAM) && ENABLE(SANDBOX_EXTENSIONS))
-    , WebProcess_RevokeUserMediaDeviceSandboxExtensions = 1269
+    , WebProcess_RevokeUserMediaDeviceSandboxExtensions = 1270
 #endif
-    , WebProcess_ClearCurrentModifierStateForTesting = 1270
-    , WebProcess_SetBackForwardCacheCapacity = 1271
-    , WebProcess_ClearCachedPage = 1272
-    , WebProcess_ClearCachedPageReply = 1273
+    , WebProcess_ClearCurrentModifierStateForTesting = 1271
+    , WebProcess_SetBackForwardCacheCapacity = 1272
+    , WebProcess_ClearCachedPage = 1273
+    , WebProcess_ClearCachedPageReply = 1274
 #if PLATFORM(GTK) || PLATFORM(WPE)
-    , WebProcess_SendMessageToWebExtension = 1274
+    , WebProcess_SendMessageToWebExtension = 1275
 #endif
 #if ENABLE(RESOURCE_LOAD_STATISTICS)
-    , WebProcess_SeedResourceLoadStatisticsForTesting = 1275
-    , WebProcess_SeedResourceLoadStatisticsForTestingReply = 1276
+    , WebProcess_SeedResourceLoadStatisticsForTesting = 1276
+    , WebProcess_SeedResourceLoadStatisticsForTestingReply = 1277
 #endif
 #if ENABLE(RESOURCE_LOAD_STATISTICS)
-    , WebProcess_SetThirdPartyCookieBlockingMode = 1277
-    , WebProcess_SetThirdPartyCookieBlockingModeReply = 1278
+    , WebProcess_SetThirdPartyCookieBlockingMode = 1278
+    , WebProcess_SetThirdPartyCookieBlockingModeReply = 1279
 #endif
 #if ENABLE(RESOURCE_LOAD_STATISTICS)
-    , WebProcess_SetDomainsWithUserInteraction = 1279
+    , WebProcess_SetDomainsWithUserInteraction = 1280
 #endif
 #if PLATFORM(IOS)
-    , WebProcess_GrantAccessToAssetServices = 1280
+    , WebProcess_GrantAccessToAssetServices = 1281
 #endif
 #if PLATFORM(IOS)
-    , WebProcess_RevokeAccessToAssetServices = 1281
+    , WebProcess_RevokeAccessToAssetServices = 1282
 #endif
 #if PLATFORM(COCOA)
-    , WebProcess_UnblockServicesRequiredByAccessibility = 1282
+    , WebProcess_UnblockServicesRequiredByAccessibility = 1283
 #endif
 #if (PLATFORM(COCOA) && ENABLE(CFPREFS_DIRECT_MODE))
-    , WebProcess_NotifyPreferencesChanged = 1283
+    , WebProcess_NotifyPreferencesChanged = 1284
 #endif
 #if (PLATFORM(COCOA) && ENABLE(CFPREFS_DIRECT_MODE))
-    , WebProcess_UnblockPreferenceService = 1284
+    , WebProcess_UnblockPreferenceService = 1285
 #endif
 #if PLATFORM(GTK) && !USE(GTK4)
-    , WebProcess_SetUseSystemAppearanceForScrollbars = 1285
-#endif
-    , WebAutomationSessionProxy_EvaluateJavaScriptFunction = 1286
-    , WebAutomationSessionProxy_ResolveChildFrameWithOrdinal = 1287
-    , WebAutomationSessionProxy_ResolveChildFrameWithOrdinalReply = 1288
-    , WebAutomationSessionProxy_ResolveChildFrameWithNodeHandle = 1289
-    , WebAutomationSessionProxy_ResolveChildFrameWithNodeHandleReply = 1290
-    , WebAutomationSessionProxy_ResolveChildFrameWithName = 1291
-    , WebAutomationSessionProxy_ResolveChildFrameWithNameReply = 1292
-    , WebAutomationSessionProxy_ResolveParentFrame = 1293
-    , WebAutomationSessionProxy_ResolveParentFrameReply = 1294
-    , WebAutomationSessionProxy_FocusFrame = 1295
-    , WebAutomationSessionProxy_ComputeElementLayout = 1296
-    , WebAutomationSessionProxy_ComputeElementLayoutReply = 1297
-    , WebAutomationSessionProxy_SelectOptionElement = 1298
-    , WebAutomationSessionProxy_SelectOptionElementReply = 1299
-    , WebAutomationSessionProxy_SetFilesForInputFileUpload = 1300
-    , WebAutomationSessionProxy_SetFilesForInputFileUploadReply = 1301
-    , WebAutomationSessionProxy_TakeScreenshot = 1302
-    , WebAutomationSessionProxy_SnapshotRectForScreenshot = 1303
-    , WebAutomationSessionProxy_SnapshotRectForScreenshotReply = 1304
-    , WebAutomationSessionProxy_GetCookiesForFrame = 1305
-    , WebAutomationSessionProxy_GetCookiesForFrameReply = 1306
-    , WebAutomationSessionProxy_DeleteCookie = 1307
-    , WebAutomationSessionProxy_DeleteCookieReply = 1308
-    , WebIDBConnectionToServer_DidDeleteDatabase = 1309
-    , WebIDBConnectionToServer_DidOpenDatabase = 1310
-    , WebIDBConnectionToServer_DidAbortTransaction = 1311
-    , WebIDBConnectionToServer_DidCommitTransaction = 1312
-    , WebIDBConnectionToServer_DidCreateObjectStore = 1313
-    , WebIDBConnectionToServer_DidDeleteObjectStore = 1314
-    , WebIDBConnectionToServer_DidRenameObjectStore = 1315
-    , WebIDBConnectionToServer_DidClearObjectStore = 1316
-    , WebIDBConnectionToServer_DidCreateIndex = 1317
-    , WebIDBConnectionToServer_DidDeleteIndex = 1318
-    , WebIDBConnectionToServer_DidRenameIndex = 1319
-    , WebIDBConnectionToServer_DidPutOrAdd = 1320
-    , WebIDBConnectionToServer_DidGetRecord = 1321
-    , WebIDBConnectionToServer_DidGetAllRecords = 1322
-    , WebIDBConnectionToServer_DidGetCount = 1323
-    , WebIDBConnectionToServer_DidDeleteRecord = 1324
-    , WebIDBConnectionToServer_DidOpenCursor = 1325
-    , WebIDBConnectionToServer_DidIterateCursor = 1326
-    , WebIDBConnectionToServer_FireVersionChangeEvent = 1327
-    , WebIDBConnectionToServer_DidStartTransaction = 1328
-    , WebIDBConnectionToServer_DidCloseFromServer = 1329
-    , WebIDBConnectionToServer_NotifyOpenDBRequestBlocked = 1330
-    , WebIDBConnectionToServer_DidGetAllDatabaseNamesAndVersions = 1331
-    , WebFullScreenManager_RequestExitFullScreen = 1332
-    , WebFullScreenManager_WillEnterFullScreen = 1333
-    , WebFullScreenManager_DidEnterFullScreen = 1334
-    , WebFullScreenManager_WillExitFullScreen = 1335
-    , WebFullScreenManager_DidExitFullScreen = 1336
-    , WebFullScreenManager_SetAnimatingFullScreen = 1337
-    , WebFullScreenManager_SaveScrollPosition = 1338
-    , WebFullScreenManager_RestoreScrollPosition = 1339
-    , WebFullScreenManager_SetFullscreenInsets = 1340
-    , WebFullScreenManager_SetFullscreenAutoHideDuration = 1341
-    , WebFullScreenManager_SetFullscreenControlsHidden = 1342
-    , GPUProcessConnection_DidReceiveRemoteCommand = 1343
-    , RemoteRenderingBackend_CreateImageBufferBackend = 1344
-    , RemoteRenderingBackend_CommitImageBufferFlushContext = 1345
-    , MediaPlayerPrivateRemote_NetworkStateChanged = 1346
-    , MediaPlayerPrivateRemote_ReadyStateChanged = 1347
-    , MediaPlayerPrivateRemote_FirstVideoFrameAvailable = 1348
-    , MediaPlayerPrivateRemote_VolumeChanged = 1349
-    , MediaPlayerPrivateRemote_MuteChanged = 1350
-    , MediaPlayerPrivateRemote_TimeChanged = 1351
-    , MediaPlayerPrivateRemote_DurationChanged = 1352
-    , MediaPlayerPrivateRemote_RateChanged = 1353
-    , MediaPlayerPrivateRemote_PlaybackStateChanged = 1354
-    , MediaPlayerPrivateRemote_EngineFailedToLoad = 1355
-    , MediaPlayerPrivateRemote_UpdateCachedState = 1356
-    , MediaPlayerPrivateRemote_CharacteristicChanged = 1357
-    , MediaPlayerPrivateRemote_SizeChanged = 1358
-    , MediaPlayerPrivateRemote_AddRemoteAudioTrack = 1359
-    , MediaPlayerPrivateRemote_RemoveRemoteAudioTrack = 1360
-    , MediaPlayerPrivateRemote_RemoteAudioTrackConfigurationChanged = 1361
-    , MediaPlayerPrivateRemote_AddRemoteTextTrack = 1362
-    , MediaPlayerPrivateRemote_RemoveRemoteTextTrack = 1363
-    , MediaPlayerPrivateRemote_RemoteTextTrackConfigurationChanged = 1364
-    , MediaPlayerPrivateRemote_ParseWebVTTFileHeader = 1365
-    , MediaPlayerPrivateRemote_ParseWebVTTCueData = 1366
-    , MediaPlayerPrivateRemote_ParseWebVTTCueDataStruct = 1367
-    , MediaPlayerPrivateRemote_AddDataCue = 1368
+    , WebProcess_SetUseSystemAppearanceForScrollbars = 1286
+#endif
+    , WebAutomationSessionProxy_EvaluateJavaScriptFunction = 1287
+    , WebAutomationSessionProxy_ResolveChildFrameWithOrdinal = 1288
+    , WebAutomationSessionProxy_ResolveChildFrameWithOrdinalReply = 1289
+    , WebAutomationSessionProxy_ResolveChildFrameWithNodeHandle = 1290
+    , WebAutomationSessionProxy_ResolveChildFrameWithNodeHandleReply = 1291
+    , WebAutomationSessionProxy_ResolveChildFrameWithName = 1292
+    , WebAutomationSessionProxy_ResolveChildFrameWithNameReply = 1293
+    , WebAutomationSessionProxy_ResolveParentFrame = 1294
+    , WebAutomationSessionProxy_ResolveParentFrameReply = 1295
+    , WebAutomationSessionProxy_FocusFrame = 1296
+    , WebAutomationSessionProxy_ComputeElementLayout = 1297
+    , WebAutomationSessionProxy_ComputeElementLayoutReply = 1298
+    , WebAutomationSessionProxy_SelectOptionElement = 1299
+    , WebAutomationSessionProxy_SelectOptionElementReply = 1300
+    , WebAutomationSessionProxy_SetFilesForInputFileUpload = 1301
+    , WebAutomationSessionProxy_SetFilesForInputFileUploadReply = 1302
+    , WebAutomationSessionProxy_TakeScreenshot = 1303
+    , WebAutomationSessionProxy_SnapshotRectForScreenshot = 1304
+    , WebAutomationSessionProxy_SnapshotRectForScreenshotReply = 1305
+    , WebAutomationSessionProxy_GetCookiesForFrame = 1306
+    , WebAutomationSessionProxy_GetCookiesForFrameReply = 1307
+    , WebAutomationSessionProxy_DeleteCookie = 1308
+    , WebAutomationSessionProxy_DeleteCookieReply = 1309
+    , WebIDBConnectionToServer_DidDeleteDatabase = 1310
+    , WebIDBConnectionToServer_DidOpenDatabase = 1311
+    , WebIDBConnectionToServer_DidAbortTransaction = 1312
+    , WebIDBConnectionToServer_DidCommitTransaction = 1313
+    , WebIDBConnectionToServer_DidCreateObjectStore = 1314
+    , WebIDBConnectionToServer_DidDeleteObjectStore = 1315
+    , WebIDBConnectionToServer_DidRenameObjectStore = 1316
+    , WebIDBConnectionToServer_DidClearObjectStore = 1317
+    , WebIDBConnectionToServer_DidCreateIndex = 1318
+    , WebIDBConnectionToServer_DidDeleteIndex = 1319
+    , WebIDBConnectionToServer_DidRenameIndex = 1320
+    , WebIDBConnectionToServer_DidPutOrAdd = 1321
+    , WebIDBConnectionToServer_DidGetRecord = 1322
+    , WebIDBConnectionToServer_DidGetAllRecords = 1323
+    , WebIDBConnectionToServer_DidGetCount = 1324
+    , WebIDBConnectionToServer_DidDeleteRecord = 1325
+    , WebIDBConnectionToServer_DidOpenCursor = 1326
+    , WebIDBConnectionToServer_DidIterateCursor = 1327
+    , WebIDBConnectionToServer_FireVersionChangeEvent = 1328
+    , WebIDBConnectionToServer_DidStartTransaction = 1329
+    , WebIDBConnectionToServer_DidCloseFromServer = 1330
+    , WebIDBConnectionToServer_NotifyOpenDBRequestBlocked = 1331
+    , WebIDBConnectionToServer_DidGetAllDatabaseNamesAndVersions = 1332
+    , WebFullScreenManager_RequestExitFullScreen = 1333
+    , WebFullScreenManager_WillEnterFullScreen = 1334
+    , WebFullScreenManager_DidEnterFullScreen = 1335
+    , WebFullScreenManager_WillExitFullScreen = 1336
+    , WebFullScreenManager_DidExitFullScreen = 1337
+    , WebFullScreenManager_SetAnimatingFullScreen = 1338
+    , WebFullScreenManager_SaveScrollPosition = 1339
+    , WebFullScreenManager_RestoreScrollPosition = 1340
+    , WebFullScreenManager_SetFullscreenInsets = 1341
+    , WebFullScreenManager_SetFullscreenAutoHideDuration = 1342
+    , WebFullScreenManager_SetFullscreenControlsHidden = 1343
+    , GPUProcessConnection_DidReceiveRemoteCommand = 1344
+    , RemoteRenderingBackend_CreateImageBufferBackend = 1345
+    , RemoteRenderingBackend_CommitImageBufferFlushContext = 1346
+    , MediaPlayerPrivateRemote_NetworkStateChanged = 1347
+    , MediaPlayerPrivateRemote_ReadyStateChanged = 1348
+    , MediaPlayerPrivateRemote_FirstVideoFrameAvailable = 1349
+    , MediaPlayerPrivateRemote_VolumeChanged = 1350
+    , MediaPlayerPrivateRemote_MuteChanged = 1351
+    , MediaPlayerPrivateRemote_TimeChanged = 1352
+    , MediaPlayerPrivateRemote_DurationChanged = 1353
+    , MediaPlayerPrivateRemote_RateChanged = 1354
+    , MediaPlayerPrivateRemote_PlaybackStateChanged = 1355
+    , MediaPlayerPrivateRemote_EngineFailedToLoad = 1356
+    , MediaPlayerPrivateRemote_UpdateCachedState = 1357
+    , MediaPlayerPrivateRemote_CharacteristicChanged = 1358
+    , MediaPlayerPrivateRemote_SizeChanged = 1359
+    , MediaPlayerPrivateRemote_AddRemoteAudioTrack = 1360
+    , MediaPlayerPrivateRemote_RemoveRemoteAudioTrack = 1361
+    , MediaPlayerPrivateRemote_RemoteAudioTrackConfigurationChanged = 1362
+    , MediaPlayerPrivateRemote_AddRemoteTextTrack = 1363
+    , MediaPlayerPrivateRemote_RemoveRemoteTextTrack = 1364
+    , MediaPlayerPrivateRemote_RemoteTextTrackConfigurationChanged = 1365
+    , MediaPlayerPrivateRemote_ParseWebVTTFileHeader = 1366
+    , MediaPlayerPrivateRemote_ParseWebVTTCueData = 1367
+    , MediaPlayerPrivateRemote_ParseWebVTTCueDataStruct = 1368
+    , MediaPlayerPrivateRemote_AddDataCue = 1369
 #if ENABLE(DATACUE_VALUE)
-    , MediaPlayerPrivateRemote_AddDataCueWithType = 1369
+    , MediaPlayerPrivateRemote_AddDataCueWithType = 1370
 #endif
 #if ENABLE(DATACUE_VALUE)
-    , MediaPlayerPrivateRemote_UpdateDataCue = 1370
+    , MediaPlayerPrivateRemote_UpdateDataCue = 1371
 #endif
 #if ENABLE(DATACUE_VALUE)
-    , MediaPlayerPrivateRemote_RemoveDataCue = 1371
-#endif
-    , MediaPlayerPrivateRemote_AddGenericCue = 1372
-    , MediaPlayerPrivateRemote_UpdateGenericCue = 1373
-    , MediaPlayerPrivateRemote_RemoveGenericCue = 1374
-    , MediaPlayerPrivateRemote_AddRemoteVideoTrack = 1375
-    , MediaPlayerPrivateRemote_RemoveRemoteVideoTrack = 1376
-    , MediaPlayerPrivateRemote_RemoteVideoTrackConfigurationChanged = 1377
-    , MediaPlayerPrivateRemote_RequestResource = 1378
-    , MediaPlayerPrivateRemote_RequestResourceReply = 1379
-    , MediaPlayerPrivateRemote_RemoveResource = 1380
-    , MediaPlayerPrivateRemote_ResourceNotSupported = 1381
-    , MediaPlayerPrivateRemote_EngineUpdated = 1382
-    , MediaPlayerPrivateRemote_ActiveSourceBuffersChanged = 1383
+    , MediaPlayerPrivateRemote_RemoveDataCue = 1372
+#endif
+    , MediaPlayerPrivateRemote_AddGenericCue = 1373
+    , MediaPlayerPrivateRemote_UpdateGenericCue = 1374
+    , MediaPlayerPrivateRemote_RemoveGenericCue = 1375
+    , MediaPlayerPrivateRemote_AddRemoteVideoTrack = 1376
+    , MediaPlayerPrivateRemote_RemoveRemoteVideoTrack = 1377
+    , MediaPlayerPrivateRemote_RemoteVideoTrackConfigurationChanged = 1378
+    , MediaPlayerPrivateRemote_RequestResource = 1379
+    , MediaPlayerPrivateRemote_RequestResourceReply = 1380
+    , MediaPlayerPrivateRemote_RemoveResource = 1381
+    , MediaPlayerPrivateRemote_ResourceNotSupported = 1382
+    , MediaPlayerPrivateRemote_EngineUpdated = 1383
+    , MediaPlayerPrivateRemote_ActiveSourceBuffersChanged = 1384
 #if ENABLE(ENCRYPTED_MEDIA)
-    , MediaPlayerPrivateRemote_WaitingForKeyChanged = 1384
+    , MediaPlayerPrivateRemote_WaitingForKeyChanged = 1385
 #endif
 #if ENABLE(ENCRYPTED_MEDIA)
-    , MediaPlayerPrivateRemote_InitializationDataEncountered = 1385
+    , MediaPlayerPrivateRemote_InitializationDataEncountered = 1386
 #endif
 #if ENABLE(LEGACY_ENCRYPTED_MEDIA)
-    , MediaPlayerPrivateRemote_MediaPlayerKeyNeeded = 1386
+    , MediaPlayerPrivateRemote_MediaPlayerKeyNeeded = 1387
 #endif
 #if ENABLE(WIRELESS_PLAYBACK_TARGET)
-    , MediaPlayerPrivateRemote_CurrentPlaybackTargetIsWirelessChanged = 1387
-#endif
-    , RemoteAudioDestinationProxy_RenderBuffer = 1388
-    , RemoteAudioDestinationProxy_RenderBufferReply = 1389
-    , RemoteAudioDestinationProxy_DidChangeIsPlaying = 1390
-    , RemoteAudioSession_ConfigurationChanged = 1391
-    , RemoteAudioSession_BeginInterruption = 1392
-    , RemoteAudioSession_EndInterruption = 1393
-    , RemoteCDMInstanceSession_UpdateKeyStatuses = 1394
-    , RemoteCDMInstanceSession_SendMessage = 1395
-    , RemoteCDMInstanceSession_SessionIdChanged = 1396
-    , RemoteLegacyCDMSession_SendMessage = 1397
-    , RemoteLegacyCDMSession_SendError = 1398
-    , LibWebRTCCodecs_FailedDecoding = 1399
-    , LibWebRTCCodecs_CompletedDecoding = 1400
-    , LibWebRTCCodecs_CompletedEncoding = 1401
-    , SampleBufferDisplayLayer_SetDidFail = 1402
-    , WebGeolocationManager_DidChangePosition = 1403
-    , WebGeolocationManager_DidFailToDeterminePosition = 1404
-#if PLATFORM(IOS_FAMILY)
-    , WebGeolocationManager_ResetPermissions = 1405
-#endif
-    , RemoteWebInspectorUI_Initialize = 1406
-    , RemoteWebInspectorUI_UpdateFindString = 1407
+    , MediaPlayerPrivateRemote_CurrentPlaybackTargetIsWirelessChanged = 1388
+#endif
+    , RemoteAudioDestinationProxy_RenderBuffer = 1389
+    , RemoteAudioDestinationProxy_RenderBufferReply = 1390
+    , RemoteAudioDestinationProxy_DidChangeIsPlaying = 1391
+    , RemoteAudioSession_ConfigurationChanged = 1392
+    , RemoteAudioSession_BeginInterruption = 1393
+    , RemoteAudioSession_EndInterruption = 1394
+    , RemoteCDMInstanceSession_UpdateKeyStatuses = 1395
+    , RemoteCDMInstanceSession_SendMessage = 1396
+    , RemoteCDMInstanceSession_SessionIdChanged = 1397
+    , RemoteLegacyCDMSession_SendMessage = 1398
+    , RemoteLegacyCDMSession_SendError = 1399
+    , LibWebRTCCodecs_FailedDecoding = 1400
+    , LibWebRTCCodecs_CompletedDecoding = 1401
+    , LibWebRTCCodecs_CompletedEncoding = 1402
+    , SampleBufferDisplayLayer_SetDidFail = 1403
+    , WebGeolocationManager_DidChangePosition = 1404
+    , WebGeolocationManager_DidFailToDeterminePosition = 1405
+#if PLATFORM(IOS_FAMILY)
+    , WebGeolocationManager_ResetPermissions = 1406
+#endif
+    , RemoteWebInspectorUI_Initialize = 1407
+    , RemoteWebInspectorUI_UpdateFindString = 1408
 #if ENABLE(INSPECTOR_TELEMETRY)
-    , RemoteWebInspectorUI_SetDiagnosticLoggingAvailable = 1408
-#endif
-    , RemoteWebInspectorUI_DidSave = 1409
-    , RemoteWebInspectorUI_DidAppend = 1410
-    , RemoteWebInspectorUI_SendMessageToFrontend = 1411
-    , WebInspector_Show = 1412
-    , WebInspector_Close = 1413
-    , WebInspector_SetAttached = 1414
-    , WebInspector_ShowConsole = 1415
-    , WebInspector_ShowResources = 1416
-    , WebInspector_ShowMainResourceForFrame = 1417
-    , WebInspector_OpenInNewTab = 1418
-    , WebInspector_StartPageProfiling = 1419
-    , WebInspector_StopPageProfiling = 1420
-    , WebInspector_StartElementSelection = 1421
-    , WebInspector_StopElementSelection = 1422
-    , WebInspector_SetFrontendConnection = 1423
-    , WebInspectorInterruptDispatcher_NotifyNeedDebuggerBreak = 1424
-    , WebInspectorUI_EstablishConnection = 1425
-    , WebInspectorUI_UpdateConnection = 1426
-    , WebInspectorUI_AttachedBottom = 1427
-    , WebInspectorUI_AttachedRight = 1428
-    , WebInspectorUI_AttachedLeft = 1429
-    , WebInspectorUI_Detached = 1430
-    , WebInspectorUI_SetDockingUnavailable = 1431
-    , WebInspectorUI_SetIsVisible = 1432
-    , WebInspectorUI_UpdateFindString = 1433
+    , RemoteWebInspectorUI_SetDiagnosticLoggingAvailable = 1409
+#endif
+    , RemoteWebInspectorUI_DidSave = 1410
+    , RemoteWebInspectorUI_DidAppend = 1411
+    , RemoteWebInspectorUI_SendMessageToFrontend = 1412
+    , WebInspector_Show = 1413
+    , WebInspector_Close = 1414
+    , WebInspector_SetAttached = 1415
+    , WebInspector_ShowConsole = 1416
+    , WebInspector_ShowResources = 1417
+    , WebInspector_ShowMainResourceForFrame = 1418
+    , WebInspector_OpenInNewTab = 1419
+    , WebInspector_StartPageProfiling = 1420
+    , WebInspector_StopPageProfiling = 1421
+    , WebInspector_StartElementSelection = 1422
+    , WebInspector_StopElementSelection = 1423
+    , WebInspector_SetFrontendConnection = 1424
+    , WebInspectorInterruptDispatcher_NotifyNeedDebuggerBreak = 1425
+    , WebInspectorUI_EstablishConnection = 1426
+    , WebInspectorUI_UpdateConnection = 1427
+    , WebInspectorUI_AttachedBottom = 1428
+    , WebInspectorUI_AttachedRight = 1429
+    , WebInspectorUI_AttachedLeft = 1430
+    , WebInspectorUI_Detached = 1431
+    , WebInspectorUI_SetDockingUnavailable = 1432
+    , WebInspectorUI_SetIsVisible = 1433
+    , WebInspectorUI_UpdateFindString = 1434
 #if ENABLE(INSPECTOR_TELEMETRY)
-    , WebInspectorUI_SetDiagnosticLoggingAvailable = 1434
-#endif
-    , WebInspectorUI_ShowConsole = 1435
-    , WebInspectorUI_ShowResources = 1436
-    , WebInspectorUI_ShowMainResourceForFrame = 1437
-    , WebInspectorUI_StartPageProfiling = 1438
-    , WebInspectorUI_StopPageProfiling = 1439
-    , WebInspectorUI_StartElementSelection = 1440
-    , WebInspectorUI_StopElementSelection = 1441
-    , WebInspectorUI_DidSave = 1442
-    , WebInspectorUI_DidAppend = 1443
-    , WebInspectorUI_SendMessageToFrontend = 1444
-    , LibWebRTCNetwork_SignalReadPacket = 1445
-    , LibWebRTCNetwork_SignalSentPacket = 1446
-    , LibWebRTCNetwork_SignalAddressReady = 1447
-    , LibWebRTCNetwork_SignalConnect = 1448
-    , LibWebRTCNetwork_SignalClose = 1449
-    , LibWebRTCNetwork_SignalNewConnection = 1450
-    , WebMDNSRegister_FinishedRegisteringMDNSName = 1451
-    , WebRTCMonitor_NetworksChanged = 1452
-    , WebRTCResolver_SetResolvedAddress = 1453
-    , WebRTCResolver_ResolvedAddressError = 1454
+    , WebInspectorUI_SetDiagnosticLoggingAvailable = 1435
+#endif
+    , WebInspectorUI_ShowConsole = 1436
+    , WebInspectorUI_ShowResources = 1437
+    , WebInspectorUI_ShowMainResourceForFrame = 1438
+    , WebInspectorUI_StartPageProfiling = 1439
+    , WebInspectorUI_StopPageProfiling = 1440
+    , WebInspectorUI_StartElementSelection = 1441
+    , WebInspectorUI_StopElementSelection = 1442
+    , WebInspectorUI_DidSave = 1443
+    , WebInspectorUI_DidAppend = 1444
+    , WebInspectorUI_SendMessageToFrontend = 1445
+    , LibWebRTCNetwork_SignalReadPacket = 1446
+    , LibWebRTCNetwork_SignalSentPacket = 1447
+    , LibWebRTCNetwork_SignalAddressReady = 1448
+    , LibWebRTCNetwork_SignalConnect = 1449
+    , LibWebRTCNetwork_SignalClose = 1450
+    , LibWebRTCNetwork_SignalNewConnection = 1451
+    , WebMDNSRegister_FinishedRegisteringMDNSName = 1452
+    , WebRTCMonitor_NetworksChanged = 1453
+    , WebRTCResolver_SetResolvedAddress = 1454
+    , WebRTCResolver_ResolvedAddressError = 1455
 #if ENABLE(SHAREABLE_RESOURCE)
-    , NetworkProcessConnection_DidCacheResource = 1455
+    , NetworkProcessConnection_DidCacheResource = 1456
 #endif
-    , NetworkProcessConnection_DidFinishPingLoad = 1456
-    , NetworkProcessConnection_DidFinishPreconnection = 1457
-    , NetworkProcessConnection_SetOnLineState = 1458
-    , NetworkProcessConnection_CookieAcceptPolicyChanged = 1459
+    , NetworkProcessConnection_DidFinishPingLoad = 1457
+    , NetworkProcessConnection_DidFinishPreconnection = 1458
+    , NetworkProcessConnection_SetOnLineState = 1459
+    , NetworkProcessConnection_CookieAcceptPolicyChanged = 1460
 #if HAVE(COOKIE_CHANGE_LISTENER_API)
-    , NetworkProcessConnection_CookiesAdded = 1460
+    , NetworkProcessConnection_CookiesAdded = 1461
 #endif
 #if HAVE(COOKIE_CHANGE_LISTENER_API)
-    , NetworkProcessConnection_CookiesDeleted = 1461
+    , NetworkProcessConnection_CookiesDeleted = 1462
 #endif
 #if HAVE(COOKIE_CHANGE_LISTENER_API)
-    , NetworkProcessConnection_AllCookiesDeleted = 1462
-#endif
-    , NetworkProcessConnection_CheckProcessLocalPortForActivity = 1463
-    , NetworkProcessConnection_CheckProcessLocalPortForActivityReply = 1464
-    , NetworkProcessConnection_MessagesAvailableForPort = 1465
-    , NetworkProcessConnection_BroadcastConsoleMessage = 1466
-    , WebResourceLoader_WillSendRequest = 1467
-    , WebResourceLoader_DidSendData = 1468
-    , WebResourceLoader_DidReceiveResponse = 1469
-    , WebResourceLoader_DidReceiveData = 1470
-    , WebResourceLoader_DidReceiveSharedBuffer = 1471
-    , WebResourceLoader_DidFinishResourceLoad = 1472
-    , WebResourceLoader_DidFailResourceLoad = 1473
-    , WebResourceLoader_DidFailServiceWorkerLoad = 1474
-    , WebResourceLoader_ServiceWorkerDidNotHandle = 1475
-    , WebResourceLoader_DidBlockAuthenticationChallenge = 1476
-    , WebResourceLoader_StopLoadingAfterXFrameOptionsOrContentSecurityPolicyDenied = 1477
+    , NetworkProcessConnection_AllCookiesDeleted = 1463
+#endif
+    , NetworkProcessConnection_CheckProcessLocalPortForActivity = 1464
+    , NetworkProcessConnection_CheckProcessLocalPortForActivityReply = 1465
+    , NetworkProcessConnection_MessagesAvailableForPort = 1466
+    , NetworkProcessConnection_BroadcastConsoleMessage = 1467
+    , WebResourceLoader_WillSendRequest = 1468
+    , WebResourceLoader_DidSendData = 1469
+    , WebResourceLoader_DidReceiveResponse = 1470
+    , WebResourceLoader_DidReceiveData = 1471
+    , WebResourceLoader_DidReceiveSharedBuffer = 1472
+    , WebResourceLoader_DidReceiveSharedMemory = 1473
+    , WebResourceLoader_DidFinishResourceLoad = 1474
+    , WebResourceLoader_DidFailResourceLoad = 1475
+    , WebResourceLoader_DidFailServiceWorkerLoad = 1476
+    , WebResourceLoader_ServiceWorkerDidNotHandle = 1477
+    , WebResourceLoader_DidBlockAuthenticationChallenge = 1478
+    , WebResourceLoader_StopLoadingAfterXFrameOptionsOrContentSecurityPolicyDenied = 1479
 #if ENABLE(SHAREABLE_RESOURCE)
-    , WebResourceLoader_DidReceiveResource = 1478
-#endif
-    , WebSocketChannel_DidConnect = 1479
-    , WebSocketChannel_DidClose = 1480
-    , WebSocketChannel_DidReceiveText = 1481
-    , WebSocketChannel_DidReceiveBinaryData = 1482
-    , WebSocketChannel_DidReceiveMessageError = 1483
-    , WebSocketChannel_DidSendHandshakeRequest = 1484
-    , WebSocketChannel_DidReceiveHandshakeResponse = 1485
-    , WebSocketStream_DidOpenSocketStream = 1486
-    , WebSocketStream_DidCloseSocketStream = 1487
-    , WebSocketStream_DidReceiveSocketStreamData = 1488
-    , WebSocketStream_DidFailToReceiveSocketStreamData = 1489
-    , WebSocketStream_DidUpdateBufferedAmount = 1490
-    , WebSocketStream_DidFailSocketStream = 1491
-    , WebSocketStream_DidSendData = 1492
-    , WebSocketStream_DidSendHandshake = 1493
-    , WebNotificationManager_DidShowNotification = 1494
-    , WebNotificationManager_DidClickNotification = 1495
-    , WebNotificationManager_DidCloseNotifications = 1496
-    , WebNotificationManager_DidUpdateNotificationDecision = 1497
-    , WebNotificationManager_DidRemoveNotificationDecisions = 1498
-    , PluginProcessConnection_SetException = 1499
-    , PluginProcessConnectionManager_PluginProcessCrashed = 1500
-    , PluginProxy_LoadURL = 1501
-    , PluginProxy_Update = 1502
-    , PluginProxy_ProxiesForURL = 1503
-    , PluginProxy_CookiesForURL = 1504
-    , PluginProxy_SetCookiesForURL = 1505
-    , PluginProxy_GetAuthenticationInfo = 1506
-    , PluginProxy_GetPluginElementNPObject = 1507
-    , PluginProxy_Evaluate = 1508
-    , PluginProxy_CancelStreamLoad = 1509
-    , PluginProxy_ContinueStreamLoad = 1510
-    , PluginProxy_CancelManualStreamLoad = 1511
-    , PluginProxy_SetStatusbarText = 1512
-#if PLATFORM(COCOA)
-    , PluginProxy_PluginFocusOrWindowFocusChanged = 1513
-#endif
-#if PLATFORM(COCOA)
-    , PluginProxy_SetComplexTextInputState = 1514
-#endif
-#if PLATFORM(COCOA)
-    , PluginProxy_SetLayerHostingContextID = 1515
+    , WebResourceLoader_DidReceiveResource = 1480
+#endif
+    , WebSocketChannel_DidConnect = 1481
+    , WebSocketChannel_DidClose = 1482
+    , WebSocketChannel_DidReceiveText = 1483
+    , WebSocketChannel_DidReceiveBinaryData = 1484
+    , WebSocketChannel_DidReceiveMessageError = 1485
+    , WebSocketChannel_DidSendHandshakeRequest = 1486
+    , WebSocketChannel_DidReceiveHandshakeResponse = 1487
+    , WebSocketStream_DidOpenSocketStream = 1488
+    , WebSocketStream_DidCloseSocketStream = 1489
+    , WebSocketStream_DidReceiveSocketStreamData = 1490
+    , WebSocketStream_DidFailToReceiveSocketStreamData = 1491
+    , WebSocketStream_DidUpdateBufferedAmount = 1492
+    , WebSocketStream_DidFailSocketStream = 1493
+    , WebSocketStream_DidSendData = 1494
+    , WebSocketStream_DidSendHandshake = 1495
+    , WebNotificationManager_DidShowNotification = 1496
+    , WebNotificationManager_DidClickNotification = 1497
+    , WebNotificationManager_DidCloseNotifications = 1498
+    , WebNotificationManager_DidUpdateNotificationDecision = 1499
+    , WebNotificationManager_DidRemoveNotificationDecisions = 1500
+    , PluginProcessConnection_SetException = 1501
+    , PluginProcessConnectionManager_PluginProcessCrashed = 1502
+    , PluginProxy_LoadURL = 1503
+    , PluginProxy_Update = 1504
+    , PluginProxy_ProxiesForURL = 1505
+    , PluginProxy_CookiesForURL = 1506
+    , PluginProxy_SetCookiesForURL = 1507
+    , PluginProxy_GetAuthenticationInfo = 1508
+    , PluginProxy_GetPluginElementNPObject = 1509
+    , PluginProxy_Evaluate = 1510
+    , PluginProxy_CancelStreamLoad = 1511
+    , PluginProxy_ContinueStreamLoad = 1512
+    , PluginProxy_CancelManualStreamLoad = 1513
+    , PluginProxy_SetStatusbarText = 1514
+#if PLATFORM(COCOA)
+    , PluginProxy_PluginFocusOrWindowFocusChanged = 1515
+#endif
+#if PLATFORM(COCOA)
+    , PluginProxy_SetComplexTextInputState = 1516
+#endif
+#if PLATFORM(COCOA)
+    , PluginProxy_SetLayerHostingContextID = 1517
 #endif
 #if PLATFORM(X11)
-    , PluginProxy_CreatePluginContainer = 1516
+    , PluginProxy_CreatePluginContainer = 1518
 #endif
 #if PLATFORM(X11)
-    , PluginProxy_WindowedPluginGeometryDidChange = 1517
+    , PluginProxy_WindowedPluginGeometryDidChange = 1519
 #endif
 #if PLATFORM(X11)
-    , PluginProxy_WindowedPluginVisibilityDidChange = 1518
-#endif
-    , PluginProxy_DidCreatePlugin = 1519
-    , PluginProxy_DidFailToCreatePlugin = 1520
-    , PluginProxy_SetPluginIsPlayingAudio = 1521
-    , WebSWClientConnection_JobRejectedInServer = 1522
-    , WebSWClientConnection_RegistrationJobResolvedInServer = 1523
-    , WebSWClientConnection_StartScriptFetchForServer = 1524
-    , WebSWClientConnection_UpdateRegistrationState = 1525
-    , WebSWClientConnection_UpdateWorkerState = 1526
-    , WebSWClientConnection_FireUpdateFoundEvent = 1527
-    , WebSWClientConnection_SetRegistrationLastUpdateTime = 1528
-    , WebSWClientConnection_SetRegistrationUpdateViaCache = 1529
-    , WebSWClientConnection_NotifyClientsOfControllerChange = 1530
-    , WebSWClientConnection_SetSWOriginTableIsImported = 1531
-    , WebSWClientConnection_SetSWOriginTableSharedMemory = 1532
-    , WebSWClientConnection_PostMessageToServiceWorkerClient = 1533
-    , WebSWClientConnection_DidMatchRegistration = 1534
-    , WebSWClientConnection_DidGetRegistrations = 1535
-    , WebSWClientConnection_RegistrationReady = 1536
-    , WebSWClientConnection_SetDocumentIsControlled = 1537
-    , WebSWClientConnection_SetDocumentIsControlledReply = 1538
-    , WebSWContextManagerConnection_InstallServiceWorker = 1539
-    , WebSWContextManagerConnection_StartFetch = 1540
-    , WebSWContextManagerConnection_CancelFetch = 1541
-    , WebSWContextManagerConnection_ContinueDidReceiveFetchResponse = 1542
-    , WebSWContextManagerConnection_PostMessageToServiceWorker = 1543
-    , WebSWContextManagerConnection_FireInstallEvent = 1544
-    , WebSWContextManagerConnection_FireActivateEvent = 1545
-    , WebSWContextManagerConnection_TerminateWorker = 1546
-    , WebSWContextManagerConnection_FindClientByIdentifierCompleted = 1547
-    , WebSWContextManagerConnection_MatchAllCompleted = 1548
-    , WebSWContextManagerConnection_SetUserAgent = 1549
-    , WebSWContextManagerConnection_UpdatePreferencesStore = 1550
-    , WebSWContextManagerConnection_Close = 1551
-    , WebSWContextManagerConnection_SetThrottleState = 1552
-    , WebUserContentController_AddContentWorlds = 1553
-    , WebUserContentController_RemoveContentWorlds = 1554
-    , WebUserContentController_AddUserScripts = 1555
-    , WebUserContentController_RemoveUserScript = 1556
-    , WebUserContentController_RemoveAllUserScripts = 1557
-    , WebUserContentController_AddUserStyleSheets = 1558
-    , WebUserContentController_RemoveUserStyleSheet = 1559
-    , WebUserContentController_RemoveAllUserStyleSheets = 1560
-    , WebUserContentController_AddUserScriptMessageHandlers = 1561
-    , WebUserContentController_RemoveUserScriptMessageHandler = 1562
-    , WebUserContentController_RemoveAllUserScriptMessageHandlersForWorlds = 1563
-    , WebUserContentController_RemoveAllUserScriptMessageHandlers = 1564
+    , PluginProxy_WindowedPluginVisibilityDidChange = 1520
+#endif
+    , PluginProxy_DidCreatePlugin = 1521
+    , PluginProxy_DidFailToCreatePlugin = 1522
+    , PluginProxy_SetPluginIsPlayingAudio = 1523
+    , WebSWClientConnection_JobRejectedInServer = 1524
+    , WebSWClientConnection_RegistrationJobResolvedInServer = 1525
+    , WebSWClientConnection_StartScriptFetchForServer = 1526
+    , WebSWClientConnection_UpdateRegistrationState = 1527
+    , WebSWClientConnection_UpdateWorkerState = 1528
+    , WebSWClientConnection_FireUpdateFoundEvent = 1529
+    , WebSWClientConnection_SetRegistrationLastUpdateTime = 1530
+    , WebSWClientConnection_SetRegistrationUpdateViaCache = 1531
+    , WebSWClientConnection_NotifyClientsOfControllerChange = 1532
+    , WebSWClientConnection_SetSWOriginTableIsImported = 1533
+    , WebSWClientConnection_SetSWOriginTableSharedMemory = 1534
+    , WebSWClientConnection_PostMessageToServiceWorkerClient = 1535
+    , WebSWClientConnection_DidMatchRegistration = 1536
+    , WebSWClientConnection_DidGetRegistrations = 1537
+    , WebSWClientConnection_RegistrationReady = 1538
+    , WebSWClientConnection_SetDocumentIsControlled = 1539
+    , WebSWClientConnection_SetDocumentIsControlledReply = 1540
+    , WebSWContextManagerConnection_InstallServiceWorker = 1541
+    , WebSWContextManagerConnection_StartFetch = 1542
+    , WebSWContextManagerConnection_CancelFetch = 1543
+    , WebSWContextManagerConnection_ContinueDidReceiveFetchResponse = 1544
+    , WebSWContextManagerConnection_PostMessageToServiceWorker = 1545
+    , WebSWContextManagerConnection_FireInstallEvent = 1546
+    , WebSWContextManagerConnection_FireActivateEvent = 1547
+    , WebSWContextManagerConnection_TerminateWorker = 1548
+    , WebSWContextManagerConnection_FindClientByIdentifierCompleted = 1549
+    , WebSWContextManagerConnection_MatchAllCompleted = 1550
+    , WebSWContextManagerConnection_SetUserAgent = 1551
+    , WebSWContextManagerConnection_UpdatePreferencesStore = 1552
+    , WebSWContextManagerConnection_Close = 1553
+    , WebSWContextManagerConnection_SetThrottleState = 1554
+    , WebUserContentController_AddContentWorlds = 1555
+    , WebUserContentController_RemoveContentWorlds = 1556
+    , WebUserContentController_AddUserScripts = 1557
+    , WebUserContentController_RemoveUserScript = 1558
+    , WebUserContentController_RemoveAllUserScripts = 1559
+    , WebUserContentController_AddUserStyleSheets = 1560
+    , WebUserContentController_RemoveUserStyleSheet = 1561
+    , WebUserContentController_RemoveAllUserStyleSheets = 1562
+    , WebUserContentController_AddUserScriptMessageHandlers = 1563
+    , WebUserContentController_RemoveUserScriptMessageHandler = 1564
+    , WebUserContentController_RemoveAllUserScriptMessageHandlersForWorlds = 1565
+    , WebUserContentController_RemoveAllUserScriptMessageHandlers = 1566
 #if ENABLE(CONTENT_EXTENSIONS)
-    , WebUserContentController_AddContentRuleLists = 1565
+    , WebUserContentController_AddContentRuleLists = 1567
 #endif
 #if ENABLE(CONTENT_EXTENSIONS)
-    , WebUserContentController_RemoveContentRuleList = 1566
+    , WebUserContentController_RemoveContentRuleList = 1568
 #endif
 #if ENABLE(CONTENT_EXTENSIONS)
-    , WebUserContentController_RemoveAllContentRuleLists = 1567
+    , WebUserContentController_RemoveAllContentRuleLists = 1569
 #endif
 #if USE(COORDINATED_GRAPHICS) || USE(TEXTURE_MAPPER)
-    , DrawingArea_UpdateBackingStoreState = 1568
+    , DrawingArea_UpdateBackingStoreState = 1570
 #endif
-    , DrawingArea_DidUpdate = 1569
+    , DrawingArea_DidUpdate = 1571
 #if PLATFORM(COCOA)
-    , DrawingArea_UpdateGeometry = 1570
+    , DrawingArea_UpdateGeometry = 1572
 #endif
 #if PLATFORM(COCOA)
-    , DrawingArea_SetDeviceScaleFactor = 1571
+    , DrawingArea_SetDeviceScaleFactor = 1573
 #endif
 #if PLATFORM(COCOA)
-    , DrawingArea_SetColorSpace = 1572
+    , DrawingArea_SetColorSpace = 1574
 #endif
 #if PLATFORM(COCOA)
-    , DrawingArea_SetViewExposedRect = 1573
+    , DrawingArea_SetViewExposedRect = 1575
 #endif
 #if PLATFORM(COCOA)
-    , DrawingArea_AdjustTransientZoom = 1574
+    , DrawingArea_AdjustTransientZoom = 1576
 #endif
 #if PLATFORM(COCOA)
-    , DrawingArea_CommitTransientZoom = 1575
+    , DrawingArea_CommitTransientZoom = 1577
 #endif
 #if PLATFORM(COCOA)
-    , DrawingArea_AcceleratedAnimationDidStart = 1576
+    , DrawingArea_AcceleratedAnimationDidStart = 1578
 #endif
 #if PLATFORM(COCOA)
-    , DrawingArea_AcceleratedAnimationDidEnd = 1577
+    , DrawingArea_AcceleratedAnimationDidEnd = 1579
 #endif
 #if PLATFORM(COCOA)
-    , DrawingArea_AddTransactionCallbackID = 1578
+    , DrawingArea_AddTransactionCallbackID = 1580
 #endif
-    , EventDispatcher_WheelEvent = 1579
+    , EventDispatcher_WheelEvent = 1581
 #if ENABLE(IOS_TOUCH_EVENTS)
-    , EventDispatcher_TouchEvent = 1580
+    , EventDispatcher_TouchEvent = 1582
 #endif
 #if ENABLE(MAC_GESTURE_EVENTS)
-    , EventDispatcher_GestureEvent = 1581
+    , EventDispatcher_GestureEvent = 1583
 #endif
 #if ENABLE(WEBPROCESS_WINDOWSERVER_BLOCKING)
-    , EventDispatcher_DisplayWasRefreshed = 1582
+    , EventDispatcher_DisplayWasRefreshed = 1584
 #endif
-    , VisitedLinkTableController_SetVisitedLinkTable = 1583
-    , VisitedLinkTableController_VisitedLinkStateChanged = 1584
-    , VisitedLinkTableController_AllVisitedLinkStateChanged = 1585
-    , VisitedLinkTableController_RemoveAllVisitedLinks = 1586
-    , WebPage_SetInitialFocus = 1587
-    , WebPage_SetInitialFocusReply = 1588
-    , WebPage_SetActivityState = 1589
-    , WebPage_SetLayerHostingMode = 1590
-    , WebPage_SetBackgroundColor = 1591
-    , WebPage_AddConsoleMessage = 1592
-    , WebPage_SendCSPViolationReport = 1593
-    , WebPage_EnqueueSecurityPolicyViolationEvent = 1594
-    , WebPage_TestProcessIncomingSyncMessagesWhenWaitingForSyncReply = 1595
+    , VisitedLinkTableController_SetVisitedLinkTable = 1585
+    , VisitedLinkTableController_VisitedLinkStateChanged = 1586
+    , VisitedLinkTableController_AllVisitedLinkStateChanged = 1587
+    , VisitedLinkTableController_RemoveAllVisitedLinks = 1588
+    , WebPage_SetInitialFocus = 1589
+    , WebPage_SetInitialFocusReply = 1590
+    , WebPage_SetActivityState = 1591
+    , WebPage_SetLayerHostingMode = 1592
+    , WebPage_SetBackgroundColor = 1593
+    , WebPage_AddConsoleMessage = 1594
+    , WebPage_SendCSPViolationReport = 1595
+    , WebPage_EnqueueSecurityPolicyViolationEvent = 1596
+    , WebPage_TestProcessIncomingSyncMessagesWhenWaitingForSyncReply = 1597
 #if PLATFORM(COCOA)
-    , WebPage_SetTopContentInsetFenced = 1596
+    , WebPage_SetTopContentInsetFenced = 1598
 #endif
-    , WebPage_SetTopContentInset = 1597
-    , WebPage_SetUnderlayColor = 1598
-    , WebPage_ViewWillStartLiveResize = 1599
-    , WebPage_ViewWillEndLiveResize = 1600
-    , WebPage_ExecuteEditCommandWithCallback = 1601
-    , WebPage_ExecuteEditCommandWithCallbackReply = 1602
-    , WebPage_KeyEvent = 1603
-    , WebPage_MouseEvent = 1604
+    , WebPage_SetTopContentInset = 1599
+    , WebPage_SetUnderlayColor = 1600
+    , WebPage_ViewWillStartLiveResize = 1601
+    , WebPage_ViewWillEndLiveResize = 1602
+    , WebPage_ExecuteEditCommandWithCallback = 1603
+    , WebPage_ExecuteEditCommandWithCallbackReply = 1604
+    , WebPage_KeyEvent = 1605
+    , WebPage_MouseEvent = 1606
 #if PLATFORM(IOS_FAMILY)
-    , WebPage_SetViewportConfigurationViewLayoutSize = 1605
+    , WebPage_SetViewportConfigurationViewLayoutSize = 1607
 #endif
 #if PLATFORM(IOS_FAMILY)
-    , WebPage_SetMaximumUnobscuredSize = 1606
+    , WebPage_SetMaximumUnobscuredSize = 1608
 #endif
 #if PLATFORM(IOS_FAMILY)
-    , WebPage_SetDeviceOrientation = 1607
+    , WebPage_SetDeviceOrientation = 1609
 #endif
 #if PLATFORM(IOS_FAMILY)
-    , WebPage_SetOverrideViewportArguments = 1608
+    , WebPage_SetOverrideViewportArguments = 1610
 #endif
 #if PLATFORM(IOS_FAMILY)
-    , WebPage_DynamicViewportSizeUpdate = 1609
+    , WebPage_DynamicViewportSizeUpdate = 1611
 #endif
 #if PLATFORM(IOS_FAMILY)
-    , WebPage_SetScreenIsBeingCaptured = 1610
+    , WebPage_SetScreenIsBeingCaptured = 1612
 #endif
 #if PLATFORM(IOS_FAMILY)
-    , WebPage_HandleTap = 1611
+    , WebPage_HandleTap = 1613
 #endif
 #if PLATFORM(IOS_FAMILY)
-    , WebPage_PotentialTapAtPosition = 1612
+    , WebPage_PotentialTapAtPosition = 1614
 #endif
 #if PLATFORM(IOS_FAMILY)
-    , WebPage_CommitPotentialTap = 1613
+    , WebPage_CommitPotentialTap = 1615
 #endif
 #if PLATFORM(IOS_FAMILY)
-    , WebPage_CancelPotentialTap = 1614
+    , WebPage_CancelPotentialTap = 1616
 #endif
 #if PLATFORM(IOS_FAMILY)
-    , WebPage_TapHighlightAtPosition = 1615
+    , WebPage_TapHighlightAtPosition = 1617
 #endif
 #if PLATFORM(IOS_FAMILY)
-    , WebPage_DidRecognizeLongPress = 1616
+    , WebPage_DidRecognizeLongPress = 1618
 #endif
 #if PLATFORM(IOS_FAMILY)
-    , WebPage_HandleDoubleTapForDoubleClickAtPoint = 1617
+    , WebPage_HandleDoubleTapForDoubleClickAtPoint = 1619
 #endif
 #if PLATFORM(IOS_FAMILY)
-    , WebPage_InspectorNodeSearchMovedToPosition = 1618
+    , WebPage_InspectorNodeSearchMovedToPosition = 1620
 #endif
 #if PLATFORM(IOS_FAMILY)
-    , WebPage_InspectorNodeSearchEndedAtPosition = 1619
+    , WebPage_InspectorNodeSearchEndedAtPosition = 1621
 #endif
 #if PLATFORM(IOS_FAMILY)
-    , WebPage_BlurFocusedElement = 1620
+    , WebPage_BlurFocusedElement = 1622
 #endif
 #if PLATFORM(IOS_FAMILY)
-    , WebPage_SelectWithGesture = 1621
+    , WebPage_SelectWithGesture = 1623
 #endif
 #if PLATFORM(IOS_FAMILY)
-    , WebPage_UpdateSelectionWithTouches = 1622
+    , WebPage_UpdateSelectionWithTouches = 1624
 #endif
 #if PLATFORM(IOS_FAMILY)
-    , WebPage_SelectWithTwoTouches = 1623
+    , WebPage_SelectWithTwoTouches = 1625
 #endif
 #if PLATFORM(IOS_FAMILY)
-    , WebPage_ExtendSelection = 1624
+    , WebPage_ExtendSelection = 1626
 #endif
 #if PLATFORM(IOS_FAMILY)
-    , WebPage_SelectWordBackward = 1625
+    , WebPage_SelectWordBackward = 1627
 #endif
 #if PLATFORM(IOS_FAMILY)
-    , WebPage_MoveSelectionByOffset = 1626
-    , WebPage_MoveSelectionByOffsetReply = 1627
+    , WebPage_MoveSelectionByOffset = 1628
+    , WebPage_MoveSelectionByOffsetReply = 1629
 #endif
 #if PLATFORM(IOS_FAMILY)
-    , WebPage_SelectTextWithGranularityAtPoint = 1628
-    , WebPage_SelectTextWithGranularityAtPointReply = 1629
+    , WebPage_SelectTextWithGranularityAtPoint = 1630
+    , WebPage_SelectTextWithGranularityAtPointReply = 1631
 #endif
 #if PLATFORM(IOS_FAMILY)
-    , WebPage_SelectPositionAtBoundaryWithDirection = 1630
-    , WebPage_SelectPositionAtBoundaryWithDirectionReply = 1631
+    , WebPage_SelectPositionAtBoundaryWithDirection = 1632
+    , WebPage_SelectPositionAtBoundaryWithDirectionReply = 1633
 #endif
 #if PLATFORM(IOS_FAMILY)
-    , WebPage_MoveSelectionAtBoundaryWithDirection = 1632
-    , WebPage_MoveSelectionAtBoundaryWithDirectionReply = 1633
+    , WebPage_MoveSelectionAtBoundaryWithDirection = 1634
+    , WebPage_MoveSelectionAtBoundaryWithDirectionReply = 1635
 #endif
 #if PLATFORM(IOS_FAMILY)
-    , WebPage_SelectPositionAtPoint = 1634
-    , WebPage_SelectPositionAtPointReply = 1635
+    , WebPage_SelectPositionAtPoint = 1636
+    , WebPage_SelectPositionAtPointReply = 1637
 #endif
 #if PLATFORM(IOS_FAMILY)
-    , WebPage_BeginSelectionInDirection = 1636
+    , WebPage_BeginSelectionInDirection = 1638
 #endif
 #if PLATFORM(IOS_FAMILY)
-    , WebPage_UpdateSelectionWithExtentPoint = 1637
+    , WebPage_UpdateSelectionWithExtentPoint = 1639
 #endif
 #if PLATFORM(IOS_FAMILY)
-    , WebPage_UpdateSelectionWithExtentPointAndBoundary = 1638
+    , WebPage_UpdateSelectionWithExtentPointAndBoundary = 1640
 #endif
 #if PLATFORM(IOS_FAMILY)
-    , WebPage_RequestDictationContext = 1639
+    , WebPage_RequestDictationContext = 1641
 #endif
 #if PLATFORM(IOS_FAMILY)
-    , WebPage_ReplaceDictatedText = 1640
+    , WebPage_ReplaceDictatedText = 1642
 #endif
 #if PLATFORM(IOS_FAMILY)
-    , WebPage_ReplaceSelectedText = 1641
+    , WebPage_ReplaceSelectedText = 1643
 #endif
 #if PLATFORM(IOS_FAMILY)
-    , WebPage_RequestAutocorrectionData = 1642
-    , WebPage_RequestAutocorrectionDataReply = 1643
+    , WebPage_RequestAutocorrectionData = 1644
+    , WebPage_RequestAutocorrectionDataReply = 1645
 #endif
 #if PLATFORM(IOS_FAMILY)
-    , WebPage_ApplyAutocorrection = 1644
+    , WebPage_ApplyAutocorrection = 1646
 #endif
 #if PLATFORM(IOS_FAMILY)
-    , WebPage_SyncApplyAutocorrection = 1645
+    , WebPage_SyncApplyAutocorrection = 1647
 #endif
 #if PLATFORM(IOS_FAMILY)
-    , WebPage_RequestAutocorrectionContext = 1646
+    , WebPage_RequestAutocorrectionContext = 1648
 #endif
 #if PLATFORM(IOS_FAMILY)
-    , WebPage_RequestEvasionRectsAboveSelection = 1647
-    , WebPage_RequestEvasionRectsAboveSelectionReply = 1648
+    , WebPage_RequestEvasionRectsAboveSelection = 1649
+    , WebPage_RequestEvasionRectsAboveSelectionReply = 1650
 #endif
 #if PLATFORM(IOS_FAMILY)
-    , WebPage_GetPositionInformation = 1649
+    , WebPage_GetPositionInformation = 1651
 #endif
 #if PLATFORM(IOS_FAMILY)
-    , WebPage_RequestPositionInformation = 1650
+    , WebPage_RequestPositionInformation = 1652
 #endif
 #if PLATFORM(IOS_FAMILY)
-    , WebPage_StartInteractionWithElementContextOrPosition = 1651
+    , WebPage_StartInteractionWithElementContextOrPosition = 1653
 #endif
 #if PLATFORM(IOS_FAMILY)
-    , WebPage_StopInteraction = 1652
+    , WebPage_StopInteraction = 1654
 #endif
 #if PLATFORM(IOS_FAMILY)
-    , WebPage_PerformActionOnElement = 1653
+    , WebPage_PerformActionOnElement = 1655
 #endif
 #if PLATFORM(IOS_FAMILY)
-    , WebPage_FocusNextFocusedElement = 1654
-    , WebPage_FocusNextFocusedElementReply = 1655
+    , WebPage_FocusNextFocusedElement = 1656
+    , WebPage_FocusNextFocusedElementReply = 1657
 #endif
 #if PLATFORM(IOS_FAMILY)
-    , WebPage_SetFocusedElementValue = 1656
+    , WebPage_SetFocusedElementValue = 1658
 #endif
 #if PLATFORM(IOS_FAMILY)
-    , WebPage_AutofillLoginCredentials = 1657
+    , WebPage_AutofillLoginCredentials = 1659
 #endif
 #if PLATFORM(IOS_FAMILY)
-    , WebPage_SetFocusedElementValueAsNumber = 1658
+    , WebPage_SetFocusedElementValueAsNumber = 1660
 #endif
 #if PLATFORM(IOS_FAMILY)
-    , WebPage_SetFocusedElementSelectedIndex = 1659
+    , WebPage_SetFocusedElementSelectedIndex = 1661
 #endif
 #if PLATFORM(IOS_FAMILY)
-    , WebPage_ApplicationWillResignActive = 1660
+    , WebPage_ApplicationWillResignActive = 1662
 #endif
 #if PLATFORM(IOS_FAMILY)
-    , WebPage_ApplicationDidEnterBackground = 1661
+    , WebPage_ApplicationDidEnterBackground = 1663
 #endif
 #if PLATFORM(IOS_FAMILY)
-    , WebPage_ApplicationDidFinishSnapshottingAfterEnteringBackground = 1662
+    , WebPage_ApplicationDidFinishSnapshottingAfterEnteringBackground = 1664
 #endif
 #if PLATFORM(IOS_FAMILY)
-    , WebPage_ApplicationWillEnterForeground = 1663
+    , WebPage_ApplicationWillEnterForeground = 1665
 #endif
 #if PLATFORM(IOS_FAMILY)
-    , WebPage_ApplicationDidBecomeActive = 1664
+    , WebPage_ApplicationDidBecomeActive = 1666
 #endif
 #if PLATFORM(IOS_FAMILY)
-    , WebPage_ApplicationDidEnterBackgroundForMedia = 1665
+    , WebPage_ApplicationDidEnterBackgroundForMedia = 1667
 #endif
 #if PLATFORM(IOS_FAMILY)
-    , WebPage_ApplicationWillEnterForegroundForMedia = 1666
+    , WebPage_ApplicationWillEnterForegroundForMedia = 1668
 #endif
 #if PLATFORM(IOS_FAMILY)
-    , WebPage_ContentSizeCategoryDidChange = 1667
+    , WebPage_ContentSizeCategoryDidChange = 1669
 #endif
 #if PLATFORM(IOS_FAMILY)
-    , WebPage_GetSelectionContext = 1668
+    , WebPage_GetSelectionContext = 1670
 #endif
 #if PLATFORM(IOS_FAMILY)
-    , WebPage_SetAllowsMediaDocumentInlinePlayback = 1669
+    , WebPage_SetAllowsMediaDocumentInlinePlayback = 1671
 #endif
 #if PLATFORM(IOS_FAMILY)
-    , WebPage_HandleTwoFingerTapAtPoint = 1670
+    , WebPage_HandleTwoFingerTapAtPoint = 1672
 #endif
 #if PLATFORM(IOS_FAMILY)
-    , WebPage_HandleStylusSingleTapAtPoint = 1671
+    , WebPage_HandleStylusSingleTapAtPoint = 1673
 #endif
 #if PLATFORM(IOS_FAMILY)
-    , WebPage_SetForceAlwaysUserScalable = 1672
+    , WebPage_SetForceAlwaysUserScalable = 1674
 #endif
 #if PLATFORM(IOS_FAMILY)
-    , WebPage_GetRectsForGranularityWithSelectionOffset = 1673
+    , WebPage_GetRectsForGranularityWithSelectionOffset = 1675
 #endif
 #if PLATFORM(IOS_FAMILY)
-    , WebPage_GetRectsAtSelectionOffsetWithText = 1674
+    , WebPage_GetRectsAtSelectionOffsetWithText = 1676
 #endif
 #if PLATFORM(IOS_FAMILY)
-    , WebPage_StoreSelectionForAccessibility = 1675
+    , WebPage_StoreSelectionForAccessibility = 1677
 #endif
 #if PLATFORM(IOS_FAMILY)
-    , WebPage_StartAutoscrollAtPosition = 1676
+    , WebPage_StartAutoscrollAtPosition = 1678
 #endif
 #if PLATFORM(IOS_FAMILY)
-    , WebPage_CancelAutoscroll = 1677
+    , WebPage_CancelAutoscroll = 1679
 #endif
 #if PLATFORM(IOS_FAMILY)
-    , WebPage_RequestFocusedElementInformation = 1678
+    , WebPage_RequestFocusedElementInformation = 1680
 #endif
 #if PLATFORM(IOS_FAMILY)
-    , WebPage_HardwareKeyboardAvailabilityChanged = 1679
+    , WebPage_HardwareKeyboardAvailabilityChanged = 1681
 #endif
 #if PLATFORM(IOS_FAMILY)
-    , WebPage_SetIsShowingInputViewForFocusedElement = 1680
+    , WebPage_SetIsShowingInputViewForFocusedElement = 1682
 #endif
 #if PLATFORM(IOS_FAMILY)
-    , WebPage_UpdateSelectionWithDelta = 1681
-    , WebPage_UpdateSelectionWithDeltaReply = 1682
+    , WebPage_UpdateSelectionWithDelta = 1683
+    , WebPage_UpdateSelectionWithDeltaReply = 1684
 #endif
 #if PLATFORM(IOS_FAMILY)
-    , WebPage_RequestDocumentEditingContext = 1683
-    , WebPage_RequestDocumentEditingContextReply = 1684
+    , WebPage_RequestDocumentEditingContext = 1685
+    , WebPage_RequestDocumentEditingContextReply = 1686
 #endif
 #if PLATFORM(IOS_FAMILY)
-    , WebPage_GenerateSyntheticEditingCommand = 1685
+    , WebPage_GenerateSyntheticEditingCommand = 1687
 #endif
 #if PLATFORM(IOS_FAMILY)
-    , WebPage_SetShouldRevealCurrentSelectionAfterInsertion = 1686
+    , WebPage_SetShouldRevealCurrentSelectionAfterInsertion = 1688
 #endif
 #if PLATFORM(IOS_FAMILY)
-    , WebPage_InsertTextPlaceholder = 1687
-    , WebPage_InsertTextPlaceholderReply = 1688
+    , WebPage_InsertTextPlaceholder = 1689
+    , WebPage_InsertTextPlaceholderReply = 1690
 #endif
 #if PLATFORM(IOS_FAMILY)
-    , WebPage_RemoveTextPlaceholder = 1689
-    , WebPage_RemoveTextPlaceholderReply = 1690
+    , WebPage_RemoveTextPlaceholder = 1691
+    , WebPage_RemoveTextPlaceholderReply = 1692
 #endif
 #if PLATFORM(IOS_FAMILY)
-    , WebPage_TextInputContextsInRect = 1691
-    , WebPage_TextInputContextsInRectReply = 1692
+    , WebPage_TextInputContextsInRect = 1693
+    , WebPage_TextInputContextsInRectReply = 1694
 #endif
 #if PLATFORM(IOS_FAMILY)
-    , WebPage_FocusTextInputContextAndPlaceCaret = 1693
-    , WebPage_FocusTextInputContextAndPlaceCaretReply = 1694
+    , WebPage_FocusTextInputContextAndPlaceCaret = 1695
+    , WebPage_FocusTextInputContextAndPlaceCaretReply = 1696
 #endif
 #if PLATFORM(IOS_FAMILY)
-    , WebPage_ClearServiceWorkerEntitlementOverride = 1695
-    , WebPage_ClearServiceWorkerEntitlementOverrideReply = 1696
+    , WebPage_ClearServiceWorkerEntitlementOverride = 1697
+    , WebPage_ClearServiceWorkerEntitlementOverrideReply = 1698
 #endif
-    , WebPage_SetControlledByAutomation = 1697
-    , WebPage_ConnectInspector = 1698
-    , WebPage_DisconnectInspector = 1699
-    , WebPage_SendMessageToTargetBackend = 1700
+    , WebPage_SetControlledByAutomation = 1699
+    , WebPage_ConnectInspector = 1700
+    , WebPage_DisconnectInspector = 1701
+    , WebPage_SendMessageToTargetBackend = 1702
 #if ENABLE(REMOTE_INSPECTOR)
-    , WebPage_SetIndicating = 1701
+    , WebPage_SetIndicating = 1703
 #endif
 #if ENABLE(IOS_TOUCH_EVENTS)
-    , WebPage_ResetPotentialTapSecurityOrigin = 1702
+    , WebPage_ResetPotentialTapSecurityOrigin = 1704
 #endif
 #if ENABLE(IOS_TOUCH_EVENTS)
-    , WebPage_TouchEventSync = 1703
+    , WebPage_TouchEventSync = 1705
 #endif
 #if !ENABLE(IOS_TOUCH_EVENTS) && ENABLE(TOUCH_EVENTS)
-    , WebPage_TouchEvent = 1704
+    , WebPage_TouchEvent = 1706
 #endif
-    , WebPage_CancelPointer = 1705
-    , WebPage_TouchWithIdentifierWasRemoved = 1706
+    , WebPage_CancelPointer = 1707
+    , WebPage_TouchWithIdentifierWasRemoved = 1708
 #if ENABLE(INPUT_TYPE_COLOR)
-    , WebPage_DidEndColorPicker = 1707
+    , WebPage_DidEndColorPicker = 1709
 #endif
 #if ENABLE(INPUT_TYPE_COLOR)
-    , WebPage_DidChooseColor = 1708
+    , WebPage_DidChooseColor = 1710
 #endif
 #if ENABLE(DATALIST_ELEMENT)
-    , WebPage_DidSelectDataListOption = 1709
+    , WebPage_DidSelectDataListOption = 1711
 #endif
 #if ENABLE(DATALIST_ELEMENT)
-    , WebPage_DidCloseSuggestions = 1710
+    , WebPage_DidCloseSuggestions = 1712
 #endif
 #if ENABLE(CONTEXT_MENUS)
-    , WebPage_ContextMenuHidden = 1711
+    , WebPage_ContextMenuHidden = 1713
 #endif
 #if ENABLE(CONTEXT_MENUS)
-    , WebPage_ContextMenuForKeyEvent = 1712
-#endif
-    , WebPage_ScrollBy = 1713
-    , WebPage_CenterSelectionInVisibleArea = 1714
-    , WebPage_GoToBackForwardItem = 1715
-    , WebPage_TryRestoreScrollPosition = 1716
-    , WebPage_LoadURLInFrame = 1717
-    , WebPage_LoadDataInFrame = 1718
-    , WebPage_LoadRequest = 1719
-    , WebPage_LoadRequestWaitingForProcessLaunch = 1720
-    , WebPage_LoadData = 1721
-    , WebPage_LoadAlternateHTML = 1722
-    , WebPage_NavigateToPDFLinkWithSimulatedClick = 1723
-    , WebPage_Reload = 1724
-    , WebPage_StopLoading = 1725
-    , WebPage_StopLoadingFrame = 1726
-    , WebPage_RestoreSession = 1727
-    , WebPage_UpdateBackForwardListForReattach = 1728
-    , WebPage_SetCurrentHistoryItemForReattach = 1729
-    , WebPage_DidRemoveBackForwardItem = 1730
-    , WebPage_UpdateWebsitePolicies = 1731
-    , WebPage_NotifyUserScripts = 1732
-    , WebPage_DidReceivePolicyDecision = 1733
-    , WebPage_ContinueWillSubmitForm = 1734
-    , WebPage_ClearSelection = 1735
-    , WebPage_RestoreSelectionInFocusedEditableElement = 1736
-    , WebPage_GetContentsAsString = 1737
-    , WebPage_GetAllFrames = 1738
-    , WebPage_GetAllFramesReply = 1739
-#if PLATFORM(COCOA)
-    , WebPage_GetContentsAsAttributedString = 1740
-    , WebPage_GetContentsAsAttributedStringReply = 1741
+    , WebPage_ContextMenuForKeyEvent = 1714
+#endif
+    , WebPage_ScrollBy = 1715
+    , WebPage_CenterSelectionInVisibleArea = 1716
+    , WebPage_GoToBackForwardItem = 1717
+    , WebPage_TryRestoreScrollPosition = 1718
+    , WebPage_LoadURLInFrame = 1719
+    , WebPage_LoadDataInFrame = 1720
+    , WebPage_LoadRequest = 1721
+    , WebPage_LoadRequestWaitingForProcessLaunch = 1722
+    , WebPage_LoadData = 1723
+    , WebPage_LoadAlternateHTML = 1724
+    , WebPage_NavigateToPDFLinkWithSimulatedClick = 1725
+    , WebPage_Reload = 1726
+    , WebPage_StopLoading = 1727
+    , WebPage_StopLoadingFrame = 1728
+    , WebPage_RestoreSession = 1729
+    , WebPage_UpdateBackForwardListForReattach = 1730
+    , WebPage_SetCurrentHistoryItemForReattach = 1731
+    , WebPage_DidRemoveBackForwardItem = 1732
+    , WebPage_UpdateWebsitePolicies = 1733
+    , WebPage_NotifyUserScripts = 1734
+    , WebPage_DidReceivePolicyDecision = 1735
+    , WebPage_ContinueWillSubmitForm = 1736
+    , WebPage_ClearSelection = 1737
+    , WebPage_RestoreSelectionInFocusedEditableElement = 1738
+    , WebPage_GetContentsAsString = 1739
+    , WebPage_GetAllFrames = 1740
+    , WebPage_GetAllFramesReply = 1741
+#if PLATFORM(COCOA)
+    , WebPage_GetContentsAsAttributedString = 1742
+    , WebPage_GetContentsAsAttributedStringReply = 1743
 #endif
 #if ENABLE(MHTML)
-    , WebPage_GetContentsAsMHTMLData = 1742
+    , WebPage_GetContentsAsMHTMLData = 1744
 #endif
-    , WebPage_GetMainResourceDataOfFrame = 1743
-    , WebPage_GetResourceDataFromFrame = 1744
-    , WebPage_GetRenderTreeExternalRepresentation = 1745
-    , WebPage_GetSelectionOrContentsAsString = 1746
-    , WebPage_GetSelectionAsWebArchiveData = 1747
-    , WebPage_GetSourceForFrame = 1748
-    , WebPage_GetWebArchiveOfFrame = 1749
-    , WebPage_RunJavaScriptInFrameInScriptWorld = 1750
-    , WebPage_ForceRepaint = 1751
-    , WebPage_SelectAll = 1752
-    , WebPage_ScheduleFullEditorStateUpdate = 1753
+    , WebPage_GetMainResourceDataOfFrame = 1745
+    , WebPage_GetResourceDataFromFrame = 1746
+    , WebPage_GetRenderTreeExternalRepresentation = 1747
+    , WebPage_GetSelectionOrContentsAsString = 1748
+    , WebPage_GetSelectionAsWebArchiveData = 1749
+    , WebPage_GetSourceForFrame = 1750
+    , WebPage_GetWebArchiveOfFrame = 1751
+    , WebPage_RunJavaScriptInFrameInScriptWorld = 1752
+    , WebPage_ForceRepaint = 1753
+    , WebPage_SelectAll = 1754
+    , WebPage_ScheduleFullEditorStateUpdate = 1755
 #if PLATFORM(COCOA)
-    , WebPage_PerformDictionaryLookupOfCurrentSelection = 1754
+    , WebPage_PerformDictionaryLookupOfCurrentSelection = 1756
 #endif
 #if PLATFORM(COCOA)
-    , WebPage_PerformDictionaryLookupAtLocation = 1755
+    , WebPage_PerformDictionaryLookupAtLocation = 1757
 #endif
 #if ENABLE(DATA_DETECTION)
-    , WebPage_DetectDataInAllFrames = 1756
-    , WebPage_DetectDataInAllFramesReply = 1757
+    , WebPage_DetectDataInAllFrames = 1758
+    , WebPage_DetectDataInAllFramesReply = 1759
 #endif
 #if ENABLE(DATA_DETECTION)
-    , WebPage_RemoveDataDetectedLinks = 1758
-    , WebPage_RemoveDataDetectedLinksReply = 1759
-#endif
-    , WebPage_ChangeFont = 1760
-    , WebPage_ChangeFontAttributes = 1761
-    , WebPage_PreferencesDidChange = 1762
-    , WebPage_SetUserAgent = 1763
-    , WebPage_SetCustomTextEncodingName = 1764
-    , WebPage_SuspendActiveDOMObjectsAndAnimations = 1765
-    , WebPage_ResumeActiveDOMObjectsAndAnimations = 1766
-    , WebPage_Close = 1767
-    , WebPage_TryClose = 1768
-    , WebPage_TryCloseReply = 1769
-    , WebPage_SetEditable = 1770
-    , WebPage_ValidateCommand = 1771
-    , WebPage_ExecuteEditCommand = 1772
-    , WebPage_IncreaseListLevel = 1773
-    , WebPage_DecreaseListLevel = 1774
-    , WebPage_ChangeListType = 1775
-    , WebPage_SetBaseWritingDirection = 1776
-    , WebPage_SetNeedsFontAttributes = 1777
-    , WebPage_RequestFontAttributesAtSelectionStart = 1778
-    , WebPage_DidRemoveEditCommand = 1779
-    , WebPage_ReapplyEditCommand = 1780
-    , WebPage_UnapplyEditCommand = 1781
-    , WebPage_SetPageAndTextZoomFactors = 1782
-    , WebPage_SetPageZoomFactor = 1783
-    , WebPage_SetTextZoomFactor = 1784
-    , WebPage_WindowScreenDidChange = 1785
-    , WebPage_AccessibilitySettingsDidChange = 1786
-    , WebPage_ScalePage = 1787
-    , WebPage_ScalePageInViewCoordinates = 1788
-    , WebPage_ScaleView = 1789
-    , WebPage_SetUseFixedLayout = 1790
-    , WebPage_SetFixedLayoutSize = 1791
-    , WebPage_ListenForLayoutMilestones = 1792
-    , WebPage_SetSuppressScrollbarAnimations = 1793
-    , WebPage_SetEnableVerticalRubberBanding = 1794
-    , WebPage_SetEnableHorizontalRubberBanding = 1795
-    , WebPage_SetBackgroundExtendsBeyondPage = 1796
-    , WebPage_SetPaginationMode = 1797
-    , WebPage_SetPaginationBehavesLikeColumns = 1798
-    , WebPage_SetPageLength = 1799
-    , WebPage_SetGapBetweenPages = 1800
-    , WebPage_SetPaginationLineGridEnabled = 1801
-    , WebPage_PostInjectedBundleMessage = 1802
-    , WebPage_FindString = 1803
-    , WebPage_FindStringMatches = 1804
-    , WebPage_GetImageForFindMatch = 1805
-    , WebPage_SelectFindMatch = 1806
-    , WebPage_IndicateFindMatch = 1807
-    , WebPage_HideFindUI = 1808
-    , WebPage_CountStringMatches = 1809
-    , WebPage_ReplaceMatches = 1810
-    , WebPage_AddMIMETypeWithCustomContentProvider = 1811
+    , WebPage_RemoveDataDetectedLinks = 1760
+    , WebPage_RemoveDataDetectedLinksReply = 1761
+#endif
+    , WebPage_ChangeFont = 1762
+    , WebPage_ChangeFontAttributes = 1763
+    , WebPage_PreferencesDidChange = 1764
+    , WebPage_SetUserAgent = 1765
+    , WebPage_SetCustomTextEncodingName = 1766
+    , WebPage_SuspendActiveDOMObjectsAndAnimations = 1767
+    , WebPage_ResumeActiveDOMObjectsAndAnimations = 1768
+    , WebPage_Close = 1769
+    , WebPage_TryClose = 1770
+    , WebPage_TryCloseReply = 1771
+    , WebPage_SetEditable = 1772
+    , WebPage_ValidateCommand = 1773
+    , WebPage_ExecuteEditCommand = 1774
+    , WebPage_IncreaseListLevel = 1775
+    , WebPage_DecreaseListLevel = 1776
+    , WebPage_ChangeListType = 1777
+    , WebPage_SetBaseWritingDirection = 1778
+    , WebPage_SetNeedsFontAttributes = 1779
+    , WebPage_RequestFontAttributesAtSelectionStart = 1780
+    , WebPage_DidRemoveEditCommand = 1781
+    , WebPage_ReapplyEditCommand = 1782
+    , WebPage_UnapplyEditCommand = 1783
+    , WebPage_SetPageAndTextZoomFactors = 1784
+    , WebPage_SetPageZoomFactor = 1785
+    , WebPage_SetTextZoomFactor = 1786
+    , WebPage_WindowScreenDidChange = 1787
+    , WebPage_AccessibilitySettingsDidChange = 1788
+    , WebPage_ScalePage = 1789
+    , WebPage_ScalePageInViewCoordinates = 1790
+    , WebPage_ScaleView = 1791
+    , WebPage_SetUseFixedLayout = 1792
+    , WebPage_SetFixedLayoutSize = 1793
+    , WebPage_ListenForLayoutMilestones = 1794
+    , WebPage_SetSuppressScrollbarAnimations = 1795
+    , WebPage_SetEnableVerticalRubberBanding = 1796
+    , WebPage_SetEnableHorizontalRubberBanding = 1797
+    , WebPage_SetBackgroundExtendsBeyondPage = 1798
+    , WebPage_SetPaginationMode = 1799
+    , WebPage_SetPaginationBehavesLikeColumns = 1800
+    , WebPage_SetPageLength = 1801
+    , WebPage_SetGapBetweenPages = 1802
+    , WebPage_SetPaginationLineGridEnabled = 1803
+    , WebPage_PostInjectedBundleMessage = 1804
+    , WebPage_FindString = 1805
+    , WebPage_FindStringMatches = 1806
+    , WebPage_GetImageForFindMatch = 1807
+    , WebPage_SelectFindMatch = 1808
+    , WebPage_IndicateFindMatch = 1809
+    , WebPage_HideFindUI = 1810
+    , WebPage_CountStringMatches = 1811
+    , WebPage_ReplaceMatches = 1812
+    , WebPage_AddMIMETypeWithCustomContentProvider = 1813
 #if (PLATFORM(GTK) || PLATFORM(HBD)) && ENABLE(DRAG_SUPPORT)
-    , WebPage_PerformDragControllerAction = 1812
+    , WebPage_PerformDragControllerAction = 1814
 #endif
 #if !PLATFORM(GTK) && !PLATFORM(HBD) && ENABLE(DRAG_SUPPORT)
-    , WebPage_PerformDragControllerAction = 1813
+    , WebPage_PerformDragControllerAction = 1815
 #endif
 #if ENABLE(DRAG_SUPPORT)
-    , WebPage_DidStartDrag = 1814
+    , WebPage_DidStartDrag = 1816
 #endif
 #if ENABLE(DRAG_SUPPORT)
-    , WebPage_DragEnded = 1815
+    , WebPage_DragEnded = 1817
 #endif
 #if ENABLE(DRAG_SUPPORT)
-    , WebPage_DragCancelled = 1816
+    , WebPage_DragCancelled = 1818
 #endif
 #if PLATFORM(IOS_FAMILY) && ENABLE(DRAG_SUPPORT)
-    , WebPage_RequestDragStart = 1817
+    , WebPage_RequestDragStart = 1819
 #endif
 #if PLATFORM(IOS_FAMILY) && ENABLE(DRAG_SUPPORT)
-    , WebPage_RequestAdditionalItemsForDragSession = 1818
+    , WebPage_RequestAdditionalItemsForDragSession = 1820
 #endif
 #if PLATFORM(IOS_FAMILY) && ENABLE(DRAG_SUPPORT)
-    , WebPage_InsertDroppedImagePlaceholders = 1819
-    , WebPage_InsertDroppedImagePlaceholdersReply = 1820
+    , WebPage_InsertDroppedImagePlaceholders = 1821
+    , WebPage_InsertDroppedImagePlaceholdersReply = 1822
 #endif
 #if PLATFORM(IOS_FAMILY) && ENABLE(DRAG_SUPPORT)
-    , WebPage_DidConcludeDrop = 1821
+    , WebPage_DidConcludeDrop = 1823
 #endif
-    , WebPage_DidChangeSelectedIndexForActivePopupMenu = 1822
-    , WebPage_SetTextForActivePopupMenu = 1823
+    , WebPage_DidChangeSelectedIndexForActivePopupMenu = 1824
+    , WebPage_SetTextForActivePopupMenu = 1825
 #if PLATFORM(GTK) || PLATFORM(HBD)
-    , WebPage_FailedToShowPopupMenu = 1824
+    , WebPage_FailedToShowPopupMenu = 1826
 #endif
 #if ENABLE(CONTEXT_MENUS)
-    , WebPage_DidSelectItemFromActiveContextMenu = 1825
+    , WebPage_DidSelectItemFromActiveContextMenu = 1827
 #endif
 #if PLATFORM(IOS_FAMILY)
-    , WebPage_DidChooseFilesForOpenPanelWithDisplayStringAndIcon = 1826
+    , WebPage_DidChooseFilesForOpenPanelWithDisplayStringAndIcon = 1828
 #endif
-    , WebPage_DidChooseFilesForOpenPanel = 1827
-    , WebPage_DidCancelForOpenPanel = 1828
+    , WebPage_DidChooseFilesForOpenPanel = 1829
+    , WebPage_DidCancelForOpenPanel = 1830
 #if ENABLE(SANDBOX_EXTENSIONS)
-    , WebPage_ExtendSandboxForFilesFromOpenPanel = 1829
+    , WebPage_ExtendSandboxForFilesFromOpenPanel = 1831
 #endif
-    , WebPage_AdvanceToNextMisspelling = 1830
-    , WebPage_ChangeSpellingToWord = 1831
-    , WebPage_DidFinishCheckingText = 1832
-    , WebPage_DidCancelCheckingText = 1833
+    , WebPage_AdvanceToNextMisspelling = 1832
+    , WebPage_ChangeSpellingToWord = 1833
+    , WebPage_DidFinishCheckingText = 1834
+    , WebPage_DidCancelCheckingText = 1835
 #if USE(APPKIT)
-    , WebPage_UppercaseWord = 1834
+    , WebPage_UppercaseWord = 1836
 #endif
 #if USE(APPKIT)
-    , WebPage_LowercaseWord = 1835
+    , WebPage_LowercaseWord = 1837
 #endif
 #if USE(APPKIT)
-    , WebPage_CapitalizeWord = 1836
+    , WebPage_CapitalizeWord = 1838
 #endif
 #if PLATFORM(COCOA)
-    , WebPage_SetSmartInsertDeleteEnabled = 1837
+    , WebPage_SetSmartInsertDeleteEnabled = 1839
 #endif
 #if ENABLE(GEOLOCATION)
-    , WebPage_DidReceiveGeolocationPermissionDecision = 1838
+    , WebPage_DidReceiveGeolocationPermissionDecision = 1840
 #endif
 #if ENABLE(MEDIA_STREAM)
-    , WebPage_UserMediaAccessWasGranted = 1839
-    , WebPage_UserMediaAccessWasGrantedReply = 1840
+    , WebPage_UserMediaAccessWasGranted = 1841
+    , WebPage_UserMediaAccessWasGrantedReply = 1842
 #endif
 #if ENABLE(MEDIA_STREAM)
-    , WebPage_UserMediaAccessWasDenied = 1841
+    , WebPage_UserMediaAccessWasDenied = 1843
 #endif
 #if ENABLE(MEDIA_STREAM)
-    , WebPage_CaptureDevicesChanged = 1842
+    , WebPage_CaptureDevicesChanged = 1844
 #endif
-    , WebPage_StopAllMediaPlayback = 1843
-    , WebPage_SuspendAllMediaPlayback = 1844
-    , WebPage_ResumeAllMediaPlayback = 1845
-    , WebPage_DidReceiveNotificationPermissionDecision = 1846
-    , WebPage_FreezeLayerTreeDueToSwipeAnimation = 1847
-    , WebPage_UnfreezeLayerTreeDueToSwipeAnimation = 1848
-    , WebPage_BeginPrinting = 1849
-    , WebPage_EndPrinting = 1850
-    , WebPage_ComputePagesForPrinting = 1851
+    , WebPage_StopAllMediaPlayback = 1845
+    , WebPage_SuspendAllMediaPlayback = 1846
+    , WebPage_ResumeAllMediaPlayback = 1847
+    , WebPage_DidReceiveNotificationPermissionDecision = 1848
+    , WebPage_FreezeLayerTreeDueToSwipeAnimation = 1849
+    , WebPage_UnfreezeLayerTreeDueToSwipeAnimation = 1850
+    , WebPage_BeginPrinting = 1851
+    , WebPage_EndPrinting = 1852
+    , WebPage_ComputePagesForPrinting = 1853
 #if PLATFORM(COCOA)
-    , WebPage_DrawRectToImage = 1852
+    , WebPage_DrawRectToImage = 1854
 #endif
 #if PLATFORM(COCOA)
-    , WebPage_DrawPagesToPDF = 1853
+    , WebPage_DrawPagesToPDF = 1855
 #endif
 #if (PLATFORM(COCOA) && PLATFORM(IOS_FAMILY))
-    , WebPage_ComputePagesForPrintingAndDrawToPDF = 1854
+    , WebPage_ComputePagesForPrintingAndDrawToPDF = 1856
 #endif
 #if PLATFORM(COCOA)
-    , WebPage_DrawToPDF = 1855
+    , WebPage_DrawToPDF = 1857
 #endif
 #if PLATFORM(GTK)
-    , WebPage_DrawPagesForPrinting = 1856
+    , WebPage_DrawPagesForPrinting = 1858
 #endif
-    , WebPage_SetMediaVolume = 1857
-    , WebPage_SetMuted = 1858
-    , WebPage_SetMayStartMediaWhenInWindow = 1859
-    , WebPage_StopMediaCapture = 1860
+    , WebPage_SetMediaVolume = 1859
+    , WebPage_SetMuted = 1860
+    , WebPage_SetMayStartMediaWhenInWindow = 1861
+    , WebPage_StopMediaCapture = 1862
 #if ENABLE(MEDIA_SESSION)
-    , WebPage_HandleMediaEvent = 1861
+    , WebPage_HandleMediaEvent = 1863
 #endif
 #if ENABLE(MEDIA_SESSION)
-    , WebPage_SetVolumeOfMediaElement = 1862
+    , WebPage_SetVolumeOfMediaElement = 1864
 #endif
-    , WebPage_SetCanRunBeforeUnloadConfirmPanel = 1863
-    , WebPage_SetCanRunModal = 1864
+    , WebPage_SetCanRunBeforeUnloadConfirmPanel = 1865
+    , WebPage_SetCanRunModal = 1866
 #if PLATFORM(GTK) || PLATFORM(WPE) || PLATFORM(HBD)
-    , WebPage_CancelComposition = 1865
+    , WebPage_CancelComposition = 1867
 #endif
 #if PLATFORM(GTK) || PLATFORM(WPE) || PLATFORM(HBD)
-    , WebPage_DeleteSurrounding = 1866
+    , WebPage_DeleteSurrounding = 1868
 #endif
 #if PLATFORM(GTK) || PLATFORM(HBD)
-    , WebPage_CollapseSelectionInFrame = 1867
+    , WebPage_CollapseSelectionInFrame = 1869
 #endif
 #if PLATFORM(GTK) || PLATFORM(HBD)
-    , WebPage_GetCenterForZoomGesture = 1868
+    , WebPage_GetCenterForZoomGesture = 1870
 #endif
 #if PLATFORM(COCOA)
-    , WebPage_SendComplexTextInputToPlugin = 1869
+    , WebPage_SendComplexTextInputToPlugin = 1871
 #endif
 #if PLATFORM(COCOA)
-    , WebPage_WindowAndViewFramesChanged = 1870
+    , WebPage_WindowAndViewFramesChanged = 1872
 #endif
 #if PLATFORM(COCOA)
-    , WebPage_SetMainFrameIsScrollable = 1871
+    , WebPage_SetMainFrameIsScrollable = 1873
 #endif
 #if PLATFORM(COCOA)
-    , WebPage_RegisterUIProcessAccessibilityTokens = 1872
+    , WebPage_RegisterUIProcessAccessibilityTokens = 1874
 #endif
 #if PLATFORM(COCOA)
-    , WebPage_GetStringSelectionForPasteboard = 1873
+    , WebPage_GetStringSelectionForPasteboard = 1875
 #endif
 #if PLATFORM(COCOA)
-    , WebPage_GetDataSelectionForPasteboard = 1874
+    , WebPage_GetDataSelectionForPasteboard = 1876
 #endif
 #if PLATFORM(COCOA)
-    , WebPage_ReadSelectionFromPasteboard = 1875
+    , WebPage_ReadSelectionFromPasteboard = 1877
 #endif
 #if (PLATFORM(COCOA) && ENABLE(SERVICE_CONTROLS))
-    , WebPage_ReplaceSelectionWithPasteboardData = 1876
+    , WebPage_ReplaceSelectionWithPasteboardData = 1878
 #endif
 #if PLATFORM(COCOA)
-    , WebPage_ShouldDelayWindowOrderingEvent = 1877
+    , WebPage_ShouldDelayWindowOrderingEvent = 1879
 #endif
 #if PLATFORM(COCOA)
-    , WebPage_AcceptsFirstMouse = 1878
+    , WebPage_AcceptsFirstMouse = 1880
 #endif
 #if PLATFORM(COCOA)
-    , WebPage_SetTextAsync = 1879
+    , WebPage_SetTextAsync = 1881
 #endif
 #if PLATFORM(COCOA)
-    , WebPage_InsertTextAsync = 1880
+    , WebPage_InsertTextAsync = 1882
 #endif
 #if PLATFORM(COCOA)
-    , WebPage_InsertDictatedTextAsync = 1881
+    , WebPage_InsertDictatedTextAsync = 1883
 #endif
 #if PLATFORM(COCOA)
-    , WebPage_HasMarkedText = 1882
-    , WebPage_HasMarkedTextReply = 1883
+    , WebPage_HasMarkedText = 1884
+    , WebPage_HasMarkedTextReply = 1885
 #endif
 #if PLATFORM(COCOA)
-    , WebPage_GetMarkedRangeAsync = 1884
+    , WebPage_GetMarkedRangeAsync = 1886
 #endif
 #if PLATFORM(COCOA)
-    , WebPage_GetSelectedRangeAsync = 1885
+    , WebPage_GetSelectedRangeAsync = 1887
 #endif
 #if PLATFORM(COCOA)
-    , WebPage_CharacterIndexForPointAsync = 1886
+    , WebPage_CharacterIndexForPointAsync = 1888
 #endif
 #if PLATFORM(COCOA)
-    , WebPage_FirstRectForCharacterRangeAsync = 1887
+    , WebPage_FirstRectForCharacterRangeAsync = 1889
 #endif
 #if PLATFORM(COCOA)
-    , WebPage_SetCompositionAsync = 1888
+    , WebPage_SetCompositionAsync = 1890
 #endif
 #if PLATFORM(COCOA)
-    , WebPage_ConfirmCompositionAsync = 1889
+    , WebPage_ConfirmCompositionAsync = 1891
 #endif
 #if PLATFORM(MAC)
-    , WebPage_AttributedSubstringForCharacterRangeAsync = 1890
+    , WebPage_AttributedSubstringForCharacterRangeAsync = 1892
 #endif
 #if PLATFORM(MAC)
-    , WebPage_FontAtSelection = 1891
+    , WebPage_FontAtSelection = 1893
 #endif
-    , WebPage_SetAlwaysShowsHorizontalScroller = 1892
-    , WebPage_SetAlwaysShowsVerticalScroller = 1893
-    , WebPage_SetMinimumSizeForAutoLayout = 1894
-    , WebPage_SetSizeToContentAutoSizeMaximumSize = 1895
-    , WebPage_SetAutoSizingShouldExpandToViewHeight = 1896
-    , WebPage_SetViewportSizeForCSSViewportUnits = 1897
+    , WebPage_SetAlwaysShowsHorizontalScroller = 1894
+    , WebPage_SetAlwaysShowsVerticalScroller = 1895
+    , WebPage_SetMinimumSizeForAutoLayout = 1896
+    , WebPage_SetSizeToContentAutoSizeMaximumSize = 1897
+    , WebPage_SetAutoSizingShouldExpandToViewHeight = 1898
+    , WebPage_SetViewportSizeForCSSViewportUnits = 1899
 #if PLATFORM(COCOA)
-    , WebPage_HandleAlternativeTextUIResult = 1898
+    , WebPage_HandleAlternativeTextUIResult = 1900
 #endif
 #if PLATFORM(IOS_FAMILY)
-    , WebPage_WillStartUserTriggeredZooming = 1899
+    , WebPage_WillStartUserTriggeredZooming = 1901
 #endif
-    , WebPage_SetScrollPinningBehavior = 1900
-    , WebPage_SetScrollbarOverlayStyle = 1901
-    , WebPage_GetBytecodeProfile = 1902
-    , WebPage_GetSamplingProfilerOutput = 1903
-    , WebPage_TakeSnapshot = 1904
+    , WebPage_SetScrollPinningBehavior = 1902
+    , WebPage_SetScrollbarOverlayStyle = 1903
+    , WebPage_GetBytecodeProfile = 1904
+    , WebPage_GetSamplingProfilerOutput = 1905
+    , WebPage_TakeSnapshot = 1906
 #if PLATFORM(MAC)
-    , WebPage_PerformImmediateActionHitTestAtLocation = 1905
+    , WebPage_PerformImmediateActionHitTestAtLocation = 1907
 #endif
 #if PLATFORM(MAC)
-    , WebPage_ImmediateActionDidUpdate = 1906
+    , WebPage_ImmediateActionDidUpdate = 1908
 #endif
 #if PLATFORM(MAC)
-    , WebPage_ImmediateActionDidCancel = 1907
+    , WebPage_ImmediateActionDidCancel = 1909
 #endif
 #if PLATFORM(MAC)
-    , WebPage_ImmediateActionDidComplete = 1908
+    , WebPage_ImmediateActionDidComplete = 1910
 #endif
 #if PLATFORM(MAC)
-    , WebPage_DataDetectorsDidPresentUI = 1909
+    , WebPage_DataDetectorsDidPresentUI = 1911
 #endif
 #if PLATFORM(MAC)
-    , WebPage_DataDetectorsDidChangeUI = 1910
+    , WebPage_DataDetectorsDidChangeUI = 1912
 #endif
 #if PLATFORM(MAC)
-    , WebPage_DataDetectorsDidHideUI = 1911
+    , WebPage_DataDetectorsDidHideUI = 1913
 #endif
 #if PLATFORM(MAC)
-    , WebPage_HandleAcceptedCandidate = 1912
+    , WebPage_HandleAcceptedCandidate = 1914
 #endif
 #if PLATFORM(MAC)
-    , WebPage_SetUseSystemAppearance = 1913
+    , WebPage_SetUseSystemAppearance = 1915
 #endif
 #if PLATFORM(MAC)
-    , WebPage_SetHeaderBannerHeightForTesting = 1914
+    , WebPage_SetHeaderBannerHeightForTesting = 1916
 #endif
 #if PLATFORM(MAC)
-    , WebPage_SetFooterBannerHeightForTesting = 1915
+    , WebPage_SetFooterBannerHeightForTesting = 1917
 #endif
 #if PLATFORM(MAC)
-    , WebPage_DidEndMagnificationGesture = 1916
+    , WebPage_DidEndMagnificationGesture = 1918
 #endif
-    , WebPage_EffectiveAppearanceDidChange = 1917
+    , WebPage_EffectiveAppearanceDidChange = 1919
 #if PLATFORM(GTK)
-    , WebPage_ThemeDidChange = 1918
+    , WebPage_ThemeDidChange = 1920
 #endif
 #if PLATFORM(COCOA)
-    , WebPage_RequestActiveNowPlayingSessionInfo = 1919
+    , WebPage_RequestActiveNowPlayingSessionInfo = 1921
 #endif
-    , WebPage_SetShouldDispatchFakeMouseMoveEvents = 1920
+    , WebPage_SetShouldDispatchFakeMouseMoveEvents = 1922
 #if ENABLE(WIRELESS_PLAYBACK_TARGET) && !PLATFORM(IOS_FAMILY)
-    , WebPage_PlaybackTargetSelected = 1921
+    , WebPage_PlaybackTargetSelected = 1923
 #endif
 #if ENABLE(WIRELESS_PLAYBACK_TARGET) && !PLATFORM(IOS_FAMILY)
-    , WebPage_PlaybackTargetAvailabilityDidChange = 1922
+    , WebPage_PlaybackTargetAvailabilityDidChange = 1924
 #endif
 #if ENABLE(WIRELESS_PLAYBACK_TARGET) && !PLATFORM(IOS_FAMILY)
-    , WebPage_SetShouldPlayToPlaybackTarget = 1923
+    , WebPage_SetShouldPlayToPlaybackTarget = 1925
 #endif
 #if ENABLE(WIRELESS_PLAYBACK_TARGET) && !PLATFORM(IOS_FAMILY)
-    , WebPage_PlaybackTargetPickerWasDismissed = 1924
+    , WebPage_PlaybackTargetPickerWasDismissed = 1926
 #endif
 #if ENABLE(POINTER_LOCK)
-    , WebPage_DidAcquirePointerLock = 1925
+    , WebPage_DidAcquirePointerLock = 1927
 #endif
 #if ENABLE(POINTER_LOCK)
-    , WebPage_DidNotAcquirePointerLock = 1926
+    , WebPage_DidNotAcquirePointerLock = 1928
 #endif
 #if ENABLE(POINTER_LOCK)
-    , WebPage_DidLosePointerLock = 1927
+    , WebPage_DidLosePointerLock = 1929
 #endif
-    , WebPage_clearWheelEventTestMonitor = 1928
-    , WebPage_SetShouldScaleViewToFitDocument = 1929
+    , WebPage_clearWheelEventTestMonitor = 1930
+    , WebPage_SetShouldScaleViewToFitDocument = 1931
 #if ENABLE(VIDEO) && USE(GSTREAMER)
-    , WebPage_DidEndRequestInstallMissingMediaPlugins = 1930
+    , WebPage_DidEndRequestInstallMissingMediaPlugins = 1932
 #endif
-    , WebPage_SetUserInterfaceLayoutDirection = 1931
-    , WebPage_DidGetLoadDecisionForIcon = 1932
-    , WebPage_SetUseIconLoadingClient = 1933
+    , WebPage_SetUserInterfaceLayoutDirection = 1933
+    , WebPage_DidGetLoadDecisionForIcon = 1934
+    , WebPage_SetUseIconLoadingClient = 1935
 #if ENABLE(GAMEPAD)
-    , WebPage_GamepadActivity = 1934
-#endif
-    , WebPage_FrameBecameRemote = 1935
-    , WebPage_RegisterURLSchemeHandler = 1936
-    , WebPage_URLSchemeTaskDidPerformRedirection = 1937
-    , WebPage_URLSchemeTaskDidReceiveResponse = 1938
-    , WebPage_URLSchemeTaskDidReceiveData = 1939
-    , WebPage_URLSchemeTaskDidComplete = 1940
-    , WebPage_SetIsSuspended = 1941
+    , WebPage_GamepadActivity = 1936
+#endif
+    , WebPage_FrameBecameRemote = 1937
+    , WebPage_RegisterURLSchemeHandler = 1938
+    , WebPage_URLSchemeTaskDidPerformRedirection = 1939
+    , WebPage_URLSchemeTaskDidReceiveResponse = 1940
+    , WebPage_URLSchemeTaskDidReceiveData = 1941
+    , WebPage_URLSchemeTaskDidComplete = 1942
+    , WebPage_SetIsSuspended = 1943
 #if ENABLE(ATTACHMENT_ELEMENT)
-    , WebPage_InsertAttachment = 1942
+    , WebPage_InsertAttachment = 1944
 #endif
 #if ENABLE(ATTACHMENT_ELEMENT)
-    , WebPage_UpdateAttachmentAttributes = 1943
+    , WebPage_UpdateAttachmentAttributes = 1945
 #endif
 #if ENABLE(ATTACHMENT_ELEMENT)
-    , WebPage_UpdateAttachmentIcon = 1944
+    , WebPage_UpdateAttachmentIcon = 1946
 #endif
 #if ENABLE(APPLICATION_MANIFEST)
-    , WebPage_GetApplicationManifest = 1945
+    , WebPage_GetApplicationManifest = 1947
 #endif
-    , WebPage_SetDefersLoading = 1946
-    , WebPage_UpdateCurrentModifierState = 1947
-    , WebPage_SimulateDeviceOrientationChange = 1948
+    , WebPage_SetDefersLoading = 1948
+    , WebPage_UpdateCurrentModifierState = 1949
+    , WebPage_SimulateDeviceOrientationChange = 1950
 #if ENABLE(SPEECH_SYNTHESIS)
-    , WebPage_SpeakingErrorOccurred = 1949
+    , WebPage_SpeakingErrorOccurred = 1951
 #endif
 #if ENABLE(SPEECH_SYNTHESIS)
-    , WebPage_BoundaryEventOccurred = 1950
+    , WebPage_BoundaryEventOccurred = 1952
 #endif
 #if ENABLE(SPEECH_SYNTHESIS)
-    , WebPage_VoicesDidChange = 1951
+    , WebPage_VoicesDidChange = 1953
 #endif
-    , WebPage_SetCanShowPlaceholder = 1952
+    , WebPage_SetCanShowPlaceholder = 1954
 #if ENABLE(RESOURCE_LOAD_STATISTICS)
-    , WebPage_WasLoadedWithDataTransferFromPrevalentResource = 1953
+    , WebPage_WasLoadedWithDataTransferFromPrevalentResource = 1955
 #endif
 #if ENABLE(RESOURCE_LOAD_STATISTICS)
-    , WebPage_ClearLoadedThirdPartyDomains = 1954
+    , WebPage_ClearLoadedThirdPartyDomains = 1956
 #endif
 #if ENABLE(RESOURCE_LOAD_STATISTICS)
-    , WebPage_LoadedThirdPartyDomains = 1955
-    , WebPage_LoadedThirdPartyDomainsReply = 1956
+    , WebPage_LoadedThirdPartyDomains = 1957
+    , WebPage_LoadedThirdPartyDomainsReply = 1958
 #endif
 #if USE(SYSTEM_PREVIEW)
-    , WebPage_SystemPreviewActionTriggered = 1957
+    , WebPage_SystemPreviewActionTriggered = 1959
 #endif
 #if PLATFORM(GTK) || PLATFORM(WPE)
-    , WebPage_SendMessageToWebExtension = 1958
+    , WebPage_SendMessageToWebExtension = 1960
 #endif
 #if PLATFORM(GTK) || PLATFORM(WPE)
-    , WebPage_SendMessageToWebExtensionWithReply = 1959
-    , WebPage_SendMessageToWebExtensionWithReplyReply = 1960
-#endif
-    , WebPage_StartTextManipulations = 1961
-    , WebPage_StartTextManipulationsReply = 1962
-    , WebPage_CompleteTextManipulation = 1963
-    , WebPage_CompleteTextManipulationReply = 1964
-    , WebPage_SetOverriddenMediaType = 1965
-    , WebPage_GetProcessDisplayName = 1966
-    , WebPage_GetProcessDisplayNameReply = 1967
-    , WebPage_UpdateCORSDisablingPatterns = 1968
-    , WebPage_SetShouldFireEvents = 1969
-    , WebPage_SetNeedsDOMWindowResizeEvent = 1970
-    , WebPage_SetHasResourceLoadClient = 1971
-    , StorageAreaMap_DidSetItem = 1972
-    , StorageAreaMap_DidRemoveItem = 1973
-    , StorageAreaMap_DidClear = 1974
-    , StorageAreaMap_DispatchStorageEvent = 1975
-    , StorageAreaMap_ClearCache = 1976
+    , WebPage_SendMessageToWebExtensionWithReply = 1961
+    , WebPage_SendMessageToWebExtensionWithReplyReply = 1962
+#endif
+    , WebPage_StartTextManipulations = 1963
+    , WebPage_StartTextManipulationsReply = 1964
+    , WebPage_CompleteTextManipulation = 1965
+    , WebPage_CompleteTextManipulationReply = 1966
+    , WebPage_SetOverriddenMediaType = 1967
+    , WebPage_GetProcessDisplayName = 1968
+    , WebPage_GetProcessDisplayNameReply = 1969
+    , WebPage_UpdateCORSDisablingPatterns = 1970
+    , WebPage_SetShouldFireEvents = 1971
+    , WebPage_SetNeedsDOMWindowResizeEvent = 1972
+    , WebPage_SetHasResourceLoadClient = 1973
+    , StorageAreaMap_DidSetItem = 1974
+    , StorageAreaMap_DidRemoveItem = 1975
+    , StorageAreaMap_DidClear = 1976
+    , StorageAreaMap_DispatchStorageEvent = 1977
+    , StorageAreaMap_ClearCache = 1978
 #if PLATFORM(MAC)
-    , ViewGestureController_DidCollectGeometryForMagnificationGesture = 1977
+    , ViewGestureController_DidCollectGeometryForMagnificationGesture = 1979
 #endif
 #if PLATFORM(MAC)
-    , ViewGestureController_DidCollectGeometryForSmartMagnificationGesture = 1978
+    , ViewGestureController_DidCollectGeometryForSmartMagnificationGesture = 1980
 #endif
 #if !PLATFORM(IOS_FAMILY)
-    , ViewGestureController_DidHitRenderTreeSizeThreshold = 1979
+    , ViewGestureController_DidHitRenderTreeSizeThreshold = 1981
 #endif
 #if PLATFORM(COCOA)
-    , ViewGestureGeometryCollector_CollectGeometryForSmartMagnificationGesture = 1980
+    , ViewGestureGeometryCollector_CollectGeometryForSmartMagnificationGesture = 1982
 #endif
 #if PLATFORM(MAC)
-    , ViewGestureGeometryCollector_CollectGeometryForMagnificationGesture = 1981
+    , ViewGestureGeometryCollector_CollectGeometryForMagnificationGesture = 1983
 #endif
 #if !PLATFORM(IOS_FAMILY)
-    , ViewGestureGeometryCollector_SetRenderTreeSizeNotificationThreshold = 1982
+    , ViewGestureGeometryCollector_SetRenderTreeSizeNotificationThreshold = 1984
 #endif
-    , WrappedAsyncMessageForTesting = 1983
-    , SyncMessageReply = 1984
-    , InitializeConnection = 1985
-    , LegacySessionState = 1986
+    , WrappedAsyncMessageForTesting = 1985
+    , SyncMessageReply = 1986
+    , InitializeConnection = 1987
+    , LegacySessionState = 1988
 };
 
 ReceiverName receiverName(MessageName);
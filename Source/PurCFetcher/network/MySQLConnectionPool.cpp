@@ -0,0 +1,236 @@
+/* 
+ * Copyright (C) 2020 Beijing FMSoft Technologies Co., Ltd.
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ * 
+ * Or,
+ * 
+ * As this component is a program released under LGPLv3, which claims
+ * explicitly that the program could be modified by any end user
+ * even if the program is conveyed in non-source form on the system it runs.
+ * Generally, if you distribute this program in embedded devices,
+ * you might not satisfy this condition. Under this situation or you can
+ * not accept any condition of LGPLv3, you need to get a commercial license
+ * from FMSoft, along with a patent license for the patents owned by FMSoft.
+ * 
+ * If you have got a commercial/patent license of this program, please use it
+ * under the terms and conditions of the commercial license.
+ * 
+ * For more information about the commercial license and patent license,
+ * please refer to
+ * <https://hybridos.fmsoft.cn/blog/hybridos-licensing-policy/>.
+ * 
+ * Also note that the LGPLv3 license does not apply to any entity in the
+ * Exception List published by Beijing FMSoft Technologies Co., Ltd.
+ * 
+ * If you are or the entity you represent is listed in the Exception List,
+ * the above open source or free software license does not apply to you
+ * or the entity you represent. Regardless of the purpose, you should not
+ * use the software in any way whatsoever, including but not limited to
+ * downloading, viewing, copying, distributing, compiling, and running.
+ * If you have already downloaded it, you MUST destroy all of its copies.
+ * 
+ * The Exception List is published by FMSoft and may be updated
+ * from time to time. For more information, please see
+ * <https://www.fmsoft.cn/exception-list>.
+ */ 
+
+#include "config.h"
+#include "MySQLConnectionPool.h"
+
+#if ENABLE(RSQL)
+
+#include "Logging.h"
+#include <wtf/NeverDestroyed.h>
+#include <wtf/text/StringConcatenateNumbers.h>
+
+namespace PurCFetcher {
+
+static const unsigned maxConnectionsPerKey = 8;
+static const Seconds idleConnectionTimeout = 60_s;
+// a connection idle for longer than this is pinged before it is reused
+static const Seconds pingInterval = 5_s;
+static const Seconds defaultWaitTimeout = 30_s;
+static const Seconds killQueryTimeout = 5_s;
+
+MySQLConnection::MySQLConnection(const String& key)
+    : m_key(key)
+{
+    mysql_init(&m_mysql);
+}
+
+MySQLConnection::~MySQLConnection()
+{
+    mysql_close(&m_mysql);
+}
+
+MySQLConnectionPool& MySQLConnectionPool::singleton()
+{
+    static NeverDestroyed<MySQLConnectionPool> pool;
+    return pool;
+}
+
+MySQLConnectionPool::MySQLConnectionPool()
+{
+    // mysql_init() is not thread safe until the library is initialized
+    mysql_library_init(0, nullptr, nullptr);
+}
+
+std::unique_ptr<MySQLConnection> MySQLConnectionPool::takeConnection(const Parameters& parameters, String& errorMessage)
+{
+    // the password is part of the key, so that a pooled connection is
+    // never handed to a request which did not authenticate for it
+    String key = makeString(parameters.user, ':', parameters.password, '@', parameters.host, ':', parameters.port, '/', parameters.database);
+
+    MonotonicTime startTime = MonotonicTime::now();
+    MonotonicTime deadline = startTime + (parameters.timeout ? parameters.timeout : defaultWaitTimeout);
+    Vector<std::unique_ptr<MySQLConnection>> expired;
+    std::unique_ptr<MySQLConnection> connection;
+    bool waited = false;
+    {
+        auto locker = holdLock(m_lock);
+        takeExpiredConnections(locker, startTime, expired);
+
+        while (true) {
+            auto& bucket = m_buckets.add(key, Bucket { }).iterator->value;
+            if (!bucket.idleConnections.isEmpty()) {
+                connection = bucket.idleConnections.takeLast();
+                break;
+            }
+            if (bucket.connectionCount < maxConnectionsPerKey) {
+                bucket.connectionCount++;
+                break;
+            }
+
+            if (!waited) {
+                m_metrics.waits++;
+                waited = true;
+            }
+            if (MonotonicTime::now() >= deadline) {
+                m_metrics.waitTime += MonotonicTime::now() - startTime;
+                errorMessage = "Timed out waiting for a database connection.";
+                return nullptr;
+            }
+            m_condition.waitUntil(m_lock, deadline);
+        }
+
+        if (waited)
+            m_metrics.waitTime += MonotonicTime::now() - startTime;
+        if (connection)
+            m_metrics.hits++;
+        else
+            m_metrics.misses++;
+    }
+    expired.clear();
+
+    if (connection) {
+        if (MonotonicTime::now() - connection->m_lastUsedTime < pingInterval || !mysql_ping(connection->handle()))
+            return connection;
+
+        // the server went away; reconnect in the slot of the dead connection
+        connection = nullptr;
+    }
+
+    connection = std::unique_ptr<MySQLConnection>(new MySQLConnection(key));
+    if (parameters.timeout) {
+        unsigned timeout = std::max(1u, static_cast<unsigned>(parameters.timeout.seconds()));
+        mysql_options(connection->handle(), MYSQL_OPT_CONNECT_TIMEOUT, &timeout);
+        mysql_options(connection->handle(), MYSQL_OPT_READ_TIMEOUT, &timeout);
+        mysql_options(connection->handle(), MYSQL_OPT_WRITE_TIMEOUT, &timeout);
+    }
+
+    if (!mysql_real_connect(connection->handle(), parameters.host.utf8().data(), parameters.user.utf8().data(), parameters.password.utf8().data(), parameters.database.utf8().data(), parameters.port, NULL, 0)) {
+        errorMessage = makeString("Failed to connect to database:", mysql_error(connection->handle()));
+        giveBackConnection(WTFMove(connection), false);
+        return nullptr;
+    }
+
+    return connection;
+}
+
+void MySQLConnectionPool::giveBackConnection(std::unique_ptr<MySQLConnection>&& connection, bool reusable)
+{
+    if (!connection)
+        return;
+
+    auto locker = holdLock(m_lock);
+    if (reusable) {
+        connection->m_lastUsedTime = MonotonicTime::now();
+        auto it = m_buckets.find(connection->m_key);
+        ASSERT(it != m_buckets.end());
+        it->value.idleConnections.append(WTFMove(connection));
+    } else
+        releaseSlot(locker, connection->m_key);
+    m_condition.notifyAll();
+
+    // a closing connection may wait for the server, do not hold the lock
+    locker.unlockEarly();
+    connection = nullptr;
+}
+
+void MySQLConnectionPool::killQuery(const Parameters& parameters, unsigned long threadId)
+{
+    // not pooled: every pooled connection of the key may be busy
+    MYSQL mysql;
+    mysql_init(&mysql);
+    unsigned timeout = parameters.timeout ? std::max(1u, static_cast<unsigned>(parameters.timeout.seconds())) : static_cast<unsigned>(killQueryTimeout.seconds());
+    mysql_options(&mysql, MYSQL_OPT_CONNECT_TIMEOUT, &timeout);
+    mysql_options(&mysql, MYSQL_OPT_READ_TIMEOUT, &timeout);
+    mysql_options(&mysql, MYSQL_OPT_WRITE_TIMEOUT, &timeout);
+
+    if (mysql_real_connect(&mysql, parameters.host.utf8().data(), parameters.user.utf8().data(), parameters.password.utf8().data(), nullptr, parameters.port, NULL, 0)) {
+        auto query = makeString("KILL QUERY ", threadId).utf8();
+        if (mysql_real_query(&mysql, query.data(), query.length()))
+            LOG(Network, "Failed to kill query %lu: %s", threadId, mysql_error(&mysql));
+    } else
+        LOG(Network, "Failed to connect to kill query %lu: %s", threadId, mysql_error(&mysql));
+    mysql_close(&mysql);
+}
+
+auto MySQLConnectionPool::metrics() -> Metrics
+{
+    auto locker = holdLock(m_lock);
+    return m_metrics;
+}
+
+void MySQLConnectionPool::takeExpiredConnections(const AbstractLocker& locker, MonotonicTime now, Vector<std::unique_ptr<MySQLConnection>>& expired)
+{
+    Vector<String> keys;
+    for (auto& it : m_buckets) {
+        // the idle connections are kept in the order they were given back
+        auto& idleConnections = it.value.idleConnections;
+        size_t count = 0;
+        while (count < idleConnections.size() && now - idleConnections[count]->m_lastUsedTime >= idleConnectionTimeout) {
+            keys.append(it.key);
+            expired.append(WTFMove(idleConnections[count]));
+            count++;
+        }
+        idleConnections.remove(0, count);
+    }
+
+    for (auto& key : keys)
+        releaseSlot(locker, key);
+}
+
+void MySQLConnectionPool::releaseSlot(const AbstractLocker&, const String& key)
+{
+    auto it = m_buckets.find(key);
+    ASSERT(it != m_buckets.end() && it->value.connectionCount);
+    if (!--it->value.connectionCount)
+        m_buckets.remove(it);
+}
+
+} // namespace PurCFetcher
+
+#endif // ENABLE(RSQL)
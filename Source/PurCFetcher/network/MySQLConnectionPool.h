@@ -0,0 +1,137 @@
+/* 
+ * Copyright (C) 2020 Beijing FMSoft Technologies Co., Ltd.
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ * 
+ * Or,
+ * 
+ * As this component is a program released under LGPLv3, which claims
+ * explicitly that the program could be modified by any end user
+ * even if the program is conveyed in non-source form on the system it runs.
+ * Generally, if you distribute this program in embedded devices,
+ * you might not satisfy this condition. Under this situation or you can
+ * not accept any condition of LGPLv3, you need to get a commercial license
+ * from FMSoft, along with a patent license for the patents owned by FMSoft.
+ * 
+ * If you have got a commercial/patent license of this program, please use it
+ * under the terms and conditions of the commercial license.
+ * 
+ * For more information about the commercial license and patent license,
+ * please refer to
+ * <https://hybridos.fmsoft.cn/blog/hybridos-licensing-policy/>.
+ * 
+ * Also note that the LGPLv3 license does not apply to any entity in the
+ * Exception List published by Beijing FMSoft Technologies Co., Ltd.
+ * 
+ * If you are or the entity you represent is listed in the Exception List,
+ * the above open source or free software license does not apply to you
+ * or the entity you represent. Regardless of the purpose, you should not
+ * use the software in any way whatsoever, including but not limited to
+ * downloading, viewing, copying, distributing, compiling, and running.
+ * If you have already downloaded it, you MUST destroy all of its copies.
+ * 
+ * The Exception List is published by FMSoft and may be updated
+ * from time to time. For more information, please see
+ * <https://www.fmsoft.cn/exception-list>.
+ */ 
+
+#pragma once
+
+#if ENABLE(RSQL)
+
+#include <wtf/Condition.h>
+#include <wtf/HashMap.h>
+#include <wtf/Lock.h>
+#include <wtf/MonotonicTime.h>
+#include <wtf/Vector.h>
+#include <wtf/text/WTFString.h>
+#include <mysql/mysql.h>
+
+namespace PurCFetcher {
+
+// A connection to a MySQL server, checked out of MySQLConnectionPool.
+class MySQLConnection {
+    WTF_MAKE_NONCOPYABLE(MySQLConnection); WTF_MAKE_FAST_ALLOCATED;
+public:
+    ~MySQLConnection();
+
+    MYSQL* handle() { return &m_mysql; }
+
+private:
+    friend class MySQLConnectionPool;
+    explicit MySQLConnection(const String& key);
+
+    String m_key;
+    MonotonicTime m_lastUsedTime;
+    MYSQL m_mysql;
+};
+
+// The process wide pool of the connections used by rsql:// data tasks.
+// The connections are keyed by server, credentials and database; the
+// tasks run on the SQL worker threads, so the pool is thread safe.
+class MySQLConnectionPool {
+    WTF_MAKE_NONCOPYABLE(MySQLConnectionPool); WTF_MAKE_FAST_ALLOCATED;
+public:
+    struct Parameters {
+        String host;
+        int port;
+        String user;
+        String password;
+        String database;
+        Seconds timeout;
+    };
+
+    struct Metrics {
+        uint64_t hits { 0 };
+        uint64_t misses { 0 };
+        uint64_t waits { 0 };
+        Seconds waitTime;
+    };
+
+    static MySQLConnectionPool& singleton();
+
+    // Blocks while the key is at its connection limit. Returns null and
+    // sets errorMessage if no connection could be made in time.
+    std::unique_ptr<MySQLConnection> takeConnection(const Parameters&, String& errorMessage);
+    // Puts the connection back in the pool, or closes it if it is not
+    // reusable, e.g. after a failed connect.
+    void giveBackConnection(std::unique_ptr<MySQLConnection>&&, bool reusable);
+    // Stops the statement the server runs for the given connection thread
+    // id, over a connection of its own. Blocks while connecting.
+    void killQuery(const Parameters&, unsigned long threadId);
+
+    Metrics metrics();
+
+private:
+    friend class NeverDestroyed<MySQLConnectionPool>;
+    MySQLConnectionPool();
+
+    struct Bucket {
+        Vector<std::unique_ptr<MySQLConnection>> idleConnections;
+        // the idle connections and the ones checked out
+        unsigned connectionCount { 0 };
+    };
+
+    void takeExpiredConnections(const AbstractLocker&, MonotonicTime now, Vector<std::unique_ptr<MySQLConnection>>& expired);
+    void releaseSlot(const AbstractLocker&, const String& key);
+
+    Lock m_lock;
+    Condition m_condition;
+    HashMap<String, Bucket> m_buckets;
+    Metrics m_metrics;
+};
+
+} // namespace PurCFetcher
+
+#endif // ENABLE(RSQL)
@@ -91,6 +91,8 @@ public:
 
     virtual void cancel() = 0;
     virtual void resume() = 0;
+    // Tasks that cannot pause their source keep running.
+    virtual void suspend() { }
     virtual void invalidateAndCancel() = 0;
 
     void didReceiveResponse(PurCFetcher::ResourceResponse&&, NegotiatedLegacyTLS, ResponseCompletionHandler&&);
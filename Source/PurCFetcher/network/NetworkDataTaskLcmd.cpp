@@ -69,6 +69,8 @@
 #include "SharedBuffer.h"
 #include "TextEncoding.h"
 #include <wtf/MainThread.h>
+#include <wtf/NeverDestroyed.h>
+#include <wtf/glib/GUniquePtr.h>
 #include <wtf/glib/RunLoopSourcePriority.h>
 #include <sys/types.h>
 #include <unistd.h>
@@ -79,6 +81,9 @@ using namespace PurCFetcher;
 
 #define  DEFAULT_READBUFFER_SIZE 8192
 
+static const unsigned maxRunningCommands = 16;
+static unsigned s_runningCommands = 0;
+
 const char* KEY_STATUS_CODE = "statusCode";
 const char* KEY_ERROR_MSG = "errorMsg";
 const char* KEY_EXIT_CODE = "exitCode";
@@ -86,6 +91,7 @@ const char* KEY_LINES = "lines";
 
 const char* CMD_FILTER = "cmdfilter";
 const char* CMD_LINE = "cmdline";
+const char* CMD_STREAM = "cmdstream";
 
 String decodeEscapeSequencesFromParsedURL(StringView input)
 {
@@ -110,7 +116,7 @@ String decodeEscapeSequencesFromParsedURL(StringView input)
 
 NetworkDataTaskLcmd::NetworkDataTaskLcmd(NetworkSession& session, NetworkDataTaskClient& client, const ResourceRequest& requestWithCredentials, StoredCredentialsPolicy storedCredentialsPolicy, ContentSniffingPolicy shouldContentSniff, PurCFetcher::ContentEncodingSniffingPolicy, bool shouldClearReferrerOnHTTPSToHTTPRedirect, bool dataTaskIsForMainFrameNavigation)
     : NetworkDataTask(session, client, requestWithCredentials, storedCredentialsPolicy, shouldClearReferrerOnHTTPSToHTTPRedirect, dataTaskIsForMainFrameNavigation)
-    , m_filterManager(adoptRef(*new CmdFilterManager()))
+    , m_timeoutSource(RunLoop::main(), this, &NetworkDataTaskLcmd::timeoutFired)
 {
     UNUSED_PARAM(shouldContentSniff);
     m_session->registerNetworkDataTask(*this);
@@ -123,6 +129,7 @@ NetworkDataTaskLcmd::NetworkDataTaskLcmd(NetworkSession& session, NetworkDataTas
 
 NetworkDataTaskLcmd::~NetworkDataTaskLcmd()
 {
+    terminateCommand();
     m_session->unregisterNetworkDataTask(*this);
 }
 
@@ -146,6 +153,7 @@ void NetworkDataTaskLcmd::cancel()
         return;
 
     m_state = State::Canceling;
+    terminateCommand();
 }
 
 void NetworkDataTaskLcmd::resume()
@@ -166,6 +174,7 @@ void NetworkDataTaskLcmd::resume()
 
 void NetworkDataTaskLcmd::invalidateAndCancel()
 {
+    cancel();
 }
 
 NetworkDataTask::State NetworkDataTaskLcmd::state() const
@@ -181,18 +190,23 @@ void NetworkDataTaskLcmd::dispatchDidCompleteWithError(const ResourceError& erro
     m_client->didCompleteWithError(error, m_networkLoadMetrics);
 }
 
-void NetworkDataTaskLcmd::dispatchDidReceiveResponse()
+void NetworkDataTaskLcmd::buildResponseHeaders()
 {
     m_networkLoadMetrics.responseStart = MonotonicTime::now() - m_startTime;
     m_response.setURL(m_currentRequest.url());
     const char* contentType = "application/json";
     m_response.setMimeType(extractMIMETypeFromMediaType(contentType));
     m_response.setTextEncodingName(extractCharsetFromMediaType(contentType));
-    m_response.setExpectedContentLength(m_responseBuffer.size());
     m_response.setHTTPHeaderField(HTTPHeaderName::AccessControlAllowOrigin, "*");
     m_response.setHTTPHeaderField(HTTPHeaderName::Expires, "-1");
     m_response.setHTTPHeaderField(HTTPHeaderName::CacheControl, "no-cache");
     m_response.setHTTPHeaderField(HTTPHeaderName::Pragma, "no-cache");
+}
+
+void NetworkDataTaskLcmd::dispatchDidReceiveResponse()
+{
+    buildResponseHeaders();
+    m_response.setExpectedContentLength(m_responseBuffer.size());
     m_response.setHTTPStatusCode(m_statusCode);
 
     didReceiveResponse(ResourceResponse(m_response), NegotiatedLegacyTLS::No, [this, protectedThis = makeRef(*this)](PolicyAction policyAction) {
@@ -216,6 +230,77 @@ void NetworkDataTaskLcmd::dispatchDidReceiveResponse()
     });
 }
 
+// The status of the command is only known when it exits, so a streamed
+// response is always 200 and carries the status fields after "lines".
+void NetworkDataTaskLcmd::dispatchDidReceiveStreamResponse()
+{
+    buildResponseHeaders();
+    m_response.setHTTPStatusCode(200);
+
+    didReceiveResponse(ResourceResponse(m_response), NegotiatedLegacyTLS::No, [this, protectedThis = makeRef(*this)](PolicyAction policyAction) {
+        if (m_state == State::Canceling || m_state == State::Completed) {
+            return;
+        }
+
+        switch (policyAction) {
+        case PolicyAction::Use:
+            {
+                m_streamStarted = true;
+                m_responseBuffer.clear();
+                m_streamWriter.beginObject();
+                m_streamWriter.writeKey(KEY_LINES);
+                m_streamWriter.beginArray();
+                flushResponseBuffer();
+                read();
+            }
+            break;
+
+        case PolicyAction::Ignore:
+        case PolicyAction::Download:
+        case PolicyAction::StopAllLoads:
+            terminateCommand();
+            break;
+        }
+    });
+}
+
+void NetworkDataTaskLcmd::flushResponseBuffer()
+{
+    if (m_responseBuffer.isEmpty())
+        return;
+
+    m_client->didReceiveData(SharedBuffer::create(WTFMove(m_responseBuffer)));
+    m_responseBuffer.clear();
+}
+
+void NetworkDataTaskLcmd::streamLines(const char* data, size_t length)
+{
+    Vector<String> lines = String(data, length).split("\n");
+    if (lines.isEmpty())
+        return;
+
+    m_streamedLines += m_filterManager->writeFiltered(m_streamWriter, WTFMove(lines));
+}
+
+void NetworkDataTaskLcmd::streamCompleteLines()
+{
+    size_t end = m_readBuffer.reverseFind('\n');
+    if (end == notFound)
+        return;
+
+    streamLines(m_readBuffer.data(), end + 1);
+    m_readBuffer.remove(0, end + 1);
+}
+
+void NetworkDataTaskLcmd::finishStream()
+{
+    m_streamWriter.endArray();
+    buildStatus(m_streamWriter);
+    m_streamWriter.endObject();
+    flushResponseBuffer();
+    dispatchDidCompleteWithError({ });
+}
+
 void NetworkDataTaskLcmd::createRequest(PurCFetcher::ResourceRequest&& request)
 {
     m_currentRequest = WTFMove(request);
@@ -225,23 +310,14 @@ void NetworkDataTaskLcmd::createRequest(PurCFetcher::ResourceRequest&& request)
 void NetworkDataTaskLcmd::sendRequest()
 {
     runCmdInner();
-    buildResponse();
-    dispatchDidReceiveResponse();
 }
 
-void NetworkDataTaskLcmd::runCmdInner()
+String NetworkDataTaskLcmd::buildCommandLine()
 {
-    m_readBuffer.clear();
-	char data[DEFAULT_READBUFFER_SIZE] = {'0'};
-
     String cmdLine;
     if (m_currentRequest.url().hasQuery())
     {
         parseQueryString(m_currentRequest.url().query().toString());
-        if (!m_cmdFilter.isEmpty())
-        {
-            parseCmdFilter(m_cmdFilter);
-        }
 
         if (!m_cmdLine.isEmpty())
         {
@@ -250,6 +326,12 @@ void NetworkDataTaskLcmd::runCmdInner()
 
     }
 
+    m_filterManager = CmdFilterManager::compile(m_cmdFilter);
+    if (m_streaming && !m_filterManager->canFilterIncrementally())
+    {
+        m_streaming = false;
+    }
+
 #if 0
     if (m_currentRequest.url().hasFragment())
         printf("......................Fragment=%s\n", m_currentRequest.url().fragmentIdentifier().utf8().data());
@@ -257,10 +339,9 @@ void NetworkDataTaskLcmd::runCmdInner()
 
 
     String path = m_currentRequest.url().path().toString().stripWhiteSpace();
-    const char* command;
     if (cmdLine.isEmpty())
     {
-        command = (const char*)path.characters8();
+        return path;
     }
     else
     {
@@ -287,32 +368,118 @@ void NetworkDataTaskLcmd::runCmdInner()
                 sb.append(cmdLine);
             }
         }
-        const CString& tmp = sb.toString().utf8();
-        command = (const char*)tmp.data();
+        return sb.toString();
     }
+}
 
-	FILE* fp = popen(command, "r");
-	if (fp == NULL)
-	{
-        m_statusCode = 500;
-        m_errorMsg = String(strerror(errno));
+void NetworkDataTaskLcmd::runCmdInner()
+{
+    m_readBuffer.clear();
+    m_command = buildCommandLine().utf8();
+
+    if (!acquireCommandSlot())
+    {
+        pendingCommands().append(this);
         return;
-	}
-	while (fgets(data, sizeof(data), fp) != NULL)
-	{
-        m_readBuffer.append(data, strlen(data));
-        if (m_state == State::Canceling)
-        {
-            m_statusCode = 503;
-            m_errorMsg = String(strerror(errno));
-            return;
-        }
-	}
+    }
+    spawnCommand();
+}
+
+void NetworkDataTaskLcmd::spawnCommand()
+{
+    // the command line is run by the shell, as popen() does
+    const char* argv[] = { "/bin/sh", "-c", m_command.data(), nullptr };
+    GUniqueOutPtr<GError> error;
+    m_subprocess = adoptGRef(g_subprocess_newv(argv,
+                static_cast<GSubprocessFlags>(G_SUBPROCESS_FLAGS_STDOUT_PIPE | G_SUBPROCESS_FLAGS_STDERR_SILENCE),
+                &error.outPtr()));
+    if (!m_subprocess)
+    {
+        didFailCommand(500, String::fromUTF8(error->message));
+        return;
+    }
+
+    m_inputStream = g_subprocess_get_stdout_pipe(m_subprocess.get());
+    m_cancellable = adoptGRef(g_cancellable_new());
+    startTimeout();
+    if (m_streaming)
+        dispatchDidReceiveStreamResponse();
+    else
+        read();
+}
+
+void NetworkDataTaskLcmd::read()
+{
+    RefPtr<NetworkDataTaskLcmd> protectedThis(this);
+    size_t offset = m_readBuffer.size();
+    m_readBuffer.grow(offset + DEFAULT_READBUFFER_SIZE);
+    g_input_stream_read_async(m_inputStream.get(), m_readBuffer.data() + offset, DEFAULT_READBUFFER_SIZE, RunLoopSourcePriority::AsyncIONetwork, m_cancellable.get(),
+        reinterpret_cast<GAsyncReadyCallback>(readCallback), protectedThis.leakRef());
+}
+
+void NetworkDataTaskLcmd::readCallback(GInputStream* inputStream, GAsyncResult* result, NetworkDataTaskLcmd* task)
+{
+    RefPtr<NetworkDataTaskLcmd> protectedThis = adoptRef(task);
+    GUniqueOutPtr<GError> error;
+    gssize bytesRead = g_input_stream_read_finish(inputStream, result, &error.outPtr());
+    if (task->state() == State::Canceling || task->state() == State::Completed || !task->m_client)
+        return;
+
+    if (error)
+        task->didFailCommand(500, String::fromUTF8(error->message));
+    else if (bytesRead > 0)
+        task->didRead(bytesRead);
+    else
+        task->didFinishRead();
+}
+
+void NetworkDataTaskLcmd::didRead(gssize bytesRead)
+{
+    m_readBuffer.shrink(m_readBuffer.size() - DEFAULT_READBUFFER_SIZE + bytesRead);
+    if (m_streamStarted)
+    {
+        streamCompleteLines();
+        flushResponseBuffer();
+    }
+    read();
+}
+
+void NetworkDataTaskLcmd::didFinishRead()
+{
+    m_readBuffer.shrink(m_readBuffer.size() - DEFAULT_READBUFFER_SIZE);
+    m_inputStream = nullptr;
+    if (m_streamStarted)
+    {
+        streamLines(m_readBuffer.data(), m_readBuffer.size());
+        m_readBuffer.clear();
+        flushResponseBuffer();
+    }
+
+    RefPtr<NetworkDataTaskLcmd> protectedThis(this);
+    g_subprocess_wait_async(m_subprocess.get(), m_cancellable.get(),
+        reinterpret_cast<GAsyncReadyCallback>(waitCallback), protectedThis.leakRef());
+}
+
+void NetworkDataTaskLcmd::waitCallback(GSubprocess* subprocess, GAsyncResult* result, NetworkDataTaskLcmd* task)
+{
+    RefPtr<NetworkDataTaskLcmd> protectedThis = adoptRef(task);
+    GUniqueOutPtr<GError> error;
+    bool exited = g_subprocess_wait_finish(subprocess, result, &error.outPtr());
+    if (task->state() == State::Canceling || task->state() == State::Completed || !task->m_client)
+        return;
+
+    if (!exited)
+        task->didFailCommand(500, String::fromUTF8(error->message));
+    else
+        task->didExitCommand();
+}
 
-    m_readLines = String(m_readBuffer.data(),m_readBuffer.size()).split("\n");
+void NetworkDataTaskLcmd::didExitCommand()
+{
+    if (!m_streamStarted)
+        m_readLines = String(m_readBuffer.data(), m_readBuffer.size()).split("\n");
 
-	int status = pclose(fp);
-    m_exitCode = WEXITSTATUS(status);
+    m_exitCode = g_subprocess_get_if_exited(m_subprocess.get()) ? g_subprocess_get_exit_status(m_subprocess.get()) : -1;
     if (m_exitCode == 127)
     {
         m_statusCode = 404;
@@ -322,45 +489,143 @@ void NetworkDataTaskLcmd::runCmdInner()
     {
         m_statusCode = 200;
     }
+    completeCommand();
+}
+
+void NetworkDataTaskLcmd::didFailCommand(int statusCode, const String& errorMsg)
+{
+    terminateCommand();
+    m_statusCode = statusCode;
+    m_errorMsg = errorMsg;
+    completeCommand();
+}
+
+void NetworkDataTaskLcmd::completeCommand()
+{
+    stopTimeout();
+    m_subprocess = nullptr;
+    m_cancellable = nullptr;
+    releaseCommandSlot();
+
+    if (m_streamStarted)
+    {
+        finishStream();
+        return;
+    }
+    buildResponse();
+    dispatchDidReceiveResponse();
+}
+
+void NetworkDataTaskLcmd::terminateCommand()
+{
+    stopTimeout();
+    if (m_cancellable)
+        g_cancellable_cancel(m_cancellable.get());
+    if (m_subprocess)
+        g_subprocess_force_exit(m_subprocess.get());
+    m_inputStream = nullptr;
+    m_subprocess = nullptr;
+    m_cancellable = nullptr;
+    releaseCommandSlot();
+}
+
+void NetworkDataTaskLcmd::timeoutFired()
+{
+    if (m_state == State::Canceling || m_state == State::Completed || !m_client)
+        return;
+
+    RefPtr<NetworkDataTaskLcmd> protectedThis(this);
+    invalidateAndCancel();
+    dispatchDidCompleteWithError(ResourceError::timeoutError(m_currentRequest.url()));
+}
+
+void NetworkDataTaskLcmd::startTimeout()
+{
+    if (m_currentRequest.timeoutInterval() > 0)
+        m_timeoutSource.startOneShot(1_s * m_currentRequest.timeoutInterval());
+}
+
+void NetworkDataTaskLcmd::stopTimeout()
+{
+    m_timeoutSource.stop();
+}
+
+Deque<RefPtr<NetworkDataTaskLcmd>>& NetworkDataTaskLcmd::pendingCommands()
+{
+    static NeverDestroyed<Deque<RefPtr<NetworkDataTaskLcmd>>> pending;
+    return pending;
+}
+
+bool NetworkDataTaskLcmd::acquireCommandSlot()
+{
+    ASSERT(!m_holdsCommandSlot);
+    if (s_runningCommands >= maxRunningCommands)
+        return false;
+
+    s_runningCommands++;
+    m_holdsCommandSlot = true;
+    return true;
+}
+
+void NetworkDataTaskLcmd::releaseCommandSlot()
+{
+    if (!m_holdsCommandSlot)
+        return;
+
+    m_holdsCommandSlot = false;
+    s_runningCommands--;
+
+    auto& pending = pendingCommands();
+    while (!pending.isEmpty())
+    {
+        RefPtr<NetworkDataTaskLcmd> task = pending.takeFirst();
+        if (task->state() != State::Running)
+            continue;
+
+        task->acquireCommandSlot();
+        // start outside of the caller, which may be unwinding this task
+        RunLoop::main().dispatch([task = WTFMove(task)] {
+            if (task->state() == State::Running)
+                task->spawnCommand();
+            else
+                task->releaseCommandSlot();
+        });
+        break;
+    }
 }
 
 void NetworkDataTaskLcmd::runCmdOuter()
 {
 }
 
-void NetworkDataTaskLcmd::buildResponse()
+void NetworkDataTaskLcmd::buildStatus(JSONWriter& writer)
 {
-    m_responseBuffer.clear();
-    auto result = JSON::Object::create();
-    result->setInteger(KEY_STATUS_CODE, m_statusCode);
+    writer.writeKey(KEY_STATUS_CODE);
+    writer.writeInteger(m_statusCode);
+    writer.writeKey(KEY_ERROR_MSG);
     if (m_errorMsg.isEmpty())
-        result->setValue(KEY_ERROR_MSG, JSON::Value::null());
+        writer.writeNull();
     else
-        result->setString(KEY_ERROR_MSG, m_errorMsg);
+        writer.writeString(m_errorMsg);
+    writer.writeKey(KEY_EXIT_CODE);
     if (m_statusCode == 200 || m_statusCode == 404)
-        result->setInteger(KEY_EXIT_CODE, m_exitCode);
+        writer.writeInteger(m_exitCode);
     else
-        result->setValue(KEY_EXIT_CODE, JSON::Value::null());
+        writer.writeNull();
+}
 
+void NetworkDataTaskLcmd::buildResponse()
+{
+    m_responseBuffer.clear();
+    JSONWriter writer(m_responseBuffer);
+    writer.beginObject();
+    buildStatus(writer);
+    writer.writeKey(KEY_LINES);
+    writer.beginArray();
     if (m_readLines.size())
-    {
-        auto array = JSON::Array::create();
-        Vector<Ref<JSON::Value>>  lines = m_filterManager->doFilter(m_readLines);
-        int lineSize = lines.size();
-        for (int i = 0; i < lineSize; i++)
-        {
-            array->pushValue(WTFMove(lines[i]));
-        }
-        result->setArray(KEY_LINES, WTFMove(array));
-    }
-    else
-    {
-        auto array = JSON::Array::create();
-        result->setArray(KEY_LINES, WTFMove(array));
-    }
-
-    String json = result->toJSONString();
-    m_responseBuffer.append(json.characters8(), json.length());
+        m_filterManager->writeFiltered(writer, WTFMove(m_readLines));
+    writer.endArray();
+    writer.endObject();
 }
 
 void NetworkDataTaskLcmd::parseQueryString(String query)
@@ -387,34 +652,14 @@ void NetworkDataTaskLcmd::parseQueryString(String query)
         {
             m_cmdLine = value;
         }
-        else
+        else if (equalIgnoringASCIICase(name, CMD_STREAM))
         {
-            m_paramMap.set(name, value);
+            m_streaming = !value.isEmpty() && value != "0" && !equalIgnoringASCIICase(value, "false");
         }
-    }
-}
-
-void NetworkDataTaskLcmd::parseCmdFilter(String cmdFilter)
-{
-    if (cmdFilter.isEmpty())
-        return;
-    Vector<String> params = cmdFilter.split(";");
-    int size = params.size();
-    for (int i = 0; i < size; i++)
-    {
-        size_t index = params[i].find("(");
-        if (index == notFound)
-            index = params[i].length();
-
-        String name = params[i].substring(0, index);
-        String value = params[i].substring(index + 1);
-        if (!value.isEmpty())
+        else
         {
-            size_t idx = value.reverseFind(")");
-            if (idx != notFound)
-                value = value.substring(0, idx);
+            m_paramMap.set(name, value);
         }
-        m_filterManager->addFilter(name, value.stripLeadingAndTrailingCharacters(isSingleQuotes));
     }
 }
 
@@ -54,8 +54,10 @@
 #include "NetworkLoadMetrics.h"
 #include "ProtectionSpace.h"
 #include "ResourceResponse.h"
+#include <wtf/Deque.h>
 #include <wtf/RunLoop.h>
 #include <wtf/glib/GRefPtr.h>
+#include <gio/gio.h>
 #include "CmdFilterManager.h"
 
 namespace PurCFetcher {
@@ -82,15 +84,45 @@ private:
 
     void dispatchDidCompleteWithError(const PurCFetcher::ResourceError&);
     void dispatchDidReceiveResponse();
+    void dispatchDidReceiveStreamResponse();
+    void buildResponseHeaders();
     void createRequest(PurCFetcher::ResourceRequest&&);
     void sendRequest();
 
+    String buildCommandLine();
     void runCmdInner();
     void runCmdOuter();
     void buildResponse();
+    void buildStatus(JSONWriter&);
+
+    // cmdstream=1: the filtered lines are sent as they are read
+    void streamLines(const char* data, size_t length);
+    void streamCompleteLines();
+    void finishStream();
+    void flushResponseBuffer();
+
+    void spawnCommand();
+    void read();
+    void didRead(gssize bytesRead);
+    void didFinishRead();
+    void didExitCommand();
+    void didFailCommand(int statusCode, const String& errorMsg);
+    void completeCommand();
+    void terminateCommand();
+    static void readCallback(GInputStream*, GAsyncResult*, NetworkDataTaskLcmd*);
+    static void waitCallback(GSubprocess*, GAsyncResult*, NetworkDataTaskLcmd*);
+
+    void timeoutFired();
+    void startTimeout();
+    void stopTimeout();
+
+    // At most maxRunningCommands commands run at once, the other tasks
+    // wait in pendingCommands() for a slot.
+    bool acquireCommandSlot();
+    void releaseCommandSlot();
+    static Deque<RefPtr<NetworkDataTaskLcmd>>& pendingCommands();
 
     void parseQueryString(String query);
-    void parseCmdFilter(String cmdFilter);
     String parseCmdLine(String cmdLine);
 private:
     State m_state { State::Suspended };
@@ -100,7 +132,18 @@ private:
     MonotonicTime m_startTime;
     PurCFetcher::NetworkLoadMetrics m_networkLoadMetrics;
     Vector<char> m_readBuffer;
+    CString m_command;
+    GRefPtr<GSubprocess> m_subprocess;
+    GRefPtr<GInputStream> m_inputStream;
+    GRefPtr<GCancellable> m_cancellable;
+    RunLoop::Timer<NetworkDataTaskLcmd> m_timeoutSource;
+    bool m_holdsCommandSlot { false };
+    bool m_streaming { false };
+    bool m_streamStarted { false };
+    size_t m_streamedLines { 0 };
     Vector<char> m_responseBuffer;
+    // keeps the state of the streamed response between the chunks
+    JSONWriter m_streamWriter { m_responseBuffer };
     Vector<String> m_readLines;
 
     String m_errorMsg;
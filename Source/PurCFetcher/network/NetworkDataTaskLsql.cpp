@@ -53,6 +53,7 @@
 #include <stdio.h>
 #include "NetworkDataTaskLsql.h"
 #include "FilterBase.h"
+#include "NetworkSQLWorkerPool.h"
 
 #include "AuthenticationChallengeDisposition.h"
 #include "AuthenticationManager.h"
@@ -72,13 +73,15 @@
 #include <wtf/glib/RunLoopSourcePriority.h>
 #include <sys/types.h>
 #include <unistd.h>
-#include "SQLiteStatement.h"
+#include "SQLiteStatementAutoResetScope.h"
 
 
 namespace PurCFetcher {
 using namespace PurCFetcher;
 
 #define  DEFAULT_READBUFFER_SIZE 8192
+#define  STREAM_CHUNK_SIZE 16384
+#define  MAX_PENDING_STREAM_CHUNKS 4
 
 extern const char* KEY_STATUS_CODE;
 extern const char* KEY_ERROR_MSG;
@@ -90,6 +93,7 @@ const char* KEY_ROWS = "rows";
 
 const char* CMD_SQL_QUERY = "sqlquery";
 const char* CMD_SQL_ROWFORMAT = "sqlRowFormat";
+const char* CMD_SQL_STREAM = "sqlstream";
 
 const char* FORMAT_DICT = "dict";
 const char* FORMAT_ARRAY = "array";
@@ -103,6 +107,7 @@ extern String decodeEscapeSequencesFromParsedURL(StringView input);
 
 NetworkDataTaskLsql::NetworkDataTaskLsql(NetworkSession& session, NetworkDataTaskClient& client, const ResourceRequest& requestWithCredentials, StoredCredentialsPolicy storedCredentialsPolicy, ContentSniffingPolicy shouldContentSniff, PurCFetcher::ContentEncodingSniffingPolicy, bool shouldClearReferrerOnHTTPSToHTTPRedirect, bool dataTaskIsForMainFrameNavigation)
     : NetworkDataTask(session, client, requestWithCredentials, storedCredentialsPolicy, shouldClearReferrerOnHTTPSToHTTPRedirect, dataTaskIsForMainFrameNavigation)
+    , m_timeoutSource(RunLoop::main(), this, &NetworkDataTaskLsql::timeoutFired)
     , m_formatArray(false)
 {
     UNUSED_PARAM(shouldContentSniff);
@@ -139,6 +144,12 @@ void NetworkDataTaskLsql::cancel()
         return;
 
     m_state = State::Canceling;
+    m_canceled = true;
+    stopTimeout();
+
+    // wake up a worker waiting to post a chunk
+    auto locker = holdLock(m_streamLock);
+    m_streamCondition.notifyAll();
 }
 
 void NetworkDataTaskLsql::resume()
@@ -159,6 +170,7 @@ void NetworkDataTaskLsql::resume()
 
 void NetworkDataTaskLsql::invalidateAndCancel()
 {
+    cancel();
 }
 
 NetworkDataTask::State NetworkDataTaskLsql::state() const
@@ -172,27 +184,52 @@ void NetworkDataTaskLsql::dispatchDidCompleteWithError(const ResourceError& erro
     m_networkLoadMetrics.markComplete();
 
     m_client->didCompleteWithError(error, m_networkLoadMetrics);
-    if (m_database.isOpen())
-        m_database.close();
 }
 
 void NetworkDataTaskLsql::dispatchDidReceiveResponse()
 {
-    if (m_database.isOpen())
-        m_database.close();
+    buildResponseHeaders();
+    m_response.setExpectedContentLength(m_responseBuffer.size());
+    m_response.setHTTPStatusCode(m_statusCode);
+
+    didReceiveResponse(ResourceResponse(m_response), NegotiatedLegacyTLS::No, [this, protectedThis = makeRef(*this)](PolicyAction policyAction) {
+        if (m_state == State::Canceling || m_state == State::Completed) {
+            return;
+        }
+
+        switch (policyAction) {
+        case PolicyAction::Use:
+            {
+                m_client->didReceiveData(SharedBuffer::create(WTFMove(m_responseBuffer)));
+                dispatchDidCompleteWithError({ });
+            }
+            break;
+
+        case PolicyAction::Ignore:
+        case PolicyAction::Download:
+        case PolicyAction::StopAllLoads:
+            break;
+        }
+    });
+}
+
+void NetworkDataTaskLsql::buildResponseHeaders()
+{
     m_networkLoadMetrics.responseStart = MonotonicTime::now() - m_startTime;
     m_response.setURL(m_currentRequest.url());
     const char* contentType = "application/json";
     m_response.setMimeType(extractMIMETypeFromMediaType(contentType));
     m_response.setTextEncodingName(extractCharsetFromMediaType(contentType));
-    m_response.setExpectedContentLength(m_responseBuffer.size());
     m_response.setHTTPHeaderField(HTTPHeaderName::AccessControlAllowOrigin, "*");
     m_response.setHTTPHeaderField(HTTPHeaderName::Expires, "-1");
     m_response.setHTTPHeaderField(HTTPHeaderName::CacheControl, "no-cache");
     m_response.setHTTPHeaderField(HTTPHeaderName::Pragma, "no-cache");
-    m_response.setHTTPStatusCode(m_statusCode);
-
+}
 
+void NetworkDataTaskLsql::dispatchDidReceiveStreamResponse()
+{
+    buildResponseHeaders();
+    m_response.setHTTPStatusCode(200);
 
     didReceiveResponse(ResourceResponse(m_response), NegotiatedLegacyTLS::No, [this, protectedThis = makeRef(*this)](PolicyAction policyAction) {
         if (m_state == State::Canceling || m_state == State::Completed) {
@@ -202,36 +239,93 @@ void NetworkDataTaskLsql::dispatchDidReceiveResponse()
         switch (policyAction) {
         case PolicyAction::Use:
             {
-                m_client->didReceiveData(SharedBuffer::create(WTFMove(m_responseBuffer)));
-                dispatchDidCompleteWithError({ });
+                m_responseBuffer.clear();
+                m_streamWriter.beginObject();
+                m_streamWriter.writeKey(KEY_ROWS);
+                m_streamWriter.beginArray();
+                runCmd();
             }
             break;
 
         case PolicyAction::Ignore:
         case PolicyAction::Download:
         case PolicyAction::StopAllLoads:
+            stopTimeout();
             break;
         }
     });
 }
 
-void NetworkDataTaskLsql::createRequest(PurCFetcher::ResourceRequest&& request)
+void NetworkDataTaskLsql::streamRow(const Vector<SQLValueH>& lineColumns, const Vector<String>& columnNames)
 {
-    m_currentRequest = WTFMove(request);
-    m_startTime = MonotonicTime::now();
+    if (!m_formatArray && m_streamKeys.isEmpty())
+    {
+        for (auto& name : columnNames)
+            m_streamKeys.append(JSONWriter::escapeKey(name));
+    }
+    writeRow(m_streamWriter, lineColumns, m_streamKeys);
+    m_streamedRows++;
+
+    if (m_responseBuffer.size() >= STREAM_CHUNK_SIZE)
+        flushStreamChunk();
 }
 
-void NetworkDataTaskLsql::sendRequest()
+void NetworkDataTaskLsql::flushStreamChunk()
 {
-    runCmdInner();
-    buildResponse();
-    dispatchDidReceiveResponse();
+    {
+        // keep the memory bounded when the rows come faster than they go
+        auto locker = holdLock(m_streamLock);
+        m_streamCondition.wait(m_streamLock, [this] {
+            return m_pendingChunks < MAX_PENDING_STREAM_CHUNKS || m_canceled;
+        });
+        m_pendingChunks++;
+    }
+
+    RunLoop::main().dispatch([this, protectedThis = makeRef(*this), chunk = WTFMove(m_responseBuffer)]() mutable {
+        {
+            auto locker = holdLock(m_streamLock);
+            m_pendingChunks--;
+            m_streamCondition.notifyOne();
+        }
+
+        if (m_state == State::Canceling || m_state == State::Completed || !m_client)
+            return;
+
+        m_client->didReceiveData(SharedBuffer::create(WTFMove(chunk)));
+    });
+    m_responseBuffer.clear();
 }
 
-void NetworkDataTaskLsql::runCmdInner()
+void NetworkDataTaskLsql::finishStream()
 {
-    String path = m_currentRequest.url().path().toString().stripWhiteSpace();
+    int statusCode = m_sqlResults.isEmpty() ? m_statusCode : m_sqlResults[0].statusCode;
+    const String& errorMsg = m_sqlResults.isEmpty() ? m_errorMsg : m_sqlResults[0].errorMsg;
+
+    // close the rows opened by dispatchDidReceiveStreamResponse()
+    m_streamWriter.endArray();
+    m_streamWriter.writeKey(KEY_STATUS_CODE);
+    m_streamWriter.writeInteger(statusCode);
+    m_streamWriter.writeKey(KEY_ERROR_MSG);
+    if (errorMsg.isEmpty())
+        m_streamWriter.writeNull();
+    else
+        m_streamWriter.writeString(errorMsg);
+    m_streamWriter.writeKey(KEY_ROWSAFFECTED);
+    m_streamWriter.writeInteger(m_streamedRows);
+    m_streamWriter.endObject();
+
+    m_client->didReceiveData(SharedBuffer::create(WTFMove(m_responseBuffer)));
+    dispatchDidCompleteWithError({ });
+}
 
+void NetworkDataTaskLsql::createRequest(PurCFetcher::ResourceRequest&& request)
+{
+    m_currentRequest = WTFMove(request);
+    m_startTime = MonotonicTime::now();
+}
+
+void NetworkDataTaskLsql::sendRequest()
+{
     if (m_currentRequest.url().hasQuery())
     {
         parseQueryString(m_currentRequest.url().query().toString());
@@ -241,68 +335,162 @@ void NetworkDataTaskLsql::runCmdInner()
         }
     }
 
-#if 0
-    if (m_currentRequest.url().hasFragment())
-        printf("......................Fragment=%s\n", m_currentRequest.url().fragmentIdentifier().utf8().data());
-#endif
+    // only a single SELECT is streamed, its status follows the rows
+    if (m_streaming)
+        m_streaming = m_sqlStatements.size() == 1 && m_sqlStatements[0].sql.startsWithIgnoringASCIICase(SELECT);
 
-    if (!SQLiteFileSystem::ensureDatabaseFileExists(path, false))
-    {
-#if 0
-        fprintf(stderr, " ################# DatabasePath %s not exists.", path.utf8().data());
-#endif
-        m_exitCode = 127;
-        m_statusCode = 404;
-        m_errorMsg = "Not Found";
+    startTimeout();
+    if (m_streaming)
+        dispatchDidReceiveStreamResponse();
+    else
+        runCmd();
+}
+
+void NetworkDataTaskLsql::runCmd()
+{
+    sqlWorkerPool().postTask([this, protectedThis = makeRef(*this)]() mutable {
+        if (!m_canceled) {
+            runCmdInner();
+            if (!m_streaming)
+                buildResponse();
+        }
+        if (m_connection) {
+            sqlite3_progress_handler(m_connection->database().sqlite3Handle(), 0, nullptr, nullptr);
+            SQLiteConnectionPool::singleton().giveBackConnection(WTFMove(m_connection));
+        }
+        RunLoop::main().dispatch([this, protectedThis = WTFMove(protectedThis)] {
+            didRunCmd();
+        });
+    });
+}
+
+void NetworkDataTaskLsql::didRunCmd()
+{
+    stopTimeout();
+    if (m_state == State::Canceling || m_state == State::Completed || !m_client)
         return;
-    }
 
-    if (!m_database.open(path)) {
+    if (m_streaming)
+        finishStream();
+    else
+        dispatchDidReceiveResponse();
+}
+
+void NetworkDataTaskLsql::timeoutFired()
+{
+    if (m_state == State::Canceling || m_state == State::Completed || !m_client)
+        return;
+
+    RefPtr<NetworkDataTaskLsql> protectedThis(this);
+    cancel();
+    dispatchDidCompleteWithError(ResourceError::timeoutError(m_currentRequest.url()));
+}
+
+void NetworkDataTaskLsql::startTimeout()
+{
+    if (m_currentRequest.timeoutInterval() > 0)
+        m_timeoutSource.startOneShot(1_s * m_currentRequest.timeoutInterval());
+}
+
+void NetworkDataTaskLsql::stopTimeout()
+{
+    m_timeoutSource.stop();
+}
+
+void NetworkDataTaskLsql::runCmdInner()
+{
+    String path = m_currentRequest.url().path().toString().stripWhiteSpace();
+
 #if 0
-        printf("Failed to open databasePath %s.", path.utf8().data());
+    if (m_currentRequest.url().hasFragment())
+        printf("......................Fragment=%s\n", m_currentRequest.url().fragmentIdentifier().utf8().data());
 #endif
+
+    m_connection = SQLiteConnectionPool::singleton().takeConnection(path, m_statusCode, m_errorMsg);
+    if (!m_connection) {
         m_exitCode = 127;
-        m_statusCode = 404;
-        m_errorMsg = "Failed to open database " + path + ".";
         return;
     }
-    m_database.disableThreadingChecks();
+    // let a cancel or a timeout abort a long running statement
+    sqlite3_progress_handler(m_connection->database().sqlite3Handle(), 1000, [](void* task) -> int {
+        return static_cast<NetworkDataTaskLsql*>(task)->m_canceled;
+    }, this);
 
     m_statusCode = 200;
 #if 1
-    int size = m_sqlVec.size();
-    for (int i = 0; i < size; i++)
+    int size = m_sqlStatements.size();
+    for (int i = 0; i < size && !m_canceled; i++)
     {
-        String& sql = m_sqlVec[i];
-        if (sql.startsWithIgnoringASCIICase(SELECT))
+        SqlStatement& statement = m_sqlStatements[i];
+        if (statement.sql.startsWithIgnoringASCIICase(SELECT))
         {
-            runSqlSelect(sql);
+            runSqlSelect(statement);
         }
-        else if (sql.startsWithIgnoringASCIICase(INSERT))
+        else if (statement.sql.startsWithIgnoringASCIICase(INSERT))
         {
-            runSqlInsert(sql);
+            runSqlInsert(statement);
         }
-        else if (sql.startsWithIgnoringASCIICase(UPDATE))
+        else if (statement.sql.startsWithIgnoringASCIICase(UPDATE))
         {
-            runSqlUpdate(sql);
+            runSqlUpdate(statement);
         }
-        else if (sql.startsWithIgnoringASCIICase(DELETE))
+        else if (statement.sql.startsWithIgnoringASCIICase(DELETE))
         {
-            runSqlDelete(sql);
+            runSqlDelete(statement);
         }
     }
 #endif
 
 }
 
-void NetworkDataTaskLsql::runSqlSelect(String sql)
+SQLiteStatement* NetworkDataTaskLsql::prepareStatement(const SqlStatement& sqlStatement)
 {
+    SQLiteStatement* statement = m_connection->statement(sqlStatement.sql);
+    if (!statement)
+        return nullptr;
+
+    int size = sqlStatement.parameters.size();
+    for (int i = 0; i < size; i++)
+    {
+        const SqlParameter& parameter = sqlStatement.parameters[i];
+        int index = i + 1;
+        int result;
+        if (parameter.isQuoted)
+            result = statement->bindText(index, parameter.value.isNull() ? emptyString() : parameter.value);
+        else if (parameter.value.isNull())
+            result = statement->bindNull(index);
+        else
+        {
+            bool isInteger = false;
+            bool isNumber = false;
+            int64_t integer = parameter.value.toInt64Strict(&isInteger);
+            double number = parameter.value.toDouble(&isNumber);
+            if (isInteger)
+                result = statement->bindInt64(index, integer);
+            else if (isNumber)
+                result = statement->bindDouble(index, number);
+            else
+                result = statement->bindText(index, parameter.value);
+        }
+
+        if (result != SQLITE_OK) {
+            statement->reset();
+            return nullptr;
+        }
+    }
+    return statement;
+}
+
+void NetworkDataTaskLsql::runSqlSelect(const SqlStatement& sqlStatement)
+{
+    const String& sql = sqlStatement.sql;
     if (sql.isEmpty())
         return;
 
     SqlResult sr;
-    SQLiteStatement statement(m_database, sql);
-    if (statement.prepare() != SQLITE_OK) {
+    // leaves the cached statement reset for the next task
+    SQLiteStatementAutoResetScope statement(prepareStatement(sqlStatement));
+    if (!statement) {
         sr.statusCode = 500;
         sr.errorMsg = "Failed to prepare : " + sql;
 #if 0
@@ -315,22 +503,22 @@ void NetworkDataTaskLsql::runSqlSelect(String sql)
     sr.statusCode = 200;
 
     int result;
-    while ((result = statement.step()) == SQLITE_ROW) {
-        int columnCount = statement.columnCount();
+    while ((result = statement->step()) == SQLITE_ROW) {
+        int columnCount = statement->columnCount();
         Vector<SQLValueH> columns;
         for (int i = 0; i < columnCount; i++)
         {
-            if ((int)m_sqlResultColumnNames.size() <= i)
-            {
-                String key = statement.getColumnName(i);
-                m_sqlResultColumnNames.append(key);
-            }
+            if ((int)sr.columnNames.size() <= i)
+                sr.columnNames.append(statement->getColumnName(i));
 
-            columns.append(statement.getColumnValueH(i));
+            columns.append(statement->getColumnValueH(i));
         }
-        sr.rowsVec.append(columns);
+        if (m_streaming)
+            streamRow(columns, sr.columnNames);
+        else
+            sr.rowsVec.append(columns);
 
-        if (m_state == State::Canceling)
+        if (m_canceled)
         {
             sr.statusCode = 503;
             sr.errorMsg = "Canceling";
@@ -338,7 +526,7 @@ void NetworkDataTaskLsql::runSqlSelect(String sql)
             return;
         }
     }
-    sr.rowsAffected = sr.rowsVec.size();
+    sr.rowsAffected = m_streaming ? m_streamedRows : sr.rowsVec.size();
 
     if (result != SQLITE_DONE)
     {
@@ -351,15 +539,15 @@ void NetworkDataTaskLsql::runSqlSelect(String sql)
     m_sqlResults.append(sr);
 }
 
-void NetworkDataTaskLsql::runSqlInsert(String sql)
+void NetworkDataTaskLsql::runSqlInsert(const SqlStatement& sqlStatement)
 {
+    const String& sql = sqlStatement.sql;
     if (sql.isEmpty())
         return;
 
     SqlResult sr;
-    SQLiteStatement statement(m_database, sql);
-    if (statement.prepare() != SQLITE_OK
-            || statement.step() != SQLITE_DONE) {
+    SQLiteStatementAutoResetScope statement(prepareStatement(sqlStatement));
+    if (!statement || statement->step() != SQLITE_DONE) {
         sr.statusCode = 500;
         sr.errorMsg = "Failed to prepare : " + sql;
 #if 0
@@ -370,19 +558,19 @@ void NetworkDataTaskLsql::runSqlInsert(String sql)
     }
 
     sr.statusCode = 200;
-    sr.rowsAffected = m_database.lastChanges();
+    sr.rowsAffected = m_connection->database().lastChanges();
     m_sqlResults.append(sr);
 }
 
-void NetworkDataTaskLsql::runSqlUpdate(String sql)
+void NetworkDataTaskLsql::runSqlUpdate(const SqlStatement& sqlStatement)
 {
+    const String& sql = sqlStatement.sql;
     if (sql.isEmpty())
         return;
 
     SqlResult sr;
-    SQLiteStatement statement(m_database, sql);
-    if (statement.prepare() != SQLITE_OK
-            || statement.step() != SQLITE_DONE) {
+    SQLiteStatementAutoResetScope statement(prepareStatement(sqlStatement));
+    if (!statement || statement->step() != SQLITE_DONE) {
         sr.statusCode = 500;
         sr.errorMsg = "Failed to prepare : " + sql;
 #if 0
@@ -393,19 +581,19 @@ void NetworkDataTaskLsql::runSqlUpdate(String sql)
     }
 
     sr.statusCode = 200;
-    sr.rowsAffected = m_database.lastChanges();
+    sr.rowsAffected = m_connection->database().lastChanges();
     m_sqlResults.append(sr);
 }
 
-void NetworkDataTaskLsql::runSqlDelete(String sql)
+void NetworkDataTaskLsql::runSqlDelete(const SqlStatement& sqlStatement)
 {
+    const String& sql = sqlStatement.sql;
     if (sql.isEmpty())
         return;
 
     SqlResult sr;
-    SQLiteStatement statement(m_database, sql);
-    if (statement.prepare() != SQLITE_OK
-            || statement.step() != SQLITE_DONE) {
+    SQLiteStatementAutoResetScope statement(prepareStatement(sqlStatement));
+    if (!statement || statement->step() != SQLITE_DONE) {
         sr.statusCode = 500;
         sr.errorMsg = "Failed to prepare : " + sql;
 #if 0
@@ -416,155 +604,121 @@ void NetworkDataTaskLsql::runSqlDelete(String sql)
     }
 
     sr.statusCode = 200;
-    sr.rowsAffected = m_database.lastChanges();
+    sr.rowsAffected = m_connection->database().lastChanges();
     m_sqlResults.append(sr);
 }
 
 void NetworkDataTaskLsql::buildResponse()
 {
-    auto result = JSON::Object::create();
+    m_responseBuffer.clear();
+    JSONWriter writer(m_responseBuffer);
+    writer.beginObject();
 
     int resultSize = m_sqlResults.size();
     switch (resultSize)
     {
     case 0:
         {
-            result->setInteger(KEY_STATUS_CODE, m_statusCode);
-
+            writer.writeKey(KEY_STATUS_CODE);
+            writer.writeInteger(m_statusCode);
+            writer.writeKey(KEY_ERROR_MSG);
             if (m_errorMsg.isEmpty())
-                result->setValue(KEY_ERROR_MSG, JSON::Value::null());
+                writer.writeNull();
             else
-                result->setString(KEY_ERROR_MSG, m_errorMsg);
-
-            result->setInteger(KEY_ROWSAFFECTED, m_readLines.size());
-            auto array = JSON::Array::create();
-            result->setArray(KEY_ROWS, WTFMove(array));
+                writer.writeString(m_errorMsg);
+            writer.writeKey(KEY_ROWSAFFECTED);
+            writer.writeInteger(m_readLines.size());
+            writer.writeKey(KEY_ROWS);
+            writer.beginArray();
+            writer.endArray();
         }
         break;
 
     case 1:
         {
-            SqlResult& sqlResult = m_sqlResults[0];
-            result->setInteger(KEY_STATUS_CODE, sqlResult.statusCode);
-            if (sqlResult.errorMsg.isEmpty())
-                result->setValue(KEY_ERROR_MSG, JSON::Value::null());
-            else
-                result->setString(KEY_ERROR_MSG, sqlResult.errorMsg);
-            result->setInteger(KEY_ROWSAFFECTED, sqlResult.rowsAffected);
-
-            int rowSize = sqlResult.rowsVec.size();
-            auto array = JSON::Array::create();
-            for (int i = 0; i < rowSize; i++)
-            {
-                if (m_formatArray)
-                {
-                    array->pushValue(formatAsArray(sqlResult.rowsVec[i]));
-                }
-                else
-                {
-                    array->pushValue(formatAsDict(sqlResult.rowsVec[i]));
-                }
-            }
-            result->setArray(KEY_ROWS, WTFMove(array));
+            writer.writeKey(KEY_STATUS_CODE);
+            writer.writeInteger(m_sqlResults[0].statusCode);
+            writeResult(writer, m_sqlResults[0]);
         }
         break;
 
     default:
         {
-            result->setInteger(KEY_STATUS_CODE, 200);
-            auto resultArray = JSON::Array::create();
-            for (int j = 0; j < resultSize; j++)
+            writer.writeKey(KEY_STATUS_CODE);
+            writer.writeInteger(200);
+            writer.writeKey(KEY_RESULT);
+            writer.beginArray();
+            for (auto& sqlResult : m_sqlResults)
             {
-                SqlResult& sqlResult = m_sqlResults[j];
-                auto res = JSON::Object::create();
-
-                if (sqlResult.errorMsg.isEmpty())
-                    res->setValue(KEY_ERROR_MSG, JSON::Value::null());
-                else
-                    res->setString(KEY_ERROR_MSG, sqlResult.errorMsg);
-                res->setInteger(KEY_ROWSAFFECTED, sqlResult.rowsAffected);
-
-                int rowSize = sqlResult.rowsVec.size();
-                auto array = JSON::Array::create();
-                for (int i = 0; i < rowSize; i++)
-                {
-                    if (m_formatArray)
-                    {
-                        array->pushValue(formatAsArray(sqlResult.rowsVec[i]));
-                    }
-                    else
-                    {
-                        array->pushValue(formatAsDict(sqlResult.rowsVec[i]));
-                    }
-                }
-                res->setArray(KEY_ROWS, WTFMove(array));
-                resultArray->pushObject(WTFMove(res));
+                writer.beginObject();
+                writeResult(writer, sqlResult);
+                writer.endObject();
             }
-            result->setArray(KEY_RESULT, WTFMove(resultArray));
+            writer.endArray();
         }
         break;
     }
 
-    String json = result->toJSONString();
-
-    m_responseBuffer.clear();
-    m_responseBuffer.append(json.characters8(), json.length());
+    writer.endObject();
 }
 
-Ref<JSON::Value> NetworkDataTaskLsql::formatAsArray(Vector<SQLValueH>& lineColumns)
+void NetworkDataTaskLsql::writeResult(JSONWriter& writer, const SqlResult& sqlResult)
 {
-    auto array = JSON::Array::create();
-    if (lineColumns.size() == 0)
-        return array;
-
-    int size = lineColumns.size();
-    for (int i = 0; i < size; i++)
+    writer.writeKey(KEY_ERROR_MSG);
+    if (sqlResult.errorMsg.isEmpty())
+        writer.writeNull();
+    else
+        writer.writeString(sqlResult.errorMsg);
+    writer.writeKey(KEY_ROWSAFFECTED);
+    writer.writeInteger(sqlResult.rowsAffected);
+
+    // the column names are escaped once for all the rows of the result
+    Vector<CString> keys;
+    if (!m_formatArray)
     {
-        SQLValueH value = lineColumns[i];
-        if (WTF::holds_alternative<String>(value))
-        {
-            array->pushString(WTF::get<String>(value));
-        }
-        else if (WTF::holds_alternative<double>(value))
-        {
-            array->pushDouble(WTF::get<double>(value));
-        }
-        else if (WTF::holds_alternative<int>(value))
-        {
-            array->pushInteger(WTF::get<int>(value));
-        }
-        else
-            array->pushValue(JSON::Value::null());
+        for (auto& name : sqlResult.columnNames)
+            keys.append(JSONWriter::escapeKey(name));
     }
-    return array;
+
+    writer.writeKey(KEY_ROWS);
+    writer.beginArray();
+    for (auto& row : sqlResult.rowsVec)
+        writeRow(writer, row, keys);
+    writer.endArray();
 }
 
-Ref<JSON::Value> NetworkDataTaskLsql::formatAsDict(Vector<SQLValueH>& lineColumns)
+void NetworkDataTaskLsql::writeRow(JSONWriter& writer, const Vector<SQLValueH>& lineColumns, const Vector<CString>& keys)
 {
-    auto result = JSON::Object::create();
-    if (lineColumns.size() == 0)
-        return result;
+    if (m_formatArray)
+        writer.beginArray();
+    else
+        writer.beginObject();
 
     int size = lineColumns.size();
     for (int i = 0; i < size; i++)
     {
-        SQLValueH value = lineColumns[i];
-        if (WTF::holds_alternative<String>(value))
+        if (!m_formatArray)
         {
-            result->setString(m_sqlResultColumnNames[i], WTF::get<String>(value));
+            if (i >= (int)keys.size())
+                break;
+            writer.writeEscapedKey(keys[i]);
         }
+
+        const SQLValueH& value = lineColumns[i];
+        if (WTF::holds_alternative<String>(value))
+            writer.writeString(WTF::get<String>(value));
         else if (WTF::holds_alternative<double>(value))
-        {
-            result->setDouble(m_sqlResultColumnNames[i], WTF::get<double>(value));
-        }
+            writer.writeDouble(WTF::get<double>(value));
         else if (WTF::holds_alternative<int>(value))
-        {
-            result->setInteger(m_sqlResultColumnNames[i], WTF::get<int>(value));
-        }
+            writer.writeInteger(WTF::get<int>(value));
         else
-            result->setValue(m_sqlResultColumnNames[i], JSON::Value::null());
+            writer.writeNull();
     }
-    return result;
+
+    if (m_formatArray)
+        writer.endArray();
+    else
+        writer.endObject();
 }
 
 void NetworkDataTaskLsql::parseQueryString(String query)
@@ -592,6 +746,10 @@ void NetworkDataTaskLsql::parseQueryString(String query)
         {
             m_formatArray = equalIgnoringASCIICase(value, FORMAT_ARRAY);
         }
+        else if (equalIgnoringASCIICase(name, CMD_SQL_STREAM))
+        {
+            m_streaming = !value.isEmpty() && value != "0" && !equalIgnoringASCIICase(value, "false");
+        }
         else
         {
             m_paramMap.set(name, value);
@@ -608,105 +766,152 @@ void NetworkDataTaskLsql::parseSqlQuery(String sqlQuery)
     int size = params.size();
     for (int i = 0; i < size; i++)
     {
-        StringBuilder sqlSb;
         String param = params[i].stripWhiteSpace();
+        if (!param.isEmpty())
+            m_sqlStatements.append(parseSqlStatement(param));
+    }
+}
 
-        size_t start = param.find('$');
-        if (start == notFound)
+// Returns the end of the name of the $name parameter at index, or index if
+// the '$' is not followed by a name.
+static unsigned parameterNameEnd(const String& text, unsigned index)
+{
+    unsigned length = text.length();
+    unsigned end = index + 1;
+    if (end >= length || !isASCIIAlpha(text[end]))
+        return index;
+
+    while (end < length && (isASCIIAlphanumeric(text[end]) || text[end] == '_'))
+        end++;
+    return end;
+}
+
+// The parameters of the query string are bound to the statement instead of
+// being spliced into its text, so a value can not change what the statement
+// does, and the same statement with other values hits the statement cache.
+// A $name parameter becomes a ? placeholder, and $$ stands for a '$'.
+SqlStatement NetworkDataTaskLsql::parseSqlStatement(const String& text)
+{
+    SqlStatement statement;
+    StringBuilder sql;
+    unsigned length = text.length();
+    unsigned i = 0;
+    while (i < length)
+    {
+        UChar c = text[i];
+        if (c == '\'')
         {
-            m_sqlVec.append(param);
+            i = parseQuotedLiteral(text, i, sql, statement.parameters);
             continue;
         }
 
-        size_t paramLength = param.length();
-        size_t end = start + 1;
-        sqlSb.append(param.substring(0, start - 0));
-        while ((start != notFound) && (end < paramLength))
+        if (c == '$' && i + 1 < length && text[i + 1] == '$')
         {
-            if (param[end] == '$' )
-            {
-                sqlSb.append("$");
-
-                start = param.find('$', end + 1);
-                if (start != notFound)
-                {
-                    sqlSb.append(param.substring(end+1, start - end - 1));
-                }
-                else
-                {
-                    sqlSb.append(param.substring(end+1));
-                }
-
-                end = start + 1;
-                continue;
-            }
+            sql.append('$');
+            i += 2;
+            continue;
+        }
 
-            if (!((param[end] >= 'a' && param[end] <= 'z')
-                        || (param[end] >= 'A' && param[end] <= 'Z')
-                        ))
-            {
-                sqlSb.append(param.substring(start, 2));
-                start = param.find('$', end + 1);
-                if (start != notFound)
-                {
-                    sqlSb.append(param.substring(end + 1, start - end - 1));
-                }
-                else
-                {
-                    sqlSb.append(param.substring(end + 1));
-                }
-                end = start + 1;
-                continue;
-            }
+        unsigned end = c == '$' ? parameterNameEnd(text, i) : i;
+        if (end == i)
+        {
+            sql.append(c);
+            i++;
+            continue;
+        }
 
-#if 0
-            if (param[end] >= '0' and param[end] <= '9')
-            {
-            }
-#endif
+        sql.append('?');
+        statement.parameters.append({ m_paramMap.get(text.substring(i + 1, end - i - 1)), false });
+        i = end;
+    }
 
-            StringBuilder sb;
-            for (;end < paramLength; end++)
-            {
-                if ((param[end] >= '0' && param[end] <= '9')
-                    || (param[end] >= 'a' && param[end] <= 'z')
-                    || (param[end] >= 'A' && param[end] <= 'Z')
-                    || (param[end] == '_'))
-                {
-                    sb.append(param[end]);
-                }
-                else
-                {
-                    break;
-                }
-            }
+    statement.sql = sql.toString();
+    return statement;
+}
 
-            auto findResult = m_paramMap.find(sb.toString());
-            if(findResult != m_paramMap.end())
+// Parses the literal starting with the quote at start and returns its end.
+// A literal holding only a parameter, '$name', becomes a placeholder bound
+// as text; parameters inside a longer literal turn it into a concatenation,
+// e.g. '%$name%' becomes ('%' || ? || '%').
+unsigned NetworkDataTaskLsql::parseQuotedLiteral(const String& text, unsigned start, StringBuilder& sql, Vector<SqlParameter>& parameters)
+{
+    Vector<String> pieces;
+    Vector<SqlParameter> literalParameters;
+    StringBuilder piece;
+    bool hasText = false;
+    unsigned length = text.length();
+    unsigned i = start + 1;
+    while (i < length)
+    {
+        UChar c = text[i];
+        if (c == '\'')
+        {
+            if (i + 1 < length && text[i + 1] == '\'')
             {
-                sqlSb.append(findResult->value);
+                piece.append("''");
+                hasText = true;
+                i += 2;
+                continue;
             }
+            break;
+        }
 
-            if (end < paramLength)
-            {
-                start = param.find('$', end);
-                if (start != notFound)
-                {
-                    sqlSb.append(param.substring(end, start - end));
-                }
-                else
-                {
-                    sqlSb.append(param.substring(end));
-                }
-                end = start + 1;
-            }
+        if (c == '$' && i + 1 < length && text[i + 1] == '$')
+        {
+            piece.append('$');
+            hasText = true;
+            i += 2;
+            continue;
+        }
+
+        unsigned end = c == '$' ? parameterNameEnd(text, i) : i;
+        if (end == i)
+        {
+            piece.append(c);
+            hasText = true;
+            i++;
+            continue;
         }
 
-        if (!sqlSb.isEmpty())
+        pieces.append(piece.toString());
+        piece.clear();
+        literalParameters.append({ m_paramMap.get(text.substring(i + 1, end - i - 1)), true });
+        i = end;
+    }
+
+    if (i >= length)
+    {
+        // not terminated, leave it to the SQL parser to complain
+        sql.append(text.substring(start));
+        return length;
+    }
+
+    pieces.append(piece.toString());
+    if (literalParameters.isEmpty())
+    {
+        sql.append('\'', pieces[0], '\'');
+        return i + 1;
+    }
+
+    if (!hasText && literalParameters.size() == 1)
+    {
+        sql.append('?');
+        parameters.append(WTFMove(literalParameters[0]));
+        return i + 1;
+    }
+
+    sql.append('(');
+    for (size_t j = 0; j < pieces.size(); j++)
+    {
+        if (j)
         {
-            m_sqlVec.append(sqlSb.toString());
+            sql.append(" || ? || ");
+            parameters.append(WTFMove(literalParameters[j - 1]));
         }
+        sql.append('\'', pieces[j], '\'');
     }
+    sql.append(')');
+    return i + 1;
 }
 
 } // namespace PurCFetcher
@@ -54,11 +54,14 @@
 #include "NetworkLoadMetrics.h"
 #include "ProtectionSpace.h"
 #include "ResourceResponse.h"
-#include "SQLiteDatabase.h"
-#include "SQLiteFileSystem.h"
+#include "SQLiteConnectionPool.h"
 #include "SQLValue.h"
+#include <wtf/Condition.h>
+#include <wtf/Lock.h>
 #include <wtf/RunLoop.h>
+#include <atomic>
 #include <wtf/glib/GRefPtr.h>
+#include <wtf/text/StringBuilder.h>
 #include "CmdFilterManager.h"
 
 namespace PurCFetcher {
@@ -66,12 +69,25 @@ using PurCFetcher::SQLValueH;
 
 class SqlResult {
 public:
-    int statusCode;
+    int statusCode { 0 };
     String errorMsg;
-    int rowsAffected;
+    int rowsAffected { 0 };
+    Vector<String> columnNames;
     Vector<Vector<SQLValueH>> rowsVec;
 };
 
+// A value from the query string bound to a ? placeholder. A quoted one is
+// always bound as text, the others as a number when they look like one.
+struct SqlParameter {
+    String value;
+    bool isQuoted;
+};
+
+struct SqlStatement {
+    String sql;
+    Vector<SqlParameter> parameters;
+};
+
 class NetworkDataTaskLsql final : public NetworkDataTask {
 public:
     static Ref<NetworkDataTask> create(NetworkSession& session, NetworkDataTaskClient& client, const PurCFetcher::ResourceRequest& request, PurCFetcher::StoredCredentialsPolicy storedCredentialsPolicy, PurCFetcher::ContentSniffingPolicy shouldContentSniff, PurCFetcher::ContentEncodingSniffingPolicy shouldContentEncodingSniff, bool shouldClearReferrerOnHTTPSToHTTPRedirect, bool dataTaskIsForMainFrameNavigation)
@@ -96,23 +112,43 @@ private:
     void dispatchDidReceiveResponse();
     void createRequest(PurCFetcher::ResourceRequest&&);
     void sendRequest();
+    void runCmd();
+    void didRunCmd();
+    void buildResponseHeaders();
 
+    // sqlstream=1: the rows of a single SELECT are sent as they are read
+    void dispatchDidReceiveStreamResponse();
+    void streamRow(const Vector<SQLValueH>& lineColumns, const Vector<String>& columnNames);
+    void flushStreamChunk();
+    void finishStream();
+
+    void startTimeout();
+    void stopTimeout();
+    void timeoutFired();
+
+    // Runs on a thread of the SQL worker pool.
     void runCmdInner();
 
-    void runSqlSelect(String sql);
-    void runSqlInsert(String sql);
-    void runSqlUpdate(String sql);
-    void runSqlDelete(String sql);
+    SQLiteStatement* prepareStatement(const SqlStatement&);
+    void runSqlSelect(const SqlStatement&);
+    void runSqlInsert(const SqlStatement&);
+    void runSqlUpdate(const SqlStatement&);
+    void runSqlDelete(const SqlStatement&);
 
     void buildResponse();
 
     void parseQueryString(String query);
     void parseSqlQuery(String sqlQuery);
+    SqlStatement parseSqlStatement(const String&);
+    unsigned parseQuotedLiteral(const String&, unsigned start, StringBuilder& sql, Vector<SqlParameter>&);
 
-    Ref<JSON::Value> formatAsArray(Vector<SQLValueH>& lineColumns);
-    Ref<JSON::Value> formatAsDict(Vector<SQLValueH>& lineColumns);
+    void writeResult(JSONWriter&, const SqlResult&);
+    void writeRow(JSONWriter&, const Vector<SQLValueH>& lineColumns, const Vector<CString>& keys);
 private:
     State m_state { State::Suspended };
+    // Read by the worker running the statements, set on the main thread.
+    std::atomic<bool> m_canceled { false };
+    RunLoop::Timer<NetworkDataTaskLsql> m_timeoutSource;
     PurCFetcher::ResourceRequest m_currentRequest;
     PurCFetcher::ResourceResponse m_response;
 
@@ -120,6 +156,7 @@ private:
     PurCFetcher::NetworkLoadMetrics m_networkLoadMetrics;
     Vector<char> m_readBuffer;
     Vector<char> m_responseBuffer;
+    JSONWriter m_streamWriter { m_responseBuffer };
     Vector<String> m_readLines;
 
     String m_errorMsg;
@@ -128,13 +165,20 @@ private:
 
     HashMap<String, String> m_paramMap;
 
-    PurCFetcher::SQLiteDatabase m_database;
-    Vector<String> m_sqlVec;
-    Vector<String> m_sqlResultColumnNames;
+    std::unique_ptr<SQLiteConnection> m_connection;
+    Vector<SqlStatement> m_sqlStatements;
     Vector<SqlResult> m_sqlResults;
 
     bool m_formatArray;
     String m_sqlQuery;
+
+    bool m_streaming { false };
+    size_t m_streamedRows { 0 };
+    Vector<CString> m_streamKeys;
+    // bounds the chunks posted by the worker and not sent yet
+    Lock m_streamLock;
+    Condition m_streamCondition;
+    unsigned m_pendingChunks { 0 };
 };
 
 } // namespace PurCFetcher
@@ -54,6 +54,7 @@
 #include "NetworkDataTaskLsql.h"
 #include "NetworkDataTaskRsql.h"
 #include "FilterBase.h"
+#include "NetworkSQLWorkerPool.h"
 
 #include "AuthenticationChallengeDisposition.h"
 #include "AuthenticationManager.h"
@@ -70,9 +71,12 @@
 #include "SharedBuffer.h"
 #include "TextEncoding.h"
 #include <wtf/MainThread.h>
+#include <wtf/NeverDestroyed.h>
+#include <wtf/WorkQueue.h>
 #include <wtf/glib/RunLoopSourcePriority.h>
 #include <sys/types.h>
 #include <unistd.h>
+#include <mysql/errmsg.h>
 #include "SQLiteStatement.h"
 
 
@@ -80,6 +84,8 @@ namespace PurCFetcher {
 using namespace PurCFetcher;
 
 #define  DEFAULT_READBUFFER_SIZE 8192
+#define  STREAM_CHUNK_SIZE 16384
+#define  MAX_PENDING_STREAM_CHUNKS 4
 
 extern const char* KEY_STATUS_CODE;
 extern const char* KEY_ERROR_MSG;
@@ -91,6 +97,7 @@ extern const char* KEY_ROWS;
 
 extern const char* CMD_SQL_QUERY;
 extern const char* CMD_SQL_ROWFORMAT;
+extern const char* CMD_SQL_STREAM;
 
 extern const char* FORMAT_DICT;
 extern const char* FORMAT_ARRAY;
@@ -104,6 +111,7 @@ extern String decodeEscapeSequencesFromParsedURL(StringView input);
 
 NetworkDataTaskRsql::NetworkDataTaskRsql(NetworkSession& session, NetworkDataTaskClient& client, const ResourceRequest& requestWithCredentials, StoredCredentialsPolicy storedCredentialsPolicy, ContentSniffingPolicy shouldContentSniff, PurCFetcher::ContentEncodingSniffingPolicy, bool shouldClearReferrerOnHTTPSToHTTPRedirect, bool dataTaskIsForMainFrameNavigation)
     : NetworkDataTask(session, client, requestWithCredentials, storedCredentialsPolicy, shouldClearReferrerOnHTTPSToHTTPRedirect, dataTaskIsForMainFrameNavigation)
+    , m_timeoutSource(RunLoop::main(), this, &NetworkDataTaskRsql::timeoutFired)
     , m_formatArray(false)
 {
     UNUSED_PARAM(shouldContentSniff);
@@ -140,6 +148,13 @@ void NetworkDataTaskRsql::cancel()
         return;
 
     m_state = State::Canceling;
+    m_canceled = true;
+    stopTimeout();
+    killRunningQuery();
+
+    // wake up a worker waiting to post a chunk
+    auto locker = holdLock(m_streamLock);
+    m_streamCondition.notifyAll();
 }
 
 void NetworkDataTaskRsql::resume()
@@ -160,6 +175,7 @@ void NetworkDataTaskRsql::resume()
 
 void NetworkDataTaskRsql::invalidateAndCancel()
 {
+    cancel();
 }
 
 NetworkDataTask::State NetworkDataTaskRsql::state() const
@@ -176,18 +192,49 @@ void NetworkDataTaskRsql::dispatchDidCompleteWithError(const ResourceError& erro
 }
 
 void NetworkDataTaskRsql::dispatchDidReceiveResponse()
+{
+    buildResponseHeaders();
+    m_response.setExpectedContentLength(m_responseBuffer.size());
+    m_response.setHTTPStatusCode(m_statusCode);
+
+    didReceiveResponse(ResourceResponse(m_response), NegotiatedLegacyTLS::No, [this, protectedThis = makeRef(*this)](PolicyAction policyAction) {
+        if (m_state == State::Canceling || m_state == State::Completed) {
+            return;
+        }
+
+        switch (policyAction) {
+        case PolicyAction::Use:
+            {
+                m_client->didReceiveData(SharedBuffer::create(WTFMove(m_responseBuffer)));
+                dispatchDidCompleteWithError({ });
+            }
+            break;
+
+        case PolicyAction::Ignore:
+        case PolicyAction::Download:
+        case PolicyAction::StopAllLoads:
+            break;
+        }
+    });
+}
+
+void NetworkDataTaskRsql::buildResponseHeaders()
 {
     m_networkLoadMetrics.responseStart = MonotonicTime::now() - m_startTime;
     m_response.setURL(m_currentRequest.url());
     const char* contentType = "application/json";
     m_response.setMimeType(extractMIMETypeFromMediaType(contentType));
     m_response.setTextEncodingName(extractCharsetFromMediaType(contentType));
-    m_response.setExpectedContentLength(m_responseBuffer.size());
     m_response.setHTTPHeaderField(HTTPHeaderName::AccessControlAllowOrigin, "*");
     m_response.setHTTPHeaderField(HTTPHeaderName::Expires, "-1");
     m_response.setHTTPHeaderField(HTTPHeaderName::CacheControl, "no-cache");
     m_response.setHTTPHeaderField(HTTPHeaderName::Pragma, "no-cache");
-    m_response.setHTTPStatusCode(m_statusCode);
+}
+
+void NetworkDataTaskRsql::dispatchDidReceiveStreamResponse()
+{
+    buildResponseHeaders();
+    m_response.setHTTPStatusCode(200);
 
     didReceiveResponse(ResourceResponse(m_response), NegotiatedLegacyTLS::No, [this, protectedThis = makeRef(*this)](PolicyAction policyAction) {
         if (m_state == State::Canceling || m_state == State::Completed) {
@@ -197,36 +244,93 @@ void NetworkDataTaskRsql::dispatchDidReceiveResponse()
         switch (policyAction) {
         case PolicyAction::Use:
             {
-                m_client->didReceiveData(SharedBuffer::create(WTFMove(m_responseBuffer)));
-                dispatchDidCompleteWithError({ });
+                m_responseBuffer.clear();
+                m_streamWriter.beginObject();
+                m_streamWriter.writeKey(KEY_ROWS);
+                m_streamWriter.beginArray();
+                runCmd();
             }
             break;
 
         case PolicyAction::Ignore:
         case PolicyAction::Download:
         case PolicyAction::StopAllLoads:
+            stopTimeout();
             break;
         }
     });
 }
 
-void NetworkDataTaskRsql::createRequest(PurCFetcher::ResourceRequest&& request)
+void NetworkDataTaskRsql::streamRow(const Vector<SQLValueH>& lineColumns, const Vector<String>& columnNames)
 {
-    m_currentRequest = WTFMove(request);
-    m_startTime = MonotonicTime::now();
+    if (!m_formatArray && m_streamKeys.isEmpty())
+    {
+        for (auto& name : columnNames)
+            m_streamKeys.append(JSONWriter::escapeKey(name));
+    }
+    writeRow(m_streamWriter, lineColumns, m_streamKeys);
+    m_streamedRows++;
+
+    if (m_responseBuffer.size() >= STREAM_CHUNK_SIZE)
+        flushStreamChunk();
 }
 
-void NetworkDataTaskRsql::sendRequest()
+void NetworkDataTaskRsql::flushStreamChunk()
 {
-    runCmdInner();
-    buildResponse();
-    dispatchDidReceiveResponse();
+    {
+        // keep the memory bounded when the rows come faster than they go
+        auto locker = holdLock(m_streamLock);
+        m_streamCondition.wait(m_streamLock, [this] {
+            return m_pendingChunks < MAX_PENDING_STREAM_CHUNKS || m_canceled;
+        });
+        m_pendingChunks++;
+    }
+
+    RunLoop::main().dispatch([this, protectedThis = makeRef(*this), chunk = WTFMove(m_responseBuffer)]() mutable {
+        {
+            auto locker = holdLock(m_streamLock);
+            m_pendingChunks--;
+            m_streamCondition.notifyOne();
+        }
+
+        if (m_state == State::Canceling || m_state == State::Completed || !m_client)
+            return;
+
+        m_client->didReceiveData(SharedBuffer::create(WTFMove(chunk)));
+    });
+    m_responseBuffer.clear();
 }
 
-void NetworkDataTaskRsql::runCmdInner()
+void NetworkDataTaskRsql::finishStream()
 {
-    String path = m_currentRequest.url().path().toString().stripWhiteSpace();
+    int statusCode = m_sqlResults.isEmpty() ? m_statusCode : m_sqlResults[0].statusCode;
+    const String& errorMsg = m_sqlResults.isEmpty() ? m_errorMsg : m_sqlResults[0].errorMsg;
+
+    // close the rows opened by dispatchDidReceiveStreamResponse()
+    m_streamWriter.endArray();
+    m_streamWriter.writeKey(KEY_STATUS_CODE);
+    m_streamWriter.writeInteger(statusCode);
+    m_streamWriter.writeKey(KEY_ERROR_MSG);
+    if (errorMsg.isEmpty())
+        m_streamWriter.writeNull();
+    else
+        m_streamWriter.writeString(errorMsg);
+    m_streamWriter.writeKey(KEY_ROWSAFFECTED);
+    m_streamWriter.writeInteger(m_streamedRows);
+    m_streamWriter.endObject();
+
+    m_client->didReceiveData(SharedBuffer::create(WTFMove(m_responseBuffer)));
+    dispatchDidCompleteWithError({ });
+}
 
+void NetworkDataTaskRsql::createRequest(PurCFetcher::ResourceRequest&& request)
+{
+    m_currentRequest = WTFMove(request);
+    m_startTime = MonotonicTime::now();
+}
+
+void NetworkDataTaskRsql::sendRequest()
+{
     if (m_currentRequest.url().hasQuery())
     {
         parseQueryString(m_currentRequest.url().query().toString());
@@ -236,6 +340,97 @@ void NetworkDataTaskRsql::runCmdInner()
         }
     }
 
+    // only a single SELECT is streamed, its status follows the rows
+    if (m_streaming)
+        m_streaming = m_sqlVec.size() == 1 && m_sqlVec[0].startsWithIgnoringASCIICase(SELECT);
+
+    startTimeout();
+    if (m_streaming)
+        dispatchDidReceiveStreamResponse();
+    else
+        runCmd();
+}
+
+void NetworkDataTaskRsql::runCmd()
+{
+    sqlWorkerPool().postTask([this, protectedThis = makeRef(*this)]() mutable {
+        if (!m_canceled) {
+            runCmdInner();
+            if (!m_streaming)
+                buildResponse();
+        }
+        if (m_connection) {
+            // keep the connection unless the server went away under us
+            unsigned error = mysql_errno(m_mysql);
+            bool reusable = error != CR_SERVER_GONE_ERROR && error != CR_SERVER_LOST;
+            {
+                auto locker = holdLock(m_queryLock);
+                m_queryThreadId = 0;
+            }
+            m_mysql = nullptr;
+            MySQLConnectionPool::singleton().giveBackConnection(WTFMove(m_connection), reusable);
+        }
+        RunLoop::main().dispatch([this, protectedThis = WTFMove(protectedThis)] {
+            didRunCmd();
+        });
+    });
+}
+
+void NetworkDataTaskRsql::didRunCmd()
+{
+    stopTimeout();
+    if (m_state == State::Canceling || m_state == State::Completed || !m_client)
+        return;
+
+    if (m_streaming)
+        finishStream();
+    else
+        dispatchDidReceiveResponse();
+}
+
+void NetworkDataTaskRsql::timeoutFired()
+{
+    if (m_state == State::Canceling || m_state == State::Completed || !m_client)
+        return;
+
+    RefPtr<NetworkDataTaskRsql> protectedThis(this);
+    cancel();
+    dispatchDidCompleteWithError(ResourceError::timeoutError(m_currentRequest.url()));
+}
+
+static WorkQueue& killQueryQueue()
+{
+    static NeverDestroyed<Ref<WorkQueue>> queue(WorkQueue::create("com.apple.PurCFetcher.RsqlKillQuery", WorkQueue::Type::Concurrent));
+    return queue.get();
+}
+
+void NetworkDataTaskRsql::killRunningQuery()
+{
+    // A statement in mysql_real_query() or a fetch does not look at
+    // m_canceled, and holds a thread of the SQL worker pool until the
+    // server answers. Have the server stop it.
+    killQueryQueue().dispatch([this, protectedThis = makeRef(*this)] {
+        auto locker = holdLock(m_queryLock);
+        if (m_queryThreadId)
+            MySQLConnectionPool::singleton().killQuery(m_queryParameters, m_queryThreadId);
+    });
+}
+
+void NetworkDataTaskRsql::startTimeout()
+{
+    if (m_currentRequest.timeoutInterval() > 0)
+        m_timeoutSource.startOneShot(1_s * m_currentRequest.timeoutInterval());
+}
+
+void NetworkDataTaskRsql::stopTimeout()
+{
+    m_timeoutSource.stop();
+}
+
+void NetworkDataTaskRsql::runCmdInner()
+{
+    String path = m_currentRequest.url().path().toString().stripWhiteSpace();
+
 #if 0
     if (m_currentRequest.url().hasFragment())
         printf("......................Fragment=%s\n", m_currentRequest.url().fragmentIdentifier().utf8().data());
@@ -271,23 +466,24 @@ void NetworkDataTaskRsql::runCmdInner()
     printf("......................dbName=%s\n", dbName.characters8());
 #endif
 
-    mysql_init(&m_mysql);
-
-    if (!mysql_real_connect(&m_mysql, server.utf8().data(), user.utf8().data(), pass.utf8().data(), dbName.utf8().data(), port, NULL, 0))
+    MySQLConnectionPool::Parameters parameters { server, port, user, pass, dbName, 1_s * m_currentRequest.timeoutInterval() };
+    m_connection = MySQLConnectionPool::singleton().takeConnection(parameters, m_errorMsg);
+    if (!m_connection)
     {
         m_exitCode = 127;
         m_statusCode = 404;
-        StringBuilder sb;
-        sb.append("Failed to connect to database:");
-        sb.append(mysql_error(&m_mysql));
-        m_errorMsg = sb.toString();
-//        printf("Failed to connect to database: %s\n", m_errorMsg.characters8());
         return;
     }
+    m_mysql = m_connection->handle();
+    {
+        auto locker = holdLock(m_queryLock);
+        m_queryThreadId = mysql_thread_id(m_mysql);
+        m_queryParameters = { parameters.host.isolatedCopy(), parameters.port, parameters.user.isolatedCopy(), parameters.password.isolatedCopy(), parameters.database.isolatedCopy(), parameters.timeout };
+    }
 
     m_statusCode = 200;
     int size = m_sqlVec.size();
-    for (int i = 0; i < size; i++)
+    for (int i = 0; i < size && !m_canceled; i++)
     {
         String& sql = m_sqlVec[i];
         if (sql.startsWithIgnoringASCIICase(SELECT))
@@ -316,13 +512,13 @@ void NetworkDataTaskRsql::runSqlSelect(String sql)
 
     SqlResult sr;
     CString cmd = sql.utf8();
-    if (mysql_real_query(&m_mysql, cmd.data(), cmd.length()))
+    if (mysql_real_query(m_mysql, cmd.data(), cmd.length()))
     {
         StringBuilder sb;
         sb.append("Failed to query : ");
         sb.append(sql);
         sb.append(". Error : ");
-        sb.append(mysql_error(&m_mysql));
+        sb.append(mysql_error(m_mysql));
 
         sr.statusCode = 500;
         sr.errorMsg = sb.toString();
@@ -330,7 +526,8 @@ void NetworkDataTaskRsql::runSqlSelect(String sql)
         return;
     }
 
-    MYSQL_RES* res = mysql_store_result(&m_mysql);
+    // a streamed result is fetched from the server row by row
+    MYSQL_RES* res = m_streaming ? mysql_use_result(m_mysql) : mysql_store_result(m_mysql);
     if (!res) {
         sr.statusCode = 500;
         sr.errorMsg = "Failed to get result : " + sql;
@@ -344,7 +541,7 @@ void NetworkDataTaskRsql::runSqlSelect(String sql)
     MYSQL_FIELD* fields = mysql_fetch_fields(res);
     for (int i = 0; i < num_fields; ++i)
     {
-        m_sqlResultColumnNames.append(fields[i].name);
+        sr.columnNames.append(fields[i].name);
     }
 
     MYSQL_ROW row;
@@ -377,19 +574,27 @@ void NetworkDataTaskRsql::runSqlSelect(String sql)
                     break;
             }
         }
-        sr.rowsVec.append(columns);
+        if (m_streaming)
+            streamRow(columns, sr.columnNames);
+        else
+            sr.rowsVec.append(columns);
 
-        if (m_state == State::Canceling)
+        if (m_canceled)
         {
             sr.statusCode = 503;
             sr.errorMsg = "Canceling";
-            m_sqlResults.append(sr);
             break;
         }
     }
+
+    if (m_streaming && !m_canceled && mysql_errno(m_mysql))
+    {
+        sr.statusCode = 503;
+        sr.errorMsg = mysql_error(m_mysql);
+    }
     mysql_free_result(res);
 
-    sr.rowsAffected = sr.rowsVec.size();
+    sr.rowsAffected = m_streaming ? m_streamedRows : sr.rowsVec.size();
     m_sqlResults.append(sr);
 }
 
@@ -400,13 +605,13 @@ void NetworkDataTaskRsql::runSqlInsert(String sql)
 
     SqlResult sr;
     CString cmd = sql.utf8();
-    if (mysql_real_query(&m_mysql, cmd.data(), cmd.length()))
+    if (mysql_real_query(m_mysql, cmd.data(), cmd.length()))
     {
         StringBuilder sb;
         sb.append("Failed to : ");
         sb.append(sql);
         sb.append(". Error : ");
-        sb.append(mysql_error(&m_mysql));
+        sb.append(mysql_error(m_mysql));
 
         sr.statusCode = 500;
         sr.errorMsg = sb.toString();
@@ -415,7 +620,7 @@ void NetworkDataTaskRsql::runSqlInsert(String sql)
     }
 
     sr.statusCode = 200;
-    sr.rowsAffected = mysql_affected_rows(&m_mysql);
+    sr.rowsAffected = mysql_affected_rows(m_mysql);
     m_sqlResults.append(sr);
 }
 
@@ -431,149 +636,115 @@ void NetworkDataTaskRsql::runSqlDelete(String sql)
 
 void NetworkDataTaskRsql::buildResponse()
 {
-    auto result = JSON::Object::create();
+    m_responseBuffer.clear();
+    JSONWriter writer(m_responseBuffer);
+    writer.beginObject();
 
     int resultSize = m_sqlResults.size();
     switch (resultSize)
     {
     case 0:
         {
-            result->setInteger(KEY_STATUS_CODE, m_statusCode);
-
+            writer.writeKey(KEY_STATUS_CODE);
+            writer.writeInteger(m_statusCode);
+            writer.writeKey(KEY_ERROR_MSG);
             if (m_errorMsg.isEmpty())
-                result->setValue(KEY_ERROR_MSG, JSON::Value::null());
+                writer.writeNull();
             else
-                result->setString(KEY_ERROR_MSG, m_errorMsg);
-
-            result->setInteger(KEY_ROWSAFFECTED, m_readLines.size());
-            auto array = JSON::Array::create();
-            result->setArray(KEY_ROWS, WTFMove(array));
+                writer.writeString(m_errorMsg);
+            writer.writeKey(KEY_ROWSAFFECTED);
+            writer.writeInteger(m_readLines.size());
+            writer.writeKey(KEY_ROWS);
+            writer.beginArray();
+            writer.endArray();
         }
         break;
 
     case 1:
         {
-            SqlResult& sqlResult = m_sqlResults[0];
-            result->setInteger(KEY_STATUS_CODE, sqlResult.statusCode);
-            if (sqlResult.errorMsg.isEmpty())
-                result->setValue(KEY_ERROR_MSG, JSON::Value::null());
-            else
-                result->setString(KEY_ERROR_MSG, sqlResult.errorMsg);
-            result->setInteger(KEY_ROWSAFFECTED, sqlResult.rowsAffected);
-
-            int rowSize = sqlResult.rowsVec.size();
-            auto array = JSON::Array::create();
-            for (int i = 0; i < rowSize; i++)
-            {
-                if (m_formatArray)
-                {
-                    array->pushValue(formatAsArray(sqlResult.rowsVec[i]));
-                }
-                else
-                {
-                    array->pushValue(formatAsDict(sqlResult.rowsVec[i]));
-                }
-            }
-            result->setArray(KEY_ROWS, WTFMove(array));
+            writer.writeKey(KEY_STATUS_CODE);
+            writer.writeInteger(m_sqlResults[0].statusCode);
+            writeResult(writer, m_sqlResults[0]);
         }
         break;
 
     default:
         {
-            result->setInteger(KEY_STATUS_CODE, 200);
-            auto resultArray = JSON::Array::create();
-            for (int j = 0; j < resultSize; j++)
+            writer.writeKey(KEY_STATUS_CODE);
+            writer.writeInteger(200);
+            writer.writeKey(KEY_RESULT);
+            writer.beginArray();
+            for (auto& sqlResult : m_sqlResults)
             {
-                SqlResult& sqlResult = m_sqlResults[j];
-                auto res = JSON::Object::create();
-
-                if (sqlResult.errorMsg.isEmpty())
-                    res->setValue(KEY_ERROR_MSG, JSON::Value::null());
-                else
-                    res->setString(KEY_ERROR_MSG, sqlResult.errorMsg);
-                res->setInteger(KEY_ROWSAFFECTED, sqlResult.rowsAffected);
-
-                int rowSize = sqlResult.rowsVec.size();
-                auto array = JSON::Array::create();
-                for (int i = 0; i < rowSize; i++)
-                {
-                    if (m_formatArray)
-                    {
-                        array->pushValue(formatAsArray(sqlResult.rowsVec[i]));
-                    }
-                    else
-                    {
-                        array->pushValue(formatAsDict(sqlResult.rowsVec[i]));
-                    }
-                }
-                res->setArray(KEY_ROWS, WTFMove(array));
-                resultArray->pushObject(WTFMove(res));
+                writer.beginObject();
+                writeResult(writer, sqlResult);
+                writer.endObject();
             }
-            result->setArray(KEY_RESULT, WTFMove(resultArray));
+            writer.endArray();
         }
         break;
     }
 
-    String json = result->toJSONString();
-
-    m_responseBuffer.clear();
-    m_responseBuffer.append(json.characters8(), json.length());
+    writer.endObject();
 }
 
-Ref<JSON::Value> NetworkDataTaskRsql::formatAsArray(Vector<SQLValueH>& lineColumns)
+void NetworkDataTaskRsql::writeResult(JSONWriter& writer, const SqlResult& sqlResult)
 {
-    auto array = JSON::Array::create();
-    if (lineColumns.size() == 0)
-        return array;
+    writer.writeKey(KEY_ERROR_MSG);
+    if (sqlResult.errorMsg.isEmpty())
+        writer.writeNull();
+    else
+        writer.writeString(sqlResult.errorMsg);
+    writer.writeKey(KEY_ROWSAFFECTED);
+    writer.writeInteger(sqlResult.rowsAffected);
 
-    int size = lineColumns.size();
-    for (int i = 0; i < size; i++)
+    // the column names are escaped once for all the rows of the result
+    Vector<CString> keys;
+    if (!m_formatArray)
     {
-        SQLValueH value = lineColumns[i];
-        if (WTF::holds_alternative<String>(value))
-        {
-            array->pushString(WTF::get<String>(value));
-        }
-        else if (WTF::holds_alternative<double>(value))
-        {
-            array->pushDouble(WTF::get<double>(value));
-        }
-        else if (WTF::holds_alternative<int>(value))
-        {
-            array->pushInteger(WTF::get<int>(value));
-        }
-        else
-            array->pushValue(JSON::Value::null());
+        for (auto& name : sqlResult.columnNames)
+            keys.append(JSONWriter::escapeKey(name));
     }
-    return array;
+
+    writer.writeKey(KEY_ROWS);
+    writer.beginArray();
+    for (auto& row : sqlResult.rowsVec)
+        writeRow(writer, row, keys);
+    writer.endArray();
 }
 
-Ref<JSON::Value> NetworkDataTaskRsql::formatAsDict(Vector<SQLValueH>& lineColumns)
+void NetworkDataTaskRsql::writeRow(JSONWriter& writer, const Vector<SQLValueH>& lineColumns, const Vector<CString>& keys)
 {
-    auto result = JSON::Object::create();
-    if (lineColumns.size() == 0)
-        return result;
+    if (m_formatArray)
+        writer.beginArray();
+    else
+        writer.beginObject();
 
     int size = lineColumns.size();
     for (int i = 0; i < size; i++)
     {
-        SQLValueH value = lineColumns[i];
-        if (WTF::holds_alternative<String>(value))
+        if (!m_formatArray)
         {
-            result->setString(m_sqlResultColumnNames[i], WTF::get<String>(value));
+            if (i >= (int)keys.size())
+                break;
+            writer.writeEscapedKey(keys[i]);
         }
+
+        const SQLValueH& value = lineColumns[i];
+        if (WTF::holds_alternative<String>(value))
+            writer.writeString(WTF::get<String>(value));
         else if (WTF::holds_alternative<double>(value))
-        {
-            result->setDouble(m_sqlResultColumnNames[i], WTF::get<double>(value));
-        }
+            writer.writeDouble(WTF::get<double>(value));
         else if (WTF::holds_alternative<int>(value))
-        {
-            result->setInteger(m_sqlResultColumnNames[i], WTF::get<int>(value));
-        }
+            writer.writeInteger(WTF::get<int>(value));
         else
-            result->setValue(m_sqlResultColumnNames[i], JSON::Value::null());
+            writer.writeNull();
     }
-    return result;
+
+    if (m_formatArray)
+        writer.endArray();
+    else
+        writer.endObject();
 }
 
 void NetworkDataTaskRsql::parseQueryString(String query)
@@ -601,6 +772,10 @@ void NetworkDataTaskRsql::parseQueryString(String query)
         {
             m_formatArray = equalIgnoringASCIICase(value, FORMAT_ARRAY);
         }
+        else if (equalIgnoringASCIICase(name, CMD_SQL_STREAM))
+        {
+            m_streaming = !value.isEmpty() && value != "0" && !equalIgnoringASCIICase(value, "false");
+        }
         else
         {
             m_paramMap.set(name, value);
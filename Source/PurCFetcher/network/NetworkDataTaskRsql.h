@@ -57,9 +57,13 @@
 #include "SQLiteDatabase.h"
 #include "SQLiteFileSystem.h"
 #include "SQLValue.h"
+#include <wtf/Condition.h>
+#include <wtf/Lock.h>
 #include <wtf/RunLoop.h>
+#include <atomic>
 #include <wtf/glib/GRefPtr.h>
-#include <mysql/mysql.h>
+#include "JSONWriter.h"
+#include "MySQLConnectionPool.h"
 
 namespace PurCFetcher {
 
@@ -91,7 +95,22 @@ private:
     void dispatchDidReceiveResponse();
     void createRequest(PurCFetcher::ResourceRequest&&);
     void sendRequest();
-
+    void runCmd();
+    void didRunCmd();
+    void buildResponseHeaders();
+
+    // sqlstream=1: the rows of a single SELECT are sent as they are read
+    void dispatchDidReceiveStreamResponse();
+    void streamRow(const Vector<SQLValueH>& lineColumns, const Vector<String>& columnNames);
+    void flushStreamChunk();
+    void finishStream();
+
+    void killRunningQuery();
+    void startTimeout();
+    void stopTimeout();
+    void timeoutFired();
+
+    // Runs on a thread of the SQL worker pool.
     void runCmdInner();
 
     void runSqlSelect(String sql);
@@ -104,10 +123,13 @@ private:
     void parseQueryString(String query);
     void parseSqlQuery(String sqlQuery);
 
-    Ref<JSON::Value> formatAsArray(Vector<SQLValueH>& lineColumns);
-    Ref<JSON::Value> formatAsDict(Vector<SQLValueH>& lineColumns);
+    void writeResult(JSONWriter&, const SqlResult&);
+    void writeRow(JSONWriter&, const Vector<SQLValueH>& lineColumns, const Vector<CString>& keys);
 private:
     State m_state { State::Suspended };
+    // Read by the worker running the statements, set on the main thread.
+    std::atomic<bool> m_canceled { false };
+    RunLoop::Timer<NetworkDataTaskRsql> m_timeoutSource;
     PurCFetcher::ResourceRequest m_currentRequest;
     PurCFetcher::ResourceResponse m_response;
 
@@ -115,6 +137,7 @@ private:
     PurCFetcher::NetworkLoadMetrics m_networkLoadMetrics;
     Vector<char> m_readBuffer;
     Vector<char> m_responseBuffer;
+    JSONWriter m_streamWriter { m_responseBuffer };
     Vector<String> m_readLines;
 
     String m_errorMsg;
@@ -123,13 +146,28 @@ private:
 
     HashMap<String, String> m_paramMap;
 
-    MYSQL m_mysql;
+    std::unique_ptr<MySQLConnection> m_connection;
+    MYSQL* m_mysql { nullptr };
+    // The server thread of m_connection while the worker holds it, for
+    // cancel() to kill the running statement. The worker gives the
+    // connection back only under this lock, so the id never names the
+    // statement of another task.
+    Lock m_queryLock;
+    unsigned long m_queryThreadId { 0 };
+    MySQLConnectionPool::Parameters m_queryParameters;
     Vector<String> m_sqlVec;
-    Vector<String> m_sqlResultColumnNames;
     Vector<SqlResult> m_sqlResults;
 
     bool m_formatArray;
     String m_sqlQuery;
+
+    bool m_streaming { false };
+    size_t m_streamedRows { 0 };
+    Vector<CString> m_streamKeys;
+    // bounds the chunks posted by the worker and not sent yet
+    Lock m_streamLock;
+    Condition m_streamCondition;
+    unsigned m_pendingChunks { 0 };
 };
 
 } // namespace PurCFetcher
@@ -88,6 +88,17 @@ void NetworkLoad::cancel()
         m_task->cancel();
 }
 
+void NetworkLoad::setDefersLoading(bool defers)
+{
+    if (!m_task)
+        return;
+
+    if (defers)
+        m_task->suspend();
+    else if (m_task->state() == NetworkDataTask::State::Suspended)
+        m_task->resume();
+}
+
 static inline void updateRequest(ResourceRequest& currentRequest, const ResourceRequest& newRequest)
 {
     currentRequest.updateFromDelegatePreservingOldProperties(newRequest);
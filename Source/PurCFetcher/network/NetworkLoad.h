@@ -48,6 +48,7 @@ public:
     ~NetworkLoad();
 
     void cancel();
+    void setDefersLoading(bool);
 
     bool isAllowedToAskUserForCredentials() const;
 
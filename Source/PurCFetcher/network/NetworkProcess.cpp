@@ -311,6 +311,8 @@ void NetworkProcess::initializeNetworkProcess(NetworkProcessCreationParameters&&
         memoryPressureHandler.install();
     }
 
+    m_cacheQuota = parameters.cacheQuota;
+    m_cacheEvictionPolicy = parameters.cacheEvictionPolicy;
     setCacheModel(parameters.cacheModel);
 
 #if ENABLE(RESOURCE_LOAD_STATISTICS)
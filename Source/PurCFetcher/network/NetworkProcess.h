@@ -165,6 +165,8 @@ public:
     void resume();
 
     CacheModel cacheModel() const { return m_cacheModel; }
+    uint64_t cacheQuota() const { return m_cacheQuota; }
+    const String& cacheEvictionPolicy() const { return m_cacheEvictionPolicy; }
 
     // Diagnostic messages logging.
     void logDiagnosticMessage(WebPageProxyIdentifier, const String& message, const String& description, PurCFetcher::ShouldSample);
@@ -467,6 +469,8 @@ private:
 
     bool m_hasSetCacheModel { false };
     CacheModel m_cacheModel { CacheModel::DocumentViewer };
+    uint64_t m_cacheQuota { 0 };
+    String m_cacheEvictionPolicy;
     bool m_suppressMemoryPressureHandler { false };
     String m_uiProcessBundleIdentifier;
     DownloadManager m_downloadManager;
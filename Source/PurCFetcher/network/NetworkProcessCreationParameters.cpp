@@ -36,6 +36,9 @@ NetworkProcessCreationParameters::NetworkProcessCreationParameters() = default;
 void NetworkProcessCreationParameters::encode(IPC::Encoder& encoder) const
 {
     encoder << cacheModel;
+    encoder << maxConnections;
+    encoder << cacheQuota;
+    encoder << cacheEvictionPolicy;
     encoder << shouldSuppressMemoryPressureHandler;
     encoder << urlSchemesRegisteredForCustomProtocols;
     encoder << defaultDataStoreParameters;
@@ -61,6 +64,12 @@ bool NetworkProcessCreationParameters::decode(IPC::Decoder& decoder, NetworkProc
 {
     if (!decoder.decode(result.cacheModel))
         return false;
+    if (!decoder.decode(result.maxConnections))
+        return false;
+    if (!decoder.decode(result.cacheQuota))
+        return false;
+    if (!decoder.decode(result.cacheEvictionPolicy))
+        return false;
 
     if (!decoder.decode(result.shouldSuppressMemoryPressureHandler))
         return false;
@@ -52,6 +52,10 @@ struct NetworkProcessCreationParameters {
     static WARN_UNUSED_RETURN bool decode(IPC::Decoder&, NetworkProcessCreationParameters&);
 
     CacheModel cacheModel { CacheModel::DocumentViewer };
+    uint64_t maxConnections { 0 };
+    uint64_t cacheQuota { 0 };
+    // The name of the disk cache eviction policy; empty for the default.
+    String cacheEvictionPolicy;
 
     bool shouldSuppressMemoryPressureHandler { false };
 
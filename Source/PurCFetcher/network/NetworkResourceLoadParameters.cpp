@@ -123,6 +123,7 @@ void NetworkResourceLoadParameters::encode(IPC::Encoder& encoder) const
 #endif
     
     encoder << isNavigatingToAppBoundDomain;
+    encoder << shouldSendBodyAsSharedMemory;
 }
 
 Optional<NetworkResourceLoadParameters> NetworkResourceLoadParameters::decode(IPC::Decoder& decoder)
@@ -312,6 +313,12 @@ Optional<NetworkResourceLoadParameters> NetworkResourceLoadParameters::decode(IP
         return WTF::nullopt;
     result.isNavigatingToAppBoundDomain = *isNavigatingToAppBoundDomain;
 
+    Optional<bool> shouldSendBodyAsSharedMemory;
+    decoder >> shouldSendBodyAsSharedMemory;
+    if (!shouldSendBodyAsSharedMemory)
+        return WTF::nullopt;
+    result.shouldSendBodyAsSharedMemory = *shouldSendBodyAsSharedMemory;
+
     return result;
 }
     
@@ -30,6 +30,7 @@
 #include "DataReference.h"
 #include "FormDataReference.h"
 #include "Logging.h"
+#include "MessageRing.h"
 #include "NetworkCache.h"
 #include "NetworkCacheSpeculativeLoadManager.h"
 #include "NetworkConnectionToWebProcess.h"
@@ -42,6 +43,7 @@
 #include "NetworkSession.h"
 #include "ResourceLoadInfo.h"
 #include "SharedBufferDataReference.h"
+#include "SharedMemory.h"
 #include "WebCoreArgumentCoders.h"
 #include "WebErrors.h"
 //#include "WebPageMessages.h"
@@ -379,7 +381,7 @@ void NetworkResourceLoader::startNetworkLoad(ResourceRequest&& request, FirstLoa
     if (load == FirstLoad::Yes) {
         consumeSandboxExtensions();
 
-        if (isSynchronous() || m_parameters.maximumBufferingTime > 0_s)
+        if (isSynchronous() || m_parameters.maximumBufferingTime > 0_s || shouldSendBodyAsSharedMemory())
             m_bufferedData = SharedBuffer::create();
 
         if (canUseCache(request))
@@ -652,8 +654,10 @@ void NetworkResourceLoader::didReceiveResponse(ResourceResponse&& receivedRespon
     }
 
     // For multipart/x-mixed-replace didReceiveResponseAsync gets called multiple times and buffering would require special handling.
-    if (!isSynchronous() && m_response.isMultipart())
+    if (!isSynchronous() && m_response.isMultipart()) {
         m_bufferedData = nullptr;
+        m_bodyMemory = nullptr;
+    }
 
     if (m_response.isMultipart())
         m_bufferedDataForCache = nullptr;
@@ -760,6 +764,32 @@ void NetworkResourceLoader::didReceiveBuffer(Ref<SharedBuffer>&& buffer, int rep
     // FIXME: At least on OS X Yosemite we always get -1 from the resource handle.
     unsigned encodedDataLength = reportedEncodedDataLength >= 0 ? reportedEncodedDataLength : buffer->size();
 
+    // Small bodies are held and sent as one message at the end; a region
+    // only pays off once the body outgrows what the message ring carries.
+    if (isHoldingBodyForSharedMemory() && m_bufferedData->size() + buffer->size() > IPC::MessageRing::maxBodySize) {
+        m_didAllocateBodyMemory = true;
+        auto bodyMemory = SharedMemory::allocateGrowable();
+        if (bodyMemory && bodyMemory->append(*m_bufferedData))
+            m_bodyMemory = WTFMove(bodyMemory);
+        else
+            sendBuffer(*m_bufferedData, m_bufferedDataEncodedDataLength);
+        m_bufferedData = nullptr;
+        if (m_parameters.maximumBufferingTime > 0_s)
+            m_bufferedData = SharedBuffer::create();
+        m_bufferedDataEncodedDataLength = 0;
+    }
+
+    if (m_bodyMemory) {
+        if (m_bodyMemory->append(buffer.get()))
+            return;
+        // The region cannot grow any more: hand over what it holds and
+        // send the rest of the body chunk by chunk.
+        if (!sendBodyMemory()) {
+            didFailLoading(internalError(originalRequest().url()));
+            return;
+        }
+    }
+
     if (m_bufferedData) {
         m_bufferedData->append(buffer.get());
         m_bufferedDataEncodedDataLength += encodedDataLength;
@@ -796,6 +826,10 @@ void NetworkResourceLoader::didFinishLoading(const NetworkLoadMetrics& networkLo
     if (isSynchronous())
         sendReplyToSynchronousRequest(*m_synchronousLoadData, m_bufferedData.get());
     else {
+        if (m_bodyMemory && !sendBodyMemory()) {
+            didFailLoading(internalError(originalRequest().url()));
+            return;
+        }
         if (m_bufferedData && !m_bufferedData->isEmpty()) {
             // FIXME: Pass a real value or remove the encoded data size feature.
             sendBuffer(*m_bufferedData, -1);
@@ -1106,6 +1140,13 @@ void NetworkResourceLoader::continueDidReceiveResponse()
         m_responseCompletionHandler(PolicyAction::Use);
 }
 
+void NetworkResourceLoader::setDefersLoading(bool defers)
+{
+    RELEASE_LOG_IF_ALLOWED("setDefersLoading: (defers=%d)", defers);
+    if (m_networkLoad)
+        m_networkLoad->setDefersLoading(defers);
+}
+
 void NetworkResourceLoader::didSendData(unsigned long long bytesSent, unsigned long long totalBytesToBeSent)
 {
     if (!isSynchronous())
@@ -1114,7 +1155,7 @@ void NetworkResourceLoader::didSendData(unsigned long long bytesSent, unsigned l
 
 void NetworkResourceLoader::startBufferingTimerIfNeeded()
 {
-    if (isSynchronous())
+    if (isSynchronous() || isHoldingBodyForSharedMemory())
         return;
     if (m_bufferingTimer.isActive())
         return;
@@ -1154,6 +1195,34 @@ void NetworkResourceLoader::sendBuffer(SharedBuffer& buffer, size_t encodedDataL
     }
 }
 
+bool NetworkResourceLoader::shouldSendBodyAsSharedMemory() const
+{
+    return m_parameters.shouldSendBodyAsSharedMemory && !m_parameters.request.getJsonType();
+}
+
+bool NetworkResourceLoader::isHoldingBodyForSharedMemory() const
+{
+    return !isSynchronous() && shouldSendBodyAsSharedMemory() && !m_didAllocateBodyMemory && m_bufferedData;
+}
+
+bool NetworkResourceLoader::sendBodyMemory()
+{
+    ASSERT(!isSynchronous());
+
+    // The chunks were written once into the region as they arrived; the
+    // client reads the body from there.
+    auto bodyMemory = std::exchange(m_bodyMemory, nullptr);
+    if (!bodyMemory->size())
+        return true;
+
+    SharedMemory::Handle handle;
+    if (!bodyMemory->createHandle(handle, SharedMemory::Protection::ReadOnly))
+        return false;
+
+    send(Messages::WebResourceLoader::DidReceiveSharedMemory(handle, bodyMemory->size()));
+    return true;
+}
+
 void NetworkResourceLoader::tryStoreAsCacheEntry()
 {
 #ifdef gengyue
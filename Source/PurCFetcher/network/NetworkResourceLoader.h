@@ -168,6 +168,7 @@ private:
     void startNetworkLoad(PurCFetcher::ResourceRequest&&, FirstLoad);
     void restartNetworkLoad(PurCFetcher::ResourceRequest&&);
     void continueDidReceiveResponse();
+    void setDefersLoading(bool);
     void didReceiveMainResourceResponse(const PurCFetcher::ResourceResponse&);
 
     enum class LoadResult {
@@ -183,6 +184,9 @@ private:
     void startBufferingTimerIfNeeded();
     void bufferingTimerFired();
     void sendBuffer(PurCFetcher::SharedBuffer&, size_t encodedDataLength);
+    bool isHoldingBodyForSharedMemory() const;
+    bool sendBodyMemory();
+    bool shouldSendBodyAsSharedMemory() const;
 
     void consumeSandboxExtensions();
     void invalidateSandboxExtensions();
@@ -217,6 +221,10 @@ private:
 
     size_t m_bufferedDataEncodedDataLength { 0 };
     RefPtr<PurCFetcher::SharedBuffer> m_bufferedData;
+    // For shouldSendBodyAsSharedMemory(): created once the body outgrows
+    // MessageRing::maxBodySize, then written as the body arrives.
+    RefPtr<PurCFetcher::SharedMemory> m_bodyMemory;
+    bool m_didAllocateBodyMemory { false };
     unsigned m_redirectCount { 0 };
 
     std::unique_ptr<SynchronousLoadData> m_synchronousLoadData;
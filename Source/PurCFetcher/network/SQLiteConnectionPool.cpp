@@ -0,0 +1,163 @@
+/* 
+ * Copyright (C) 2020 Beijing FMSoft Technologies Co., Ltd.
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ * 
+ * Or,
+ * 
+ * As this component is a program released under LGPLv3, which claims
+ * explicitly that the program could be modified by any end user
+ * even if the program is conveyed in non-source form on the system it runs.
+ * Generally, if you distribute this program in embedded devices,
+ * you might not satisfy this condition. Under this situation or you can
+ * not accept any condition of LGPLv3, you need to get a commercial license
+ * from FMSoft, along with a patent license for the patents owned by FMSoft.
+ * 
+ * If you have got a commercial/patent license of this program, please use it
+ * under the terms and conditions of the commercial license.
+ * 
+ * For more information about the commercial license and patent license,
+ * please refer to
+ * <https://hybridos.fmsoft.cn/blog/hybridos-licensing-policy/>.
+ * 
+ * Also note that the LGPLv3 license does not apply to any entity in the
+ * Exception List published by Beijing FMSoft Technologies Co., Ltd.
+ * 
+ * If you are or the entity you represent is listed in the Exception List,
+ * the above open source or free software license does not apply to you
+ * or the entity you represent. Regardless of the purpose, you should not
+ * use the software in any way whatsoever, including but not limited to
+ * downloading, viewing, copying, distributing, compiling, and running.
+ * If you have already downloaded it, you MUST destroy all of its copies.
+ * 
+ * The Exception List is published by FMSoft and may be updated
+ * from time to time. For more information, please see
+ * <https://www.fmsoft.cn/exception-list>.
+ */ 
+
+#include "config.h"
+#include "SQLiteConnectionPool.h"
+
+#if ENABLE(LSQL)
+
+#include "SQLiteFileSystem.h"
+#include <wtf/NeverDestroyed.h>
+
+namespace PurCFetcher {
+
+static const unsigned maxCachedStatements = 32;
+static const unsigned maxIdleConnectionsPerPath = 4;
+static const Seconds idleConnectionTimeout = 60_s;
+
+SQLiteConnection::SQLiteConnection(const String& path)
+    : m_path(path)
+{
+}
+
+SQLiteStatement* SQLiteConnection::statement(const String& sql)
+{
+    for (size_t i = 0; i < m_statements.size(); i++) {
+        if (m_statements[i].first != sql)
+            continue;
+
+        auto entry = WTFMove(m_statements[i]);
+        m_statements.remove(i);
+        m_statements.append(WTFMove(entry));
+        return m_statements.last().second.get();
+    }
+
+    auto statement = makeUnique<SQLiteStatement>(m_database, sql);
+    if (statement->prepare() != SQLITE_OK)
+        return nullptr;
+
+    if (m_statements.size() >= maxCachedStatements)
+        m_statements.remove(0);
+    m_statements.append({ sql, WTFMove(statement) });
+    return m_statements.last().second.get();
+}
+
+SQLiteConnectionPool& SQLiteConnectionPool::singleton()
+{
+    static NeverDestroyed<SQLiteConnectionPool> pool;
+    return pool;
+}
+
+std::unique_ptr<SQLiteConnection> SQLiteConnectionPool::takeConnection(const String& path, int& statusCode, String& errorMessage)
+{
+    std::unique_ptr<SQLiteConnection> connection;
+    Vector<std::unique_ptr<SQLiteConnection>> expired;
+    {
+        auto locker = holdLock(m_lock);
+        MonotonicTime now = MonotonicTime::now();
+        for (auto& it : m_idleConnections) {
+            // the idle connections are kept in the order they were given back
+            auto& connections = it.value;
+            size_t count = 0;
+            while (count < connections.size() && now - connections[count]->m_lastUsedTime >= idleConnectionTimeout)
+                expired.append(WTFMove(connections[count++]));
+            connections.remove(0, count);
+        }
+        m_idleConnections.removeIf([](auto& it) {
+            return it.value.isEmpty();
+        });
+
+        auto it = m_idleConnections.find(path);
+        if (it != m_idleConnections.end())
+            connection = it->value.takeLast();
+    }
+    // close the expired databases outside of the lock
+    expired.clear();
+
+    if (connection)
+        return connection;
+
+    if (!SQLiteFileSystem::ensureDatabaseFileExists(path, false)) {
+        statusCode = 404;
+        errorMessage = "Not Found";
+        return nullptr;
+    }
+
+    connection = std::unique_ptr<SQLiteConnection>(new SQLiteConnection(path));
+    // open() puts a writable database in WAL mode, so readers on other
+    // connections to the same file do not block on a writer
+    if (!connection->m_database.open(path)) {
+        statusCode = 404;
+        errorMessage = "Failed to open database " + path + ".";
+        return nullptr;
+    }
+    // the connection moves between the SQL worker threads
+    connection->m_database.disableThreadingChecks();
+    return connection;
+}
+
+void SQLiteConnectionPool::giveBackConnection(std::unique_ptr<SQLiteConnection>&& connection)
+{
+    if (!connection)
+        return;
+
+    auto locker = holdLock(m_lock);
+    auto& connections = m_idleConnections.add(connection->m_path, Vector<std::unique_ptr<SQLiteConnection>> { }).iterator->value;
+    if (connections.size() >= maxIdleConnectionsPerPath) {
+        locker.unlockEarly();
+        connection = nullptr;
+        return;
+    }
+
+    connection->m_lastUsedTime = MonotonicTime::now();
+    connections.append(WTFMove(connection));
+}
+
+} // namespace PurCFetcher
+
+#endif // ENABLE(LSQL)
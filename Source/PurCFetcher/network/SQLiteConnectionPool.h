@@ -0,0 +1,108 @@
+/* 
+ * Copyright (C) 2020 Beijing FMSoft Technologies Co., Ltd.
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ * 
+ * Or,
+ * 
+ * As this component is a program released under LGPLv3, which claims
+ * explicitly that the program could be modified by any end user
+ * even if the program is conveyed in non-source form on the system it runs.
+ * Generally, if you distribute this program in embedded devices,
+ * you might not satisfy this condition. Under this situation or you can
+ * not accept any condition of LGPLv3, you need to get a commercial license
+ * from FMSoft, along with a patent license for the patents owned by FMSoft.
+ * 
+ * If you have got a commercial/patent license of this program, please use it
+ * under the terms and conditions of the commercial license.
+ * 
+ * For more information about the commercial license and patent license,
+ * please refer to
+ * <https://hybridos.fmsoft.cn/blog/hybridos-licensing-policy/>.
+ * 
+ * Also note that the LGPLv3 license does not apply to any entity in the
+ * Exception List published by Beijing FMSoft Technologies Co., Ltd.
+ * 
+ * If you are or the entity you represent is listed in the Exception List,
+ * the above open source or free software license does not apply to you
+ * or the entity you represent. Regardless of the purpose, you should not
+ * use the software in any way whatsoever, including but not limited to
+ * downloading, viewing, copying, distributing, compiling, and running.
+ * If you have already downloaded it, you MUST destroy all of its copies.
+ * 
+ * The Exception List is published by FMSoft and may be updated
+ * from time to time. For more information, please see
+ * <https://www.fmsoft.cn/exception-list>.
+ */ 
+
+#pragma once
+
+#if ENABLE(LSQL)
+
+#include "SQLiteDatabase.h"
+#include "SQLiteStatement.h"
+#include <wtf/HashMap.h>
+#include <wtf/Lock.h>
+#include <wtf/MonotonicTime.h>
+#include <wtf/Vector.h>
+#include <wtf/text/WTFString.h>
+
+namespace PurCFetcher {
+
+// An open database file, checked out of SQLiteConnectionPool, along with
+// the statements prepared on it.
+class SQLiteConnection {
+    WTF_MAKE_NONCOPYABLE(SQLiteConnection); WTF_MAKE_FAST_ALLOCATED;
+public:
+    SQLiteDatabase& database() { return m_database; }
+
+    // Returns the statement for the SQL, prepared on this connection and
+    // with no parameters bound, or null if the SQL does not compile.
+    SQLiteStatement* statement(const String& sql);
+
+private:
+    friend class SQLiteConnectionPool;
+    explicit SQLiteConnection(const String& path);
+
+    String m_path;
+    MonotonicTime m_lastUsedTime;
+    SQLiteDatabase m_database;
+    // least recently used first
+    Vector<std::pair<String, std::unique_ptr<SQLiteStatement>>> m_statements;
+};
+
+// The process wide cache of the database files used by lsql:// data tasks,
+// keyed by path. A connection is used by one task at a time; the tasks run
+// on the SQL worker threads, so the pool is thread safe.
+class SQLiteConnectionPool {
+    WTF_MAKE_NONCOPYABLE(SQLiteConnectionPool); WTF_MAKE_FAST_ALLOCATED;
+public:
+    static SQLiteConnectionPool& singleton();
+
+    // Returns null with statusCode and errorMessage set if the database
+    // does not exist or cannot be opened.
+    std::unique_ptr<SQLiteConnection> takeConnection(const String& path, int& statusCode, String& errorMessage);
+    void giveBackConnection(std::unique_ptr<SQLiteConnection>&&);
+
+private:
+    friend class NeverDestroyed<SQLiteConnectionPool>;
+    SQLiteConnectionPool() = default;
+
+    Lock m_lock;
+    HashMap<String, Vector<std::unique_ptr<SQLiteConnection>>> m_idleConnections;
+};
+
+} // namespace PurCFetcher
+
+#endif // ENABLE(LSQL)
@@ -58,8 +58,12 @@ static const AtomString& resourceType()
     return resource;
 }
 
-static size_t computeCapacity(CacheModel cacheModel, const String& cachePath)
+static size_t computeCapacity(CacheModel cacheModel, uint64_t cacheQuota, const String& cachePath)
 {
+    // An explicit quota from the client wins over the cache model.
+    if (cacheQuota)
+        return static_cast<size_t>(std::min<uint64_t>(cacheQuota, std::numeric_limits<size_t>::max()));
+
     unsigned urlCacheMemoryCapacity = 0;
     uint64_t urlCacheDiskCapacity = 0;
     uint64_t diskFreeSize = 0;
@@ -72,12 +76,26 @@ static size_t computeCapacity(CacheModel cacheModel, const String& cachePath)
     return urlCacheDiskCapacity;
 }
 
+static size_t computeMemoryCapacity(CacheModel cacheModel, size_t diskCapacity)
+{
+    unsigned urlCacheMemoryCapacity = 0;
+    uint64_t urlCacheDiskCapacity = 0;
+    calculateURLCacheSizes(cacheModel, 0, urlCacheMemoryCapacity, urlCacheDiskCapacity);
+    if (urlCacheMemoryCapacity)
+        return urlCacheMemoryCapacity;
+
+    // The model has no memory cache (DocumentViewer), but a quota gave the
+    // disk cache a size: keep a small part of it in memory.
+    const size_t maximumMemoryCapacity = 4 * MB;
+    return std::min(diskCapacity / 16, maximumMemoryCapacity);
+}
+
 RefPtr<Cache> Cache::open(NetworkProcess& networkProcess, const String& cachePath, OptionSet<CacheOption> options, PAL::SessionID sessionID)
 {
     if (!FileSystem::makeAllDirectories(cachePath))
         return nullptr;
 
-    auto capacity = computeCapacity(networkProcess.cacheModel(), cachePath);
+    auto capacity = computeCapacity(networkProcess.cacheModel(), networkProcess.cacheQuota(), cachePath);
     auto storage = Storage::open(cachePath, options.contains(CacheOption::TestingMode) ? Storage::Mode::AvoidRandomness : Storage::Mode::Normal, capacity);
 
     LOG(NetworkCache, "(NetworkProcess) opened cache storage, success %d", !!storage);
@@ -85,7 +103,10 @@ RefPtr<Cache> Cache::open(NetworkProcess& networkProcess, const String& cachePat
     if (!storage)
         return nullptr;
 
-    return adoptRef(*new Cache(networkProcess, cachePath, storage.releaseNonNull(), options, sessionID));
+    storage->setEvictionPolicy(EvictionPolicy::create(networkProcess.cacheEvictionPolicy()));
+
+    auto memoryCapacity = computeMemoryCapacity(networkProcess.cacheModel(), capacity);
+    return adoptRef(*new Cache(networkProcess, cachePath, storage.releaseNonNull(), memoryCapacity, options, sessionID));
 }
 
 static void dumpFileChanged(Cache* cache)
@@ -93,8 +114,9 @@ static void dumpFileChanged(Cache* cache)
     cache->dumpContentsToFile();
 }
 
-Cache::Cache(NetworkProcess& networkProcess, const String& storageDirectory, Ref<Storage>&& storage, OptionSet<CacheOption> options, PAL::SessionID sessionID)
+Cache::Cache(NetworkProcess& networkProcess, const String& storageDirectory, Ref<Storage>&& storage, size_t memoryCapacity, OptionSet<CacheOption> options, PAL::SessionID sessionID)
     : m_storage(WTFMove(storage))
+    , m_memoryCache(memoryCapacity)
     , m_networkProcess(networkProcess)
     , m_sessionID(sessionID)
     , m_storageDirectory(storageDirectory)
@@ -106,10 +128,16 @@ Cache::Cache(NetworkProcess& networkProcess, const String& storageDirectory, Ref
         GFileMonitor* monitor = g_file_monitor_file(dumpFile.get(), G_FILE_MONITOR_NONE, nullptr, nullptr);
         g_signal_connect_swapped(monitor, "changed", G_CALLBACK(dumpFileChanged), this);
     }
+
+    // Entries the storage evicts must not be served from memory either.
+    m_storage->setEvictionHandler([this](const Vector<Key::HashType>& evictedHashes) {
+        m_memoryCache.remove(evictedHashes);
+    });
 }
 
 Cache::~Cache()
 {
+    m_storage->setEvictionHandler(nullptr);
 }
 
 size_t Cache::capacity() const
@@ -119,8 +147,9 @@ size_t Cache::capacity() const
 
 void Cache::updateCapacity()
 {
-    auto newCapacity = computeCapacity(m_networkProcess->cacheModel(), m_storage->basePathIsolatedCopy());
+    auto newCapacity = computeCapacity(m_networkProcess->cacheModel(), m_networkProcess->cacheQuota(), m_storage->basePathIsolatedCopy());
     m_storage->setCapacity(newCapacity);
+    m_memoryCache.setCapacity(computeMemoryCapacity(m_networkProcess->cacheModel(), newCapacity));
 }
 
 Key Cache::makeCacheKey(const PurCFetcher::ResourceRequest& request)
@@ -334,6 +363,16 @@ void Cache::retrieve(const PurCFetcher::ResourceRequest& request, const GlobalFr
         return;
     }
 
+    if (auto entry = m_memoryCache.find(storageKey)) {
+        LOG(NetworkCache, "(NetworkProcess) found in memory");
+        // Let the storage know, or it would evict the hottest entries first.
+        m_storage->touch(storageKey);
+        auto useDecision = makeUseDecision(networkProcess(), m_sessionID, *entry, request);
+        entry = applyUseDecision(useDecision, WTFMove(entry), request, storageKey, frameID, isNavigatingToAppBoundDomain);
+        completeRetrieve(WTFMove(completionHandler), WTFMove(entry), info);
+        return;
+    }
+
     m_storage->retrieve(storageKey, priority, [this, protectedThis = makeRef(*this), request, completionHandler = WTFMove(completionHandler), info = WTFMove(info), storageKey, networkProcess = makeRef(networkProcess()), sessionID = m_sessionID, frameID, isNavigatingToAppBoundDomain](auto record, auto timings) mutable {
         info.storageTimings = timings;
 
@@ -348,26 +387,9 @@ void Cache::retrieve(const PurCFetcher::ResourceRequest& request, const GlobalFr
         auto entry = Entry::decodeStorageRecord(*record);
 
         auto useDecision = entry ? makeUseDecision(networkProcess, sessionID, *entry, request) : UseDecision::NoDueToDecodeFailure;
-        switch (useDecision) {
-        case UseDecision::AsyncRevalidate: {
-#if ENABLE(NETWORK_CACHE_STALE_WHILE_REVALIDATE)
-            auto entryCopy = makeUnique<Entry>(*entry);
-            entryCopy->setNeedsValidation(true);
-            startAsyncRevalidationIfNeeded(request, storageKey, WTFMove(entryCopy), frameID, isNavigatingToAppBoundDomain);
-#else
-            UNUSED_PARAM(frameID);
-            UNUSED_PARAM(this);
-#endif
-            FALLTHROUGH;
-        }
-        case UseDecision::Use:
-            break;
-        case UseDecision::Validate:
-            entry->setNeedsValidation(true);
-            break;
-        default:
-            entry = nullptr;
-        };
+        if (entry)
+            m_memoryCache.add(*entry);
+        entry = applyUseDecision(useDecision, WTFMove(entry), request, storageKey, frameID, isNavigatingToAppBoundDomain);
 
 #if !LOG_DISABLED
         auto elapsed = MonotonicTime::now() - info.startTime;
@@ -384,6 +406,32 @@ void Cache::completeRetrieve(RetrieveCompletionHandler&& handler, std::unique_pt
     info.completionTime = MonotonicTime::now();
     handler(WTFMove(entry), info);
 }
+
+std::unique_ptr<Entry> Cache::applyUseDecision(UseDecision useDecision, std::unique_ptr<Entry>&& entry, const PurCFetcher::ResourceRequest& request, const Key& storageKey, const GlobalFrameID& frameID, Optional<NavigatingToAppBoundDomain> isNavigatingToAppBoundDomain)
+{
+    switch (useDecision) {
+    case UseDecision::AsyncRevalidate: {
+#if ENABLE(NETWORK_CACHE_STALE_WHILE_REVALIDATE)
+        auto entryCopy = makeUnique<Entry>(*entry);
+        entryCopy->setNeedsValidation(true);
+        startAsyncRevalidationIfNeeded(request, storageKey, WTFMove(entryCopy), frameID, isNavigatingToAppBoundDomain);
+#else
+        UNUSED_PARAM(request);
+        UNUSED_PARAM(storageKey);
+        UNUSED_PARAM(frameID);
+        UNUSED_PARAM(isNavigatingToAppBoundDomain);
+#endif
+        FALLTHROUGH;
+    }
+    case UseDecision::Use:
+        return WTFMove(entry);
+    case UseDecision::Validate:
+        entry->setNeedsValidation(true);
+        return WTFMove(entry);
+    default:
+        return nullptr;
+    };
+}
     
 std::unique_ptr<Entry> Cache::makeEntry(const PurCFetcher::ResourceRequest& request, const PurCFetcher::ResourceResponse& response, RefPtr<PurCFetcher::SharedBuffer>&& responseData)
 {
@@ -418,6 +466,7 @@ std::unique_ptr<Entry> Cache::store(const PurCFetcher::ResourceRequest& request,
 
     auto cacheEntry = makeEntry(request, response, WTFMove(responseData));
     auto record = cacheEntry->encodeAsStorageRecord();
+    m_memoryCache.add(*cacheEntry);
 
     m_storage->store(record, [protectedThis = makeRef(*this), completionHandler = WTFMove(completionHandler)](const Data& bodyData) mutable {
         UNUSED_PARAM(bodyData);
@@ -463,6 +512,7 @@ std::unique_ptr<Entry> Cache::storeRedirect(const PurCFetcher::ResourceRequest&
 #endif
 
     auto record = cacheEntry->encodeAsStorageRecord();
+    m_memoryCache.remove(cacheEntry->key());
 
     m_storage->store(record, nullptr);
     
@@ -478,6 +528,7 @@ std::unique_ptr<Entry> Cache::update(const PurCFetcher::ResourceRequest& origina
 
     auto updateEntry = makeUnique<Entry>(existingEntry.key(), response, existingEntry.buffer(), PurCFetcher::collectVaryingRequestHeaders(networkProcess().storageSession(m_sessionID), originalRequest, response));
     auto updateRecord = updateEntry->encodeAsStorageRecord();
+    m_memoryCache.add(*updateEntry);
 
     m_storage->store(updateRecord, { });
 
@@ -486,6 +537,7 @@ std::unique_ptr<Entry> Cache::update(const PurCFetcher::ResourceRequest& origina
 
 void Cache::remove(const Key& key)
 {
+    m_memoryCache.remove(key);
     m_storage->remove(key);
 }
 
@@ -496,6 +548,8 @@ void Cache::remove(const PurCFetcher::ResourceRequest& request)
 
 void Cache::remove(const Vector<Key>& keys, Function<void()>&& completionHandler)
 {
+    for (auto& key : keys)
+        m_memoryCache.remove(key);
     m_storage->remove(keys, WTFMove(completionHandler));
 }
 
@@ -551,16 +605,32 @@ void Cache::dumpContentsToFile()
     Totals totals;
     auto flags = { Storage::TraverseFlag::ComputeWorth, Storage::TraverseFlag::ShareCount };
     size_t capacity = m_storage->capacity();
-    m_storage->traverse(resourceType(), flags, [fd, totals, capacity](const Storage::Record* record, const Storage::RecordInfo& info) mutable {
+    size_t size = m_storage->approximateSize();
+    auto statistics = m_storage->statistics();
+    // Memory cache hits never reach the storage; count them as hits too.
+    auto memoryHitCount = m_memoryCache.statistics().hitCount;
+    m_storage->traverse(resourceType(), flags, [fd, totals, capacity, size, statistics, memoryHitCount](const Storage::Record* record, const Storage::RecordInfo& info) mutable {
         if (!record) {
+            auto hitCount = memoryHitCount + statistics.hitCount;
+            auto lookupCount = hitCount + statistics.missCount;
             CString writeData = makeString(
                 "{}\n"
                 "],\n"
                 "\"totals\": {\n"
                 "\"capacity\": ", capacity, ",\n"
+                "\"size\": ", size, ",\n"
                 "\"count\": ", totals.count, ",\n"
                 "\"bodySize\": ", totals.bodySize, ",\n"
                 "\"averageWorth\": ", totals.count ? totals.worth / totals.count : 0, "\n"
+                "},\n"
+                "\"statistics\": {\n"
+                "\"evictionPolicy\": \"", statistics.evictionPolicy, "\",\n"
+                "\"hitCount\": ", hitCount, ",\n"
+                "\"memoryHitCount\": ", memoryHitCount, ",\n"
+                "\"missCount\": ", statistics.missCount, ",\n"
+                "\"hitRatio\": ", lookupCount ? static_cast<double>(hitCount) / lookupCount : 0, ",\n"
+                "\"evictedCount\": ", statistics.evictedRecordCount, ",\n"
+                "\"evictedBytes\": ", statistics.evictedBytes, "\n"
                 "}\n}\n"
             ).utf8();
             writeToFile(fd, writeData.data(), writeData.length());
@@ -593,6 +663,8 @@ void Cache::clear(WallTime modifiedSince, Function<void()>&& completionHandler)
 {
     LOG(NetworkCache, "(NetworkProcess) clearing cache");
 
+    m_memoryCache.clear();
+
     String anyType;
     m_storage->clear(anyType, modifiedSince, WTFMove(completionHandler));
 
@@ -26,6 +26,7 @@
 #pragma once
 
 #include "NetworkCacheEntry.h"
+#include "NetworkCacheMemoryCache.h"
 #include "NetworkCacheStorage.h"
 #include "PolicyDecision.h"
 #include "ShareableResource.h"
@@ -156,7 +157,7 @@ public:
     size_t capacity() const;
     void updateCapacity();
 
-    // Completion handler may get called back synchronously on failure.
+    // Completion handler may get called back synchronously on failure or on a memory cache hit.
     struct RetrieveInfo {
         MonotonicTime startTime;
         MonotonicTime completionTime;
@@ -194,6 +195,9 @@ public:
 
     String recordsPathIsolatedCopy() const;
 
+    const MemoryCache::Statistics& memoryCacheStatistics() const { return m_memoryCache.statistics(); }
+    Storage::Statistics storageStatistics() const { return m_storage->statistics(); }
+
 #if ENABLE(NETWORK_CACHE_STALE_WHILE_REVALIDATE)
     void startAsyncRevalidationIfNeeded(const PurCFetcher::ResourceRequest&, const NetworkCache::Key&, std::unique_ptr<Entry>&&, const GlobalFrameID&, Optional<NavigatingToAppBoundDomain>);
 #endif
@@ -207,11 +211,12 @@ public:
     ~Cache();
 
 private:
-    Cache(NetworkProcess&, const String& storageDirectory, Ref<Storage>&&, OptionSet<CacheOption>, PAL::SessionID);
+    Cache(NetworkProcess&, const String& storageDirectory, Ref<Storage>&&, size_t memoryCapacity, OptionSet<CacheOption>, PAL::SessionID);
 
     Key makeCacheKey(const PurCFetcher::ResourceRequest&);
 
     static void completeRetrieve(RetrieveCompletionHandler&&, std::unique_ptr<Entry>, RetrieveInfo&);
+    std::unique_ptr<Entry> applyUseDecision(UseDecision, std::unique_ptr<Entry>&&, const PurCFetcher::ResourceRequest&, const Key&, const GlobalFrameID&, Optional<NavigatingToAppBoundDomain>);
 
     String dumpFilePath() const;
     void deleteDumpFile();
@@ -219,6 +224,7 @@ private:
     Optional<Seconds> maxAgeCap(Entry&, const PurCFetcher::ResourceRequest&, PAL::SessionID);
 
     Ref<Storage> m_storage;
+    MemoryCache m_memoryCache;
     Ref<NetworkProcess> m_networkProcess;
 
 #if ENABLE(NETWORK_CACHE_STALE_WHILE_REVALIDATE)
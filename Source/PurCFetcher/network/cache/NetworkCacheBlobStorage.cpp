@@ -135,6 +135,22 @@ void BlobStorage::remove(const String& path)
     FileSystem::deleteFile(path);
 }
 
+void BlobStorage::remove(const String& path, const SHA1::Digest& hash)
+{
+    ASSERT(!RunLoop::isMain());
+
+    FileSystem::deleteFile(path);
+
+    auto blobPath = blobPathForHash(hash);
+    if (shareCount(blobPath))
+        return;
+
+    long long blobSize;
+    if (!FileSystem::getFileSize(blobPath, blobSize) || !FileSystem::deleteFile(blobPath))
+        return;
+    m_approximateSize -= std::min<size_t>(m_approximateSize, blobSize);
+}
+
 unsigned BlobStorage::shareCount(const String& path)
 {
     ASSERT(!RunLoop::isMain());
@@ -49,6 +49,8 @@ public:
 
     // Blob won't be removed until synchronization.
     void remove(const String& path);
+    // Also removes the blob if no other record links to it.
+    void remove(const String& path, const SHA1::Digest&);
 
     unsigned shareCount(const String& path);
 
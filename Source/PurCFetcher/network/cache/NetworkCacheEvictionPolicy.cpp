@@ -0,0 +1,412 @@
+/* 
+ * Copyright (C) 2020 Beijing FMSoft Technologies Co., Ltd.
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ * 
+ * Or,
+ * 
+ * As this component is a program released under LGPLv3, which claims
+ * explicitly that the program could be modified by any end user
+ * even if the program is conveyed in non-source form on the system it runs.
+ * Generally, if you distribute this program in embedded devices,
+ * you might not satisfy this condition. Under this situation or you can
+ * not accept any condition of LGPLv3, you need to get a commercial license
+ * from FMSoft, along with a patent license for the patents owned by FMSoft.
+ * 
+ * If you have got a commercial/patent license of this program, please use it
+ * under the terms and conditions of the commercial license.
+ * 
+ * For more information about the commercial license and patent license,
+ * please refer to
+ * <https://hybridos.fmsoft.cn/blog/hybridos-licensing-policy/>.
+ * 
+ * Also note that the LGPLv3 license does not apply to any entity in the
+ * Exception List published by Beijing FMSoft Technologies Co., Ltd.
+ * 
+ * If you are or the entity you represent is listed in the Exception List,
+ * the above open source or free software license does not apply to you
+ * or the entity you represent. Regardless of the purpose, you should not
+ * use the software in any way whatsoever, including but not limited to
+ * downloading, viewing, copying, distributing, compiling, and running.
+ * If you have already downloaded it, you MUST destroy all of its copies.
+ * 
+ * The Exception List is published by FMSoft and may be updated
+ * from time to time. For more information, please see
+ * <https://www.fmsoft.cn/exception-list>.
+ */ 
+
+#include "config.h"
+#include "NetworkCacheEvictionPolicy.h"
+
+#include "NetworkCacheRecordIndex.h"
+#include <limits>
+#include <wtf/HashMap.h>
+#include <wtf/ListHashSet.h>
+#include <wtf/Vector.h>
+
+namespace PurCFetcher {
+namespace NetworkCache {
+
+using RecordList = ListHashSet<Key::HashType, RecordIndexHash>;
+
+// Records enter the probation segment and move to the protected segment
+// when read again. The protected segment holds at most 80% of the bytes;
+// the records it pushes out go back to probation. Victims come from the
+// least recently used end of probation, then of the protected segment.
+class SegmentedLRU {
+public:
+    void add(const Key::HashType& hash, size_t size)
+    {
+        remove(hash);
+        m_sizes.add(hash, size);
+        m_probation.appendOrMoveToLast(hash);
+        m_probationSize += size;
+    }
+
+    bool access(const Key::HashType& hash)
+    {
+        auto it = m_sizes.find(hash);
+        if (it == m_sizes.end())
+            return false;
+
+        if (m_protected.contains(hash)) {
+            m_protected.appendOrMoveToLast(hash);
+            return true;
+        }
+
+        m_probation.remove(hash);
+        m_probationSize -= it->value;
+        m_protected.appendOrMoveToLast(hash);
+        m_protectedSize += it->value;
+
+        while (m_protected.size() > 1 && m_protectedSize * 5 > size() * 4) {
+            auto demoted = m_protected.takeFirst();
+            auto demotedSize = m_sizes.get(demoted);
+            m_protectedSize -= demotedSize;
+            m_probation.appendOrMoveToLast(demoted);
+            m_probationSize += demotedSize;
+        }
+        return true;
+    }
+
+    bool remove(const Key::HashType& hash)
+    {
+        auto it = m_sizes.find(hash);
+        if (it == m_sizes.end())
+            return false;
+
+        if (m_probation.remove(hash))
+            m_probationSize -= it->value;
+        else if (m_protected.remove(hash))
+            m_protectedSize -= it->value;
+        m_sizes.remove(it);
+        return true;
+    }
+
+    void clear()
+    {
+        m_sizes.clear();
+        m_probation.clear();
+        m_protected.clear();
+        m_probationSize = 0;
+        m_protectedSize = 0;
+    }
+
+    bool isEmpty() const { return m_sizes.isEmpty(); }
+    unsigned count() const { return m_sizes.size(); }
+    size_t size() const { return m_probationSize + m_protectedSize; }
+    size_t sizeOf(const Key::HashType& hash) const { return m_sizes.get(hash); }
+
+    Optional<Key::HashType> leastRecentlyUsed() const
+    {
+        if (!m_probation.isEmpty())
+            return m_probation.first();
+        if (!m_protected.isEmpty())
+            return m_protected.first();
+        return WTF::nullopt;
+    }
+
+private:
+    HashMap<Key::HashType, size_t, RecordIndexHash, RecordIndexHashTraits> m_sizes;
+    RecordList m_probation;
+    RecordList m_protected;
+    size_t m_probationSize { 0 };
+    size_t m_protectedSize { 0 };
+};
+
+class SegmentedLRUPolicy final : public EvictionPolicy {
+public:
+    const char* name() const final { return "lru"; }
+
+    void add(const Key::HashType& hash, size_t size) final { m_records.add(hash, size); }
+    void access(const Key::HashType& hash) final { m_records.access(hash); }
+    void remove(const Key::HashType& hash) final { m_records.remove(hash); }
+    void clear() final { m_records.clear(); }
+
+    Optional<Key::HashType> takeVictim() final
+    {
+        auto victim = m_records.leastRecentlyUsed();
+        if (victim)
+            m_records.remove(*victim);
+        return victim;
+    }
+
+private:
+    SegmentedLRU m_records;
+};
+
+// A count-min sketch of 4-bit counters estimating how often each record
+// was used recently. The counters are halved once the sketch has counted
+// ten times as many uses as it has counters, so old popularity fades.
+// Growing the sketch keeps the counts it has.
+class FrequencySketch {
+public:
+    FrequencySketch()
+    {
+        resize(minimumWidth);
+    }
+
+    void ensureCapacity(size_t recordCount)
+    {
+        if (recordCount > m_width)
+            resize(roundUpToPowerOfTwo(recordCount));
+    }
+
+    void increment(const Key::HashType& hash)
+    {
+        bool incremented = false;
+        for (unsigned row = 0; row < rowCount; ++row) {
+            auto& counter = m_counters[row * m_width + index(hash, row)];
+            if (counter < maximumCount) {
+                ++counter;
+                incremented = true;
+            }
+        }
+        if (incremented && ++m_additions >= 10 * m_width)
+            age();
+    }
+
+    unsigned frequency(const Key::HashType& hash) const
+    {
+        unsigned frequency = maximumCount;
+        for (unsigned row = 0; row < rowCount; ++row)
+            frequency = std::min<unsigned>(frequency, m_counters[row * m_width + index(hash, row)]);
+        return frequency;
+    }
+
+    void clear()
+    {
+        m_counters.fill(0);
+        m_additions = 0;
+    }
+
+private:
+    static const unsigned rowCount = 4;
+    static const uint8_t maximumCount = 15;
+    static const size_t minimumWidth = 1024;
+
+    static size_t roundUpToPowerOfTwo(size_t value)
+    {
+        size_t width = minimumWidth;
+        while (width < value)
+            width <<= 1;
+        return width;
+    }
+
+    size_t index(const Key::HashType& hash, unsigned row) const
+    {
+        // The key hash is a SHA1 digest; each row takes its own 4 bytes.
+        uint32_t value;
+        memcpy(&value, hash.data() + row * sizeof(value), sizeof(value));
+        return value & (m_width - 1);
+    }
+
+    void resize(size_t width)
+    {
+        // Widths are powers of two, so a hash that used counter i of the old
+        // row uses counter i or i + m_width of the new one. Copying each
+        // counter to both keeps every estimate.
+        Vector<uint8_t> counters;
+        counters.fill(0, rowCount * width);
+        if (m_width) {
+            for (unsigned row = 0; row < rowCount; ++row) {
+                for (size_t i = 0; i < width; ++i)
+                    counters[row * width + i] = m_counters[row * m_width + (i & (m_width - 1))];
+            }
+        }
+        m_counters = WTFMove(counters);
+        m_width = width;
+    }
+
+    void age()
+    {
+        for (auto& counter : m_counters)
+            counter >>= 1;
+        m_additions /= 2;
+    }
+
+    Vector<uint8_t> m_counters;
+    size_t m_width { 0 };
+    size_t m_additions { 0 };
+};
+
+// W-TinyLFU: new records wait in a small LRU window holding 1% of the
+// capacity, then ask to enter a segmented LRU holding the rest. Once that
+// is full, the window's oldest record gets in only if it was used more
+// often than the record the segmented LRU would drop; the loser of the
+// comparison is evicted first. A burst of records read once thus stays
+// out of the segmented LRU and does not flush the popular ones.
+class TinyLFUPolicy final : public EvictionPolicy {
+public:
+    const char* name() const final { return "tinylfu"; }
+
+    void setCapacity(size_t capacity) final { m_capacity = capacity; }
+
+    void add(const Key::HashType& hash, size_t size) final
+    {
+        remove(hash);
+        m_sketch.ensureCapacity(m_window.size() + m_main.count() + m_rejected.size() + 1);
+        m_sketch.increment(hash);
+        addToWindow(hash, size);
+    }
+
+    void access(const Key::HashType& hash) final
+    {
+        m_sketch.increment(hash);
+        if (m_window.contains(hash)) {
+            m_window.appendOrMoveToLast(hash);
+            return;
+        }
+        if (m_rejected.remove(hash)) {
+            // Read again before it was evicted; let it ask once more.
+            addToWindow(hash, m_sizes.take(hash));
+            return;
+        }
+        m_main.access(hash);
+    }
+
+    void remove(const Key::HashType& hash) final
+    {
+        if (m_window.remove(hash)) {
+            m_windowSize -= m_sizes.take(hash);
+            return;
+        }
+        if (m_rejected.remove(hash)) {
+            m_sizes.remove(hash);
+            return;
+        }
+        m_main.remove(hash);
+    }
+
+    void clear() final
+    {
+        m_window.clear();
+        m_windowSize = 0;
+        m_rejected.clear();
+        m_sizes.clear();
+        m_main.clear();
+        m_sketch.clear();
+    }
+
+    Optional<Key::HashType> takeVictim() final
+    {
+        if (!m_rejected.isEmpty()) {
+            auto victim = m_rejected.takeFirst();
+            m_sizes.remove(victim);
+            return victim;
+        }
+
+        // Nothing was rejected yet, e.g. the capacity shrank; compare the
+        // two ends the same way admission does.
+        auto mainVictim = m_main.leastRecentlyUsed();
+        if (!m_window.isEmpty()) {
+            auto candidate = m_window.first();
+            if (!mainVictim || m_sketch.frequency(candidate) <= m_sketch.frequency(*mainVictim)) {
+                remove(candidate);
+                return candidate;
+            }
+        }
+        if (mainVictim)
+            m_main.remove(*mainVictim);
+        return mainVictim;
+    }
+
+private:
+    static const unsigned windowPercentage = 1;
+
+    void addToWindow(const Key::HashType& hash, size_t size)
+    {
+        m_sizes.add(hash, size);
+        m_window.appendOrMoveToLast(hash);
+        m_windowSize += size;
+
+        while (m_window.size() > 1 && m_windowSize * 100 > std::min(m_capacity, m_windowSize + m_main.size()) * windowPercentage) {
+            auto candidate = m_window.takeFirst();
+            auto candidateSize = m_sizes.take(candidate);
+            m_windowSize -= candidateSize;
+            admit(candidate, candidateSize);
+        }
+    }
+
+    void admit(const Key::HashType& candidate, size_t size)
+    {
+        size_t mainCapacity = m_capacity - m_capacity / 100 * windowPercentage;
+        if (m_main.isEmpty() || m_main.size() + size <= mainCapacity) {
+            m_main.add(candidate, size);
+            return;
+        }
+
+        // The candidate loses ties; it has not proven itself yet.
+        if (m_sketch.frequency(candidate) <= m_sketch.frequency(*m_main.leastRecentlyUsed())) {
+            reject(candidate, size);
+            return;
+        }
+
+        while (!m_main.isEmpty() && m_main.size() + size > mainCapacity) {
+            auto victim = *m_main.leastRecentlyUsed();
+            auto victimSize = m_main.sizeOf(victim);
+            m_main.remove(victim);
+            reject(victim, victimSize);
+        }
+        m_main.add(candidate, size);
+    }
+
+    // The record stays on disk until the storage next shrinks, and is
+    // evicted before any other.
+    void reject(const Key::HashType& hash, size_t size)
+    {
+        m_sizes.add(hash, size);
+        m_rejected.appendOrMoveToLast(hash);
+    }
+
+    size_t m_capacity { std::numeric_limits<size_t>::max() };
+    RecordList m_window;
+    size_t m_windowSize { 0 };
+    // Records that lost admission, oldest first.
+    RecordList m_rejected;
+    // Sizes of the window and rejected records.
+    HashMap<Key::HashType, size_t, RecordIndexHash, RecordIndexHashTraits> m_sizes;
+    SegmentedLRU m_main;
+    FrequencySketch m_sketch;
+};
+
+std::unique_ptr<EvictionPolicy> EvictionPolicy::create(const String& name)
+{
+    if (equalLettersIgnoringASCIICase(name, "tinylfu"))
+        return makeUnique<TinyLFUPolicy>();
+    return makeUnique<SegmentedLRUPolicy>();
+}
+
+} // namespace NetworkCache
+} // namespace PurCFetcher
@@ -63,10 +63,6 @@ public:
 private:
     IOChannel(const String& filePath, IOChannel::Type, Optional<WorkQueue::QOS>);
 
-#if USE(SOUP)
-    void readSyncInThread(size_t offset, size_t, WorkQueue*, Function<void (Data&, int error)>&&);
-#endif
-
     String m_path;
     Type m_type;
 
@@ -27,16 +27,20 @@
 #include "NetworkCacheIOChannel.h"
 
 #include "NetworkCacheFileSystem.h"
+#include <errno.h>
+#include <gio/gfiledescriptorbased.h>
+#include <sys/stat.h>
+#include <unistd.h>
 #include <wtf/MainThread.h>
+#include <wtf/NeverDestroyed.h>
+#include <wtf/NumberOfCores.h>
 #include <wtf/RunLoop.h>
+#include <wtf/WorkerPool.h>
 #include <wtf/glib/GUniquePtr.h>
-#include <wtf/glib/RunLoopSourcePriority.h>
 
 namespace PurCFetcher {
 namespace NetworkCache {
 
-static const size_t gDefaultReadBufferSize = 4096;
-
 IOChannel::IOChannel(const String& filePath, Type type, Optional<WorkQueue::QOS>)
     : m_path(filePath)
     , m_type(type)
@@ -79,200 +83,108 @@ static inline void runTaskInQueue(Function<void ()>&& task, WorkQueue* queue)
     RunLoop::main().dispatch(WTFMove(task));
 }
 
-static void fillDataFromReadBuffer(SoupBuffer* readBuffer, size_t size, Data& data)
-{
-    GRefPtr<SoupBuffer> buffer;
-    if (size != readBuffer->length) {
-        // The subbuffer does not copy the data.
-        buffer = adoptGRef(soup_buffer_new_subbuffer(readBuffer, 0, size));
-    } else
-        buffer = readBuffer;
+static const unsigned maxIOWorkers = 4;
 
-    if (data.isNull()) {
-        // First chunk, we need to force the data to be copied.
-        data = { reinterpret_cast<const uint8_t*>(buffer->data), size };
-    } else {
-        Data dataRead(WTFMove(buffer));
-        // Concatenate will copy the data.
-        data = concatenate(data, dataRead);
-    }
+static WorkerPool& ioWorkerPool()
+{
+    // A cache lookup fans out to several files; their reads and writes
+    // share a few threads instead of each starting its own.
+    static NeverDestroyed<Ref<WorkerPool>> pool = WorkerPool::create("PurCFetcher Cache I/O"_s, std::min<unsigned>(maxIOWorkers, WTF::numberOfProcessorCores()), 10_s);
+    return pool.get();
 }
 
-struct ReadAsyncData {
-    RefPtr<IOChannel> channel;
-    GRefPtr<SoupBuffer> buffer;
-    RefPtr<WorkQueue> queue;
-    size_t bytesToRead;
-    Function<void (Data&, int error)> completionHandler;
-    Data data;
-};
+// The streams of local files are backed by a file descriptor, which is
+// read and written at an offset without moving a shared position.
+static int fileDescriptor(gpointer stream)
+{
+    if (!stream || !G_IS_FILE_DESCRIPTOR_BASED(stream))
+        return -1;
+    return g_file_descriptor_based_get_fd(G_FILE_DESCRIPTOR_BASED(stream));
+}
 
-static void inputStreamReadReadyCallback(GInputStream* stream, GAsyncResult* result, gpointer userData)
+static bool readAt(GInputStream* stream, size_t offset, size_t size, Data& data)
 {
-    std::unique_ptr<ReadAsyncData> asyncData(static_cast<ReadAsyncData*>(userData));
-    gssize bytesRead = g_input_stream_read_finish(stream, result, nullptr);
-    if (bytesRead == -1) {
-        WorkQueue* queue = asyncData->queue.get();
-        runTaskInQueue([asyncData = WTFMove(asyncData)] {
-            asyncData->completionHandler(asyncData->data, -1);
-        }, queue);
-        return;
+    int fd = fileDescriptor(stream);
+    if (fd == -1)
+        return false;
+
+    struct stat fileStat;
+    if (fstat(fd, &fileStat) == -1)
+        return false;
+
+    size_t fileSize = static_cast<size_t>(fileStat.st_size);
+    if (offset >= fileSize || !size)
+        return true;
+
+    // Read the whole range into one buffer instead of concatenating chunks.
+    size = std::min(size, fileSize - offset);
+    uint8_t* buffer = static_cast<uint8_t*>(fastMalloc(size));
+    size_t bytesRead = 0;
+    while (bytesRead < size) {
+        ssize_t result = pread(fd, buffer + bytesRead, size - bytesRead, offset + bytesRead);
+        if (result == -1) {
+            if (errno == EINTR)
+                continue;
+            fastFree(buffer);
+            return false;
+        }
+        if (!result)
+            break;
+        bytesRead += result;
     }
 
     if (!bytesRead) {
-        WorkQueue* queue = asyncData->queue.get();
-        runTaskInQueue([asyncData = WTFMove(asyncData)] {
-            asyncData->completionHandler(asyncData->data, 0);
-        }, queue);
-        return;
+        fastFree(buffer);
+        return true;
     }
 
-    ASSERT(bytesRead > 0);
-    fillDataFromReadBuffer(asyncData->buffer.get(), static_cast<size_t>(bytesRead), asyncData->data);
-
-    size_t pendingBytesToRead = asyncData->bytesToRead - asyncData->data.size();
-    if (!pendingBytesToRead) {
-        WorkQueue* queue = asyncData->queue.get();
-        runTaskInQueue([asyncData = WTFMove(asyncData)] {
-            asyncData->completionHandler(asyncData->data, 0);
-        }, queue);
-        return;
-    }
-
-    size_t bytesToRead = std::min(pendingBytesToRead, asyncData->buffer->length);
-    // Use a local variable for the data buffer to pass it to g_input_stream_read_async(), because ReadAsyncData is released.
-    auto data = const_cast<char*>(asyncData->buffer->data);
-    g_input_stream_read_async(stream, data, bytesToRead, RunLoopSourcePriority::DiskCacheRead, nullptr,
-        reinterpret_cast<GAsyncReadyCallback>(inputStreamReadReadyCallback), asyncData.release());
+    data = { adoptGRef(soup_buffer_new_with_owner(buffer, bytesRead, buffer, fastFree)) };
+    return true;
 }
 
-void IOChannel::read(size_t offset, size_t size, WorkQueue* queue, Function<void (Data&, int error)>&& completionHandler)
+static bool writeAt(GOutputStream* stream, size_t offset, const Data& data)
 {
-    RefPtr<IOChannel> channel(this);
-    if (!m_inputStream) {
-        runTaskInQueue([channel, completionHandler = WTFMove(completionHandler)] {
-            Data data;
-            completionHandler(data, -1);
-        }, queue);
-        return;
-    }
-
-    if (!RunLoop::isMain()) {
-        readSyncInThread(offset, size, queue, WTFMove(completionHandler));
-        return;
+    int fd = fileDescriptor(stream);
+    if (fd == -1)
+        return false;
+
+    size_t bytesWritten = 0;
+    while (bytesWritten < data.size()) {
+        ssize_t result = pwrite(fd, data.data() + bytesWritten, data.size() - bytesWritten, offset + bytesWritten);
+        if (result == -1) {
+            if (errno == EINTR)
+                continue;
+            return false;
+        }
+        bytesWritten += result;
     }
-
-    size_t bufferSize = std::min(size, gDefaultReadBufferSize);
-    uint8_t* bufferData = static_cast<uint8_t*>(fastMalloc(bufferSize));
-    GRefPtr<SoupBuffer> buffer = adoptGRef(soup_buffer_new_with_owner(bufferData, bufferSize, bufferData, fastFree));
-    ReadAsyncData* asyncData = new ReadAsyncData { this, buffer.get(), queue, size, WTFMove(completionHandler), { } };
-
-    // FIXME: implement offset.
-    g_input_stream_read_async(m_inputStream.get(), const_cast<char*>(buffer->data), bufferSize, RunLoopSourcePriority::DiskCacheRead, nullptr,
-        reinterpret_cast<GAsyncReadyCallback>(inputStreamReadReadyCallback), asyncData);
+    return true;
 }
 
-void IOChannel::readSyncInThread(size_t offset, size_t size, WorkQueue* queue, Function<void (Data&, int error)>&& completionHandler)
+void IOChannel::read(size_t offset, size_t size, WorkQueue* queue, Function<void (Data&, int error)>&& completionHandler)
 {
-    UNUSED_PARAM(offset);
-    ASSERT(!RunLoop::isMain());
-
-    RefPtr<IOChannel> channel(this);
-    Thread::create("IOChannel::readSync", [channel, size, queue, completionHandler = WTFMove(completionHandler)] () mutable {
-        size_t bufferSize = std::min(size, gDefaultReadBufferSize);
-        uint8_t* bufferData = static_cast<uint8_t*>(fastMalloc(bufferSize));
-        GRefPtr<SoupBuffer> readBuffer = adoptGRef(soup_buffer_new_with_owner(bufferData, bufferSize, bufferData, fastFree));
+    ioWorkerPool().postTask([channel = makeRef(*this), offset, size, queue = makeRefPtr(queue), completionHandler = WTFMove(completionHandler)]() mutable {
         Data data;
-        size_t pendingBytesToRead = size;
-        size_t bytesToRead = bufferSize;
-        do {
-            // FIXME: implement offset.
-            gssize bytesRead = g_input_stream_read(channel->m_inputStream.get(), const_cast<char*>(readBuffer->data), bytesToRead, nullptr, nullptr);
-            if (bytesRead == -1) {
-                runTaskInQueue([channel, completionHandler = WTFMove(completionHandler)] {
-                    Data data;
-                    completionHandler(data, -1);
-                }, queue);
-                return;
-            }
-
-            if (!bytesRead)
-                break;
-
-            ASSERT(bytesRead > 0);
-            fillDataFromReadBuffer(readBuffer.get(), static_cast<size_t>(bytesRead), data);
-
-            pendingBytesToRead = size - data.size();
-            bytesToRead = std::min(pendingBytesToRead, readBuffer->length);
-        } while (pendingBytesToRead);
-
-        GRefPtr<SoupBuffer> bufferCapture = data.soupBuffer();
-        runTaskInQueue([channel, bufferCapture, completionHandler = WTFMove(completionHandler)] {
-            GRefPtr<SoupBuffer> buffer = bufferCapture;
-            Data data = { WTFMove(buffer) };
-            completionHandler(data, 0);
-        }, queue);
-    })->detach();
-}
-
-struct WriteAsyncData {
-    RefPtr<IOChannel> channel;
-    GRefPtr<SoupBuffer> buffer;
-    RefPtr<WorkQueue> queue;
-    Function<void (int error)> completionHandler;
-};
-
-static void outputStreamWriteReadyCallback(GOutputStream* stream, GAsyncResult* result, gpointer userData)
-{
-    std::unique_ptr<WriteAsyncData> asyncData(static_cast<WriteAsyncData*>(userData));
-    gssize bytesWritten = g_output_stream_write_finish(stream, result, nullptr);
-    if (bytesWritten == -1) {
-        WorkQueue* queue = asyncData->queue.get();
-        runTaskInQueue([asyncData = WTFMove(asyncData)] {
-            asyncData->completionHandler(-1);
-        }, queue);
-        return;
-    }
-
-    gssize pendingBytesToWrite = asyncData->buffer->length - bytesWritten;
-    if (!pendingBytesToWrite) {
-        WorkQueue* queue = asyncData->queue.get();
-        runTaskInQueue([asyncData = WTFMove(asyncData)] {
-            asyncData->completionHandler(0);
-        }, queue);
-        return;
-    }
-
-    asyncData->buffer = adoptGRef(soup_buffer_new_subbuffer(asyncData->buffer.get(), bytesWritten, pendingBytesToWrite));
-    // Use a local variable for the data buffer to pass it to g_output_stream_write_async(), because WriteAsyncData is released.
-    auto data = asyncData->buffer->data;
-    g_output_stream_write_async(stream, data, pendingBytesToWrite, RunLoopSourcePriority::DiskCacheWrite, nullptr,
-        reinterpret_cast<GAsyncReadyCallback>(outputStreamWriteReadyCallback), asyncData.release());
+        bool success = readAt(channel->m_inputStream.get(), offset, size, data);
+        auto* resultQueue = queue.get();
+        runTaskInQueue([channel = WTFMove(channel), queue = WTFMove(queue), data = WTFMove(data), success, completionHandler = WTFMove(completionHandler)]() mutable {
+            completionHandler(data, success ? 0 : -1);
+        }, resultQueue);
+    });
 }
 
 void IOChannel::write(size_t offset, const Data& data, WorkQueue* queue, Function<void (int error)>&& completionHandler)
 {
-    UNUSED_PARAM(offset);
-    RefPtr<IOChannel> channel(this);
-    if (!m_outputStream && !m_ioStream) {
-        runTaskInQueue([channel, completionHandler = WTFMove(completionHandler)] {
-            completionHandler(-1);
-        }, queue);
-        return;
-    }
-
-    GOutputStream* stream = m_outputStream ? m_outputStream.get() : g_io_stream_get_output_stream(G_IO_STREAM(m_ioStream.get()));
-    if (!stream) {
-        runTaskInQueue([channel, completionHandler = WTFMove(completionHandler)] {
-            completionHandler(-1);
-        }, queue);
-        return;
-    }
-
-    WriteAsyncData* asyncData = new WriteAsyncData { this, data.soupBuffer(), queue, WTFMove(completionHandler) };
-    // FIXME: implement offset.
-    g_output_stream_write_async(stream, asyncData->buffer->data, data.size(), RunLoopSourcePriority::DiskCacheWrite, nullptr,
-        reinterpret_cast<GAsyncReadyCallback>(outputStreamWriteReadyCallback), asyncData);
+    ioWorkerPool().postTask([channel = makeRef(*this), offset, data, queue = makeRefPtr(queue), completionHandler = WTFMove(completionHandler)]() mutable {
+        GOutputStream* stream = channel->m_outputStream.get();
+        if (!stream && channel->m_ioStream)
+            stream = g_io_stream_get_output_stream(G_IO_STREAM(channel->m_ioStream.get()));
+        bool success = writeAt(stream, offset, data);
+        auto* resultQueue = queue.get();
+        runTaskInQueue([channel = WTFMove(channel), queue = WTFMove(queue), success, completionHandler = WTFMove(completionHandler)]() mutable {
+            completionHandler(success ? 0 : -1);
+        }, resultQueue);
+    });
 }
 
 } // namespace NetworkCache
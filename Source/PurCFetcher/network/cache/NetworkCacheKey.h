@@ -77,6 +77,7 @@ public:
     const HashType& partitionHash() const { return m_partitionHash; }
 
     static bool stringToHash(const String&, HashType&);
+    static String hashAsString(const HashType&);
 
     static size_t hashStringLength() { return 2 * sizeof(m_hash); }
     String hashAsString() const { return hashAsString(m_hash); }
@@ -89,7 +90,6 @@ public:
     bool operator!=(const Key& other) const { return !(*this == other); }
 
 private:
-    static String hashAsString(const HashType&);
     HashType computeHash(const Salt&) const;
     HashType computePartitionHash(const Salt&) const;
 
@@ -0,0 +1,155 @@
+/* 
+ * Copyright (C) 2020 Beijing FMSoft Technologies Co., Ltd.
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ * 
+ * Or,
+ * 
+ * As this component is a program released under LGPLv3, which claims
+ * explicitly that the program could be modified by any end user
+ * even if the program is conveyed in non-source form on the system it runs.
+ * Generally, if you distribute this program in embedded devices,
+ * you might not satisfy this condition. Under this situation or you can
+ * not accept any condition of LGPLv3, you need to get a commercial license
+ * from FMSoft, along with a patent license for the patents owned by FMSoft.
+ * 
+ * If you have got a commercial/patent license of this program, please use it
+ * under the terms and conditions of the commercial license.
+ * 
+ * For more information about the commercial license and patent license,
+ * please refer to
+ * <https://hybridos.fmsoft.cn/blog/hybridos-licensing-policy/>.
+ * 
+ * Also note that the LGPLv3 license does not apply to any entity in the
+ * Exception List published by Beijing FMSoft Technologies Co., Ltd.
+ * 
+ * If you are or the entity you represent is listed in the Exception List,
+ * the above open source or free software license does not apply to you
+ * or the entity you represent. Regardless of the purpose, you should not
+ * use the software in any way whatsoever, including but not limited to
+ * downloading, viewing, copying, distributing, compiling, and running.
+ * If you have already downloaded it, you MUST destroy all of its copies.
+ * 
+ * The Exception List is published by FMSoft and may be updated
+ * from time to time. For more information, please see
+ * <https://www.fmsoft.cn/exception-list>.
+ */ 
+
+#include "config.h"
+#include "NetworkCacheMemoryCache.h"
+
+#include "NetworkCacheRecordIndex.h"
+#include "SharedBuffer.h"
+#include <wtf/HashSet.h>
+
+namespace PurCFetcher {
+namespace NetworkCache {
+
+MemoryCache::MemoryCache(size_t capacity)
+    : m_capacity(capacity)
+{
+}
+
+void MemoryCache::setCapacity(size_t capacity)
+{
+    m_capacity = capacity;
+    shrinkToCapacity();
+}
+
+size_t MemoryCache::entrySize(const Entry& entry)
+{
+    size_t size = sizeof(CachedEntry);
+    for (auto& header : entry.response().httpHeaderFields())
+        size += header.key.length() + header.value.length();
+    if (auto* buffer = entry.buffer())
+        size += buffer->size();
+    return size;
+}
+
+std::unique_ptr<Entry> MemoryCache::find(const Key& key)
+{
+    auto it = m_entries.find(key);
+    if (it == m_entries.end()) {
+        m_statistics.missCount++;
+        return nullptr;
+    }
+
+    m_statistics.hitCount++;
+    m_recentlyUsedKeys.appendOrMoveToLast(key);
+    return makeUnique<Entry>(it->value->entry);
+}
+
+void MemoryCache::add(const Entry& entry)
+{
+    remove(entry.key());
+
+    // Redirects are rare and cheap to load; the large bodies would push
+    // everything else out.
+    if (entry.redirectRequest())
+        return;
+    size_t size = entrySize(entry);
+    if (size > m_capacity / 8)
+        return;
+
+    m_entries.add(entry.key(), makeUnique<CachedEntry>(entry, size));
+    m_recentlyUsedKeys.add(entry.key());
+    m_size += size;
+    shrinkToCapacity();
+}
+
+void MemoryCache::remove(const Key& key)
+{
+    auto cachedEntry = m_entries.take(key);
+    if (!cachedEntry)
+        return;
+
+    m_recentlyUsedKeys.remove(key);
+    m_size -= cachedEntry->size;
+}
+
+void MemoryCache::remove(const Vector<Key::HashType>& hashes)
+{
+    if (m_entries.isEmpty())
+        return;
+
+    HashSet<Key::HashType, RecordIndexHash, RecordIndexHashTraits> hashSet;
+    for (auto& hash : hashes)
+        hashSet.add(hash);
+
+    Vector<Key> keysToRemove;
+    for (auto& key : m_entries.keys()) {
+        if (hashSet.contains(key.hash()))
+            keysToRemove.append(key);
+    }
+    for (auto& key : keysToRemove)
+        remove(key);
+}
+
+void MemoryCache::clear()
+{
+    m_entries.clear();
+    m_recentlyUsedKeys.clear();
+    m_size = 0;
+}
+
+void MemoryCache::shrinkToCapacity()
+{
+    while (m_size > m_capacity && !m_recentlyUsedKeys.isEmpty()) {
+        Key leastRecentlyUsedKey = m_recentlyUsedKeys.first();
+        remove(leastRecentlyUsedKey);
+    }
+}
+
+} // namespace NetworkCache
+} // namespace PurCFetcher
@@ -0,0 +1,111 @@
+/* 
+ * Copyright (C) 2020 Beijing FMSoft Technologies Co., Ltd.
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ * 
+ * Or,
+ * 
+ * As this component is a program released under LGPLv3, which claims
+ * explicitly that the program could be modified by any end user
+ * even if the program is conveyed in non-source form on the system it runs.
+ * Generally, if you distribute this program in embedded devices,
+ * you might not satisfy this condition. Under this situation or you can
+ * not accept any condition of LGPLv3, you need to get a commercial license
+ * from FMSoft, along with a patent license for the patents owned by FMSoft.
+ * 
+ * If you have got a commercial/patent license of this program, please use it
+ * under the terms and conditions of the commercial license.
+ * 
+ * For more information about the commercial license and patent license,
+ * please refer to
+ * <https://hybridos.fmsoft.cn/blog/hybridos-licensing-policy/>.
+ * 
+ * Also note that the LGPLv3 license does not apply to any entity in the
+ * Exception List published by Beijing FMSoft Technologies Co., Ltd.
+ * 
+ * If you are or the entity you represent is listed in the Exception List,
+ * the above open source or free software license does not apply to you
+ * or the entity you represent. Regardless of the purpose, you should not
+ * use the software in any way whatsoever, including but not limited to
+ * downloading, viewing, copying, distributing, compiling, and running.
+ * If you have already downloaded it, you MUST destroy all of its copies.
+ * 
+ * The Exception List is published by FMSoft and may be updated
+ * from time to time. For more information, please see
+ * <https://www.fmsoft.cn/exception-list>.
+ */ 
+
+#pragma once
+
+#include "NetworkCacheEntry.h"
+#include "NetworkCacheKey.h"
+#include <wtf/HashMap.h>
+#include <wtf/ListHashSet.h>
+
+namespace PurCFetcher {
+namespace NetworkCache {
+
+// The most recently used entries of the disk cache, kept decoded in memory
+// so that a hit on a small, often requested resource does not go through
+// the storage. The entries are dropped least recently used first once their
+// headers and bodies take more than the capacity.
+class MemoryCache {
+    WTF_MAKE_NONCOPYABLE(MemoryCache);
+    WTF_MAKE_FAST_ALLOCATED;
+public:
+    explicit MemoryCache(size_t capacity);
+
+    size_t capacity() const { return m_capacity; }
+    void setCapacity(size_t);
+
+    // Returns a copy the caller may modify, sharing the body buffer.
+    std::unique_ptr<Entry> find(const Key&);
+
+    void add(const Entry&);
+    void remove(const Key&);
+    // Drops the entries whose key hash is listed.
+    void remove(const Vector<Key::HashType>&);
+    void clear();
+
+    struct Statistics {
+        uint64_t hitCount { 0 };
+        uint64_t missCount { 0 };
+    };
+    const Statistics& statistics() const { return m_statistics; }
+
+private:
+    static size_t entrySize(const Entry&);
+    void shrinkToCapacity();
+
+    struct CachedEntry {
+        WTF_MAKE_STRUCT_FAST_ALLOCATED;
+        CachedEntry(const Entry& entry, size_t size)
+            : entry(entry)
+            , size(size)
+        {
+        }
+
+        Entry entry;
+        size_t size;
+    };
+
+    HashMap<Key, std::unique_ptr<CachedEntry>> m_entries;
+    ListHashSet<Key> m_recentlyUsedKeys;
+    size_t m_capacity;
+    size_t m_size { 0 };
+    Statistics m_statistics;
+};
+
+} // namespace NetworkCache
+} // namespace PurCFetcher
@@ -0,0 +1,775 @@
+/* 
+ * Copyright (C) 2020 Beijing FMSoft Technologies Co., Ltd.
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ * 
+ * Or,
+ * 
+ * As this component is a program released under LGPLv3, which claims
+ * explicitly that the program could be modified by any end user
+ * even if the program is conveyed in non-source form on the system it runs.
+ * Generally, if you distribute this program in embedded devices,
+ * you might not satisfy this condition. Under this situation or you can
+ * not accept any condition of LGPLv3, you need to get a commercial license
+ * from FMSoft, along with a patent license for the patents owned by FMSoft.
+ * 
+ * If you have got a commercial/patent license of this program, please use it
+ * under the terms and conditions of the commercial license.
+ * 
+ * For more information about the commercial license and patent license,
+ * please refer to
+ * <https://hybridos.fmsoft.cn/blog/hybridos-licensing-policy/>.
+ * 
+ * Also note that the LGPLv3 license does not apply to any entity in the
+ * Exception List published by Beijing FMSoft Technologies Co., Ltd.
+ * 
+ * If you are or the entity you represent is listed in the Exception List,
+ * the above open source or free software license does not apply to you
+ * or the entity you represent. Regardless of the purpose, you should not
+ * use the software in any way whatsoever, including but not limited to
+ * downloading, viewing, copying, distributing, compiling, and running.
+ * If you have already downloaded it, you MUST destroy all of its copies.
+ * 
+ * The Exception List is published by FMSoft and may be updated
+ * from time to time. For more information, please see
+ * <https://www.fmsoft.cn/exception-list>.
+ */ 
+
+#include "config.h"
+#include "NetworkCacheRecordIndex.h"
+
+#include "Logging.h"
+#include "NetworkCacheCoders.h"
+#include "NetworkCacheData.h"
+#include <wtf/ProcessID.h>
+#include <wtf/RunLoop.h>
+#include <wtf/text/StringConcatenateNumbers.h>
+
+namespace PurCFetcher {
+namespace NetworkCache {
+
+static const uint32_t indexMagic = 0x49524350; // "PCRI"
+static const uint32_t indexVersion = 1;
+
+// Compact when the journal grows to twice the size its entries would take
+// if written afresh.
+static const size_t estimatedEntrySize = 128;
+static const size_t minimumCompactionSize = 1 << 20;
+
+static bool isNullHash(const SHA1::Digest& hash)
+{
+    return std::all_of(hash.begin(), hash.end(), [](uint8_t byte) { return !byte; });
+}
+
+// Each record is its size followed by the encoded fields and checksum.
+static Vector<uint8_t> frameRecord(const WTF::Persistence::Encoder& encoder)
+{
+    uint32_t length = encoder.bufferSize();
+    Vector<uint8_t> record;
+    record.reserveInitialCapacity(sizeof(length) + length);
+    record.append(reinterpret_cast<const uint8_t*>(&length), sizeof(length));
+    record.append(encoder.buffer(), length);
+    return record;
+}
+
+static bool decodeIndexHeader(const uint8_t* data, size_t size)
+{
+    WTF::Persistence::Decoder decoder(data, size);
+
+    Optional<uint32_t> magic;
+    decoder >> magic;
+    if (!magic || *magic != indexMagic)
+        return false;
+
+    Optional<uint32_t> version;
+    decoder >> version;
+    if (!version || *version != indexVersion)
+        return false;
+
+    return decoder.verifyChecksum();
+}
+
+RecordIndex::RecordIndex(const String& path)
+    : m_path(path.isolatedCopy())
+    , m_evictionPolicy(EvictionPolicy::create({ }))
+{
+}
+
+RecordIndex::~RecordIndex()
+{
+    if (FileSystem::isHandleValid(m_handle))
+        FileSystem::closeFile(m_handle);
+    if (FileSystem::isHandleValid(m_lockHandle))
+        FileSystem::unlockAndCloseFile(m_lockHandle);
+}
+
+bool RecordIndex::lockJournal()
+{
+    if (FileSystem::isHandleValid(m_lockHandle))
+        return true;
+
+    // The journal itself is replaced on compaction, so lock a file which
+    // stays in place. The lock goes with the process.
+    auto handle = FileSystem::openFile(m_path + ".lock", FileSystem::FileOpenMode::Write);
+    if (!FileSystem::isHandleValid(handle))
+        return false;
+
+#if USE(FILE_LOCK)
+    if (!FileSystem::lockFile(handle, { FileSystem::FileLockMode::Exclusive, FileSystem::FileLockMode::Nonblocking })) {
+        LOG(NetworkCacheStorage, "(NetworkProcess) cache index is written by another process");
+        FileSystem::closeFile(handle);
+        return false;
+    }
+#endif
+
+    m_lockHandle = handle;
+    return true;
+}
+
+bool RecordIndex::load()
+{
+    ASSERT(!RunLoop::isMain());
+
+    auto locker = holdLock(m_lock);
+    ASSERT(!m_isLoaded);
+
+    bool isWriter = lockJournal();
+
+    auto data = mapFile(m_path);
+    if (data.isNull() || data.isEmpty())
+        return false;
+
+    size_t offset = replay(data.data(), data.size(), false);
+    bool hasHeader = offset;
+    if (hasHeader && isWriter)
+        m_handle = FileSystem::openFile(m_path, FileSystem::FileOpenMode::ReadWrite);
+
+    if (!hasHeader || (isWriter && !FileSystem::isHandleValid(m_handle))) {
+        m_entries.clear();
+        m_blobShareCounts.clear();
+        m_size = 0;
+        m_count = 0;
+        return false;
+    }
+
+    // Drop the record a crash left half written. Without the lock, the
+    // tail may be a record the writer is appending right now.
+    if (isWriter) {
+        if (offset < data.size()) {
+            LOG(NetworkCacheStorage, "(NetworkProcess) truncating cache index from %zu to %zu bytes", data.size(), offset);
+            FileSystem::truncateFile(m_handle, offset);
+        }
+        FileSystem::seekFile(m_handle, offset, FileSystem::FileSeekOrigin::Beginning);
+        m_journalSize = offset;
+        mergeSideJournals();
+    } else
+        openSideJournal();
+
+    m_isLoaded = true;
+    seedEvictionPolicy();
+    applyPendingRecords();
+    return true;
+}
+
+void RecordIndex::rebuild(Vector<RecoveredRecord>&& records)
+{
+    ASSERT(!RunLoop::isMain());
+
+    auto locker = holdLock(m_lock);
+
+    m_entries.clear();
+    m_blobShareCounts.clear();
+    m_size = 0;
+    m_count = 0;
+
+    for (auto& record : records) {
+        Entry entry;
+        entry.partitionHash = record.partitionHash;
+        entry.typeIndex = typeIndex(record.type);
+        entry.recordSize = record.recordSize;
+        entry.hasBlob = record.hasBlob;
+        entry.blobSize = record.blobSize;
+        entry.creationTime = record.times.creation;
+        // Reads update the modification time of the record file.
+        entry.accessTime = record.times.modification;
+        addEntry(record.hash, WTFMove(entry));
+    }
+
+    // Without a file the index still serves this session; the next one
+    // rebuilds it again.
+    if (!lockJournal())
+        openSideJournal();
+    else if (rewrite())
+        mergeSideJournals();
+    else
+        LOG(NetworkCacheStorage, "(NetworkProcess) not writing the cache index");
+
+    m_isLoaded = true;
+    seedEvictionPolicy();
+    applyPendingRecords();
+}
+
+void RecordIndex::add(const Key& key, uint64_t recordSize, const SHA1::Digest* blobHash, uint64_t blobSize)
+{
+    Entry entry;
+    entry.partitionHash = key.partitionHash();
+    entry.recordSize = recordSize;
+    entry.hasBlob = !!blobHash;
+    if (blobHash) {
+        entry.blobHash = *blobHash;
+        entry.blobSize = blobSize;
+    }
+    entry.creationTime = WallTime::now();
+    entry.accessTime = entry.creationTime;
+
+    auto locker = holdLock(m_lock);
+    entry.typeIndex = typeIndex(key.type());
+    auto record = encodeAdd(key.hash(), entry);
+    if (!m_isLoaded) {
+        m_pendingRecords.append(WTFMove(record));
+        return;
+    }
+    addEntry(key.hash(), WTFMove(entry));
+    append(record);
+}
+
+void RecordIndex::touch(const Key::HashType& hash)
+{
+    auto accessTime = WallTime::now();
+
+    WTF::Persistence::Encoder encoder;
+    encoder << static_cast<uint8_t>(Operation::Touch);
+    encoder << hash;
+    encoder << accessTime;
+    encoder.encodeChecksum();
+
+    auto locker = holdLock(m_lock);
+    if (!m_isLoaded) {
+        m_pendingRecords.append(frameRecord(encoder));
+        return;
+    }
+    if (!m_entries.contains(hash))
+        return;
+    touchEntry(hash, accessTime);
+    append(frameRecord(encoder));
+}
+
+size_t RecordIndex::remove(const Key::HashType& hash)
+{
+    auto record = encodeRemove(hash);
+
+    auto locker = holdLock(m_lock);
+    if (!m_isLoaded) {
+        m_pendingRecords.append(WTFMove(record));
+        return 0;
+    }
+    if (!m_entries.contains(hash))
+        return 0;
+    size_t removedSize = removeEntry(hash);
+    append(record);
+    return removedSize;
+}
+
+void RecordIndex::clear(const String& type, WallTime modifiedSinceTime)
+{
+    auto locker = holdLock(m_lock);
+    // Entries loaded later whose files were deleted meanwhile are dropped
+    // when reading them fails.
+    if (!m_isLoaded)
+        return;
+
+    Vector<Key::HashType> hashesToRemove;
+    for (auto& it : m_entries) {
+        if (!type.isEmpty() && m_types[it.value.typeIndex] != type)
+            continue;
+        if (it.value.accessTime < modifiedSinceTime)
+            continue;
+        hashesToRemove.append(it.key);
+    }
+    for (auto& hash : hashesToRemove)
+        removeEntry(hash);
+
+    // Replacing the journal is up to the process writing it; the others
+    // journal each removal for it to merge.
+    if (FileSystem::isHandleValid(m_lockHandle)) {
+        rewrite();
+        return;
+    }
+    for (auto& hash : hashesToRemove)
+        append(encodeRemove(hash));
+}
+
+void RecordIndex::setEvictionPolicy(std::unique_ptr<EvictionPolicy>&& evictionPolicy)
+{
+    auto locker = holdLock(m_lock);
+    m_evictionPolicy = WTFMove(evictionPolicy);
+    if (m_isLoaded)
+        seedEvictionPolicy();
+    else
+        m_evictionPolicy->setCapacity(m_evictionCapacity);
+}
+
+void RecordIndex::setEvictionCapacity(size_t capacity)
+{
+    auto locker = holdLock(m_lock);
+    m_evictionCapacity = capacity;
+    m_evictionPolicy->setCapacity(capacity);
+}
+
+const char* RecordIndex::evictionPolicyName() const
+{
+    auto locker = holdLock(m_lock);
+    return m_evictionPolicy->name();
+}
+
+Vector<std::pair<Key::HashType, RecordIndex::Entry>> RecordIndex::takeEvictionCandidates(unsigned maximumCount)
+{
+    auto locker = holdLock(m_lock);
+
+    Vector<std::pair<Key::HashType, Entry>> candidates;
+    if (!m_isLoaded)
+        return candidates;
+
+    while (candidates.size() < maximumCount) {
+        auto victim = m_evictionPolicy->takeVictim();
+        if (!victim)
+            break;
+        auto it = m_entries.find(*victim);
+        if (it != m_entries.end())
+            candidates.append({ it->key, it->value });
+    }
+    return candidates;
+}
+
+void RecordIndex::forEach(const Visitor& visitor) const
+{
+    auto locker = holdLock(m_lock);
+    for (auto& it : m_entries)
+        visitor(it.key, it.value);
+}
+
+String RecordIndex::type(const Entry& entry) const
+{
+    auto locker = holdLock(m_lock);
+    return m_types[entry.typeIndex].isolatedCopy();
+}
+
+void RecordIndex::compactIfNeeded()
+{
+    auto locker = holdLock(m_lock);
+    // Also when another process writes the journal.
+    if (!m_isLoaded || !FileSystem::isHandleValid(m_lockHandle) || !FileSystem::isHandleValid(m_handle))
+        return;
+
+    mergeSideJournals();
+
+    size_t compactedSize = std::max<size_t>(m_count * estimatedEntrySize, minimumCompactionSize);
+    if (m_journalSize <= 2 * compactedSize)
+        return;
+
+    LOG(NetworkCacheStorage, "(NetworkProcess) compacting cache index journalSize=%zu count=%u", m_journalSize, m_count.load());
+    rewrite();
+}
+
+size_t RecordIndex::replay(const uint8_t* bytes, size_t size, bool shouldAppend)
+{
+    size_t offset = 0;
+    bool hasHeader = false;
+    while (size - offset >= sizeof(uint32_t)) {
+        uint32_t length;
+        memcpy(&length, bytes + offset, sizeof(length));
+        if (!length || length > size - offset - sizeof(length))
+            break;
+
+        const uint8_t* record = bytes + offset + sizeof(length);
+        if (!hasHeader) {
+            if (!decodeIndexHeader(record, length))
+                break;
+            hasHeader = true;
+        } else if (!apply(record, length))
+            break;
+        else if (shouldAppend) {
+            Vector<uint8_t> framedRecord;
+            framedRecord.append(bytes + offset, sizeof(length) + length);
+            append(framedRecord);
+        }
+        offset += sizeof(length) + length;
+    }
+    return hasHeader ? offset : 0;
+}
+
+bool RecordIndex::apply(const uint8_t* data, size_t size)
+{
+    WTF::Persistence::Decoder decoder(data, size);
+
+    Optional<uint8_t> operation;
+    decoder >> operation;
+    if (!operation)
+        return false;
+
+    Optional<Key::HashType> hash;
+    decoder >> hash;
+    if (!hash)
+        return false;
+
+    switch (static_cast<Operation>(*operation)) {
+    case Operation::Add: {
+        Optional<Key::HashType> partitionHash;
+        decoder >> partitionHash;
+        if (!partitionHash)
+            return false;
+
+        Optional<String> type;
+        decoder >> type;
+        if (!type)
+            return false;
+
+        Optional<uint64_t> recordSize;
+        decoder >> recordSize;
+        if (!recordSize)
+            return false;
+
+        Optional<bool> hasBlob;
+        decoder >> hasBlob;
+        if (!hasBlob)
+            return false;
+
+        Optional<SHA1::Digest> blobHash;
+        decoder >> blobHash;
+        if (!blobHash)
+            return false;
+
+        Optional<uint64_t> blobSize;
+        decoder >> blobSize;
+        if (!blobSize)
+            return false;
+
+        Optional<WallTime> creationTime;
+        decoder >> creationTime;
+        if (!creationTime)
+            return false;
+
+        Optional<WallTime> accessTime;
+        decoder >> accessTime;
+        if (!accessTime)
+            return false;
+
+        if (!decoder.verifyChecksum())
+            return false;
+
+        Entry entry;
+        entry.partitionHash = *partitionHash;
+        entry.typeIndex = typeIndex(*type);
+        entry.recordSize = *recordSize;
+        entry.hasBlob = *hasBlob;
+        entry.blobHash = *blobHash;
+        entry.blobSize = *blobSize;
+        entry.creationTime = *creationTime;
+        entry.accessTime = *accessTime;
+        addEntry(*hash, WTFMove(entry));
+        return true;
+    }
+    case Operation::Touch: {
+        Optional<WallTime> accessTime;
+        decoder >> accessTime;
+        if (!accessTime)
+            return false;
+
+        if (!decoder.verifyChecksum())
+            return false;
+
+        touchEntry(*hash, *accessTime);
+        return true;
+    }
+    case Operation::Remove:
+        if (!decoder.verifyChecksum())
+            return false;
+
+        removeEntry(*hash);
+        return true;
+    }
+
+    return false;
+}
+
+void RecordIndex::applyPendingRecords()
+{
+    ASSERT(m_isLoaded);
+
+    for (auto& record : std::exchange(m_pendingRecords, { })) {
+        if (apply(record.data() + sizeof(uint32_t), record.size() - sizeof(uint32_t)))
+            append(record);
+    }
+}
+
+void RecordIndex::append(const Vector<uint8_t>& record)
+{
+    if (!FileSystem::isHandleValid(m_handle))
+        return;
+
+    write(record);
+}
+
+String RecordIndex::sideJournalPath() const
+{
+    return makeString(m_path, '.', getCurrentProcessID(), ".journal");
+}
+
+void RecordIndex::openSideJournal()
+{
+    ASSERT(!FileSystem::isHandleValid(m_lockHandle));
+
+    auto path = sideJournalPath();
+    auto handle = FileSystem::openFile(path, FileSystem::FileOpenMode::ReadWrite);
+    if (!FileSystem::isHandleValid(handle))
+        return;
+
+#if USE(FILE_LOCK)
+    if (!FileSystem::lockFile(handle, { FileSystem::FileLockMode::Exclusive, FileSystem::FileLockMode::Nonblocking })) {
+        FileSystem::closeFile(handle);
+        return;
+    }
+#endif
+
+    // A file left by a crashed process with the same id was not merged
+    // yet; keep its changes and append after them.
+    auto data = mapFile(path);
+    size_t offset = data.isNull() ? 0 : replay(data.data(), data.size(), false);
+    FileSystem::truncateFile(handle, offset);
+    FileSystem::seekFile(handle, offset, FileSystem::FileSeekOrigin::Beginning);
+
+    m_handle = handle;
+    m_journalSize = offset;
+    if (!offset)
+        write(encodeHeader());
+}
+
+void RecordIndex::mergeSideJournals()
+{
+    ASSERT(FileSystem::isHandleValid(m_lockHandle));
+
+    auto pattern = makeString(FileSystem::pathGetFileName(m_path), ".*.journal");
+    for (auto& path : FileSystem::listDirectory(FileSystem::directoryName(m_path), pattern)) {
+        auto handle = FileSystem::openFile(path, FileSystem::FileOpenMode::Read);
+        if (!FileSystem::isHandleValid(handle))
+            continue;
+
+#if USE(FILE_LOCK)
+        // Its process is still running.
+        if (!FileSystem::lockFile(handle, { FileSystem::FileLockMode::Exclusive, FileSystem::FileLockMode::Nonblocking })) {
+            FileSystem::closeFile(handle);
+            continue;
+        }
+#endif
+
+        // Applying a record twice is harmless, so a crash before the file
+        // is deleted only repeats the merge.
+        auto data = mapFile(path);
+        if (!data.isNull()) {
+            LOG(NetworkCacheStorage, "(NetworkProcess) merging cache index journal %s", path.utf8().data());
+            replay(data.data(), data.size(), true);
+        }
+        FileSystem::deleteFile(path);
+        FileSystem::unlockAndCloseFile(handle);
+    }
+}
+
+void RecordIndex::write(const Vector<uint8_t>& bytes)
+{
+    int written = FileSystem::writeToFile(m_handle, reinterpret_cast<const char*>(bytes.data()), bytes.size());
+    if (written == static_cast<int>(bytes.size())) {
+        m_journalSize += written;
+        return;
+    }
+
+    // A partial record is cut off on the next load. Stop appending so that
+    // nothing follows it.
+    LOG(NetworkCacheStorage, "(NetworkProcess) failed to append to the cache index");
+    FileSystem::closeFile(m_handle);
+}
+
+void RecordIndex::addEntry(const Key::HashType& hash, Entry&& entry)
+{
+    removeEntry(hash);
+
+    m_size += entry.recordSize;
+    if (entry.hasBlob) {
+        if (isNullHash(entry.blobHash) || !m_blobShareCounts.add(entry.blobHash, 0).iterator->value++)
+            m_size += entry.blobSize;
+    }
+    // Loading seeds the policy in access order once all entries are in.
+    if (m_isLoaded)
+        m_evictionPolicy->add(hash, entry.recordSize + entry.blobSize);
+    m_entries.add(hash, WTFMove(entry));
+    ++m_count;
+}
+
+void RecordIndex::touchEntry(const Key::HashType& hash, WallTime accessTime)
+{
+    auto it = m_entries.find(hash);
+    if (it == m_entries.end())
+        return;
+
+    it->value.accessTime = accessTime;
+    if (m_isLoaded)
+        m_evictionPolicy->access(hash);
+}
+
+size_t RecordIndex::removeEntry(const Key::HashType& hash)
+{
+    auto it = m_entries.find(hash);
+    if (it == m_entries.end())
+        return 0;
+
+    auto& entry = it->value;
+    size_t removedSize = entry.recordSize;
+    if (entry.hasBlob) {
+        if (isNullHash(entry.blobHash))
+            removedSize += entry.blobSize;
+        else {
+            auto shareIt = m_blobShareCounts.find(entry.blobHash);
+            if (shareIt != m_blobShareCounts.end() && !--shareIt->value) {
+                m_blobShareCounts.remove(shareIt);
+                removedSize += entry.blobSize;
+            }
+        }
+    }
+    m_size -= removedSize;
+
+    if (m_isLoaded)
+        m_evictionPolicy->remove(hash);
+    m_entries.remove(it);
+    --m_count;
+    return removedSize;
+}
+
+void RecordIndex::seedEvictionPolicy()
+{
+    Vector<std::pair<WallTime, Key::HashType>> records;
+    records.reserveInitialCapacity(m_entries.size());
+    for (auto& it : m_entries)
+        records.uncheckedAppend({ it.value.accessTime, it.key });
+    std::sort(records.begin(), records.end(), [](auto& a, auto& b) {
+        return a.first < b.first;
+    });
+
+    // Every record on disk was admitted once; only the records added from
+    // now on have to earn their place.
+    m_evictionPolicy->clear();
+    m_evictionPolicy->setCapacity(std::numeric_limits<size_t>::max());
+    for (auto& record : records) {
+        auto& entry = m_entries.find(record.second)->value;
+        m_evictionPolicy->add(record.second, entry.recordSize + entry.blobSize);
+    }
+    m_evictionPolicy->setCapacity(m_evictionCapacity);
+}
+
+unsigned RecordIndex::typeIndex(const String& type)
+{
+    for (unsigned i = 0; i < m_types.size(); ++i) {
+        if (m_types[i] == type)
+            return i;
+    }
+    m_types.append(type.isolatedCopy());
+    return m_types.size() - 1;
+}
+
+bool RecordIndex::rewrite()
+{
+    ASSERT(FileSystem::isHandleValid(m_lockHandle));
+
+    // A crash may have left a longer file behind, and opening for writing
+    // does not truncate it.
+    String temporaryPath = m_path + ".tmp";
+    FileSystem::deleteFile(temporaryPath);
+    auto handle = FileSystem::openFile(temporaryPath, FileSystem::FileOpenMode::Write);
+    if (!FileSystem::isHandleValid(handle))
+        return false;
+
+    static const size_t bufferSize = 64 * KB;
+    Vector<uint8_t> buffer = encodeHeader();
+    size_t journalSize = 0;
+    bool success = true;
+    auto flush = [&] {
+        int written = FileSystem::writeToFile(handle, reinterpret_cast<const char*>(buffer.data()), buffer.size());
+        if (written != static_cast<int>(buffer.size()))
+            success = false;
+        journalSize += buffer.size();
+        buffer.shrink(0);
+    };
+
+    for (auto& it : m_entries) {
+        buffer.appendVector(encodeAdd(it.key, it.value));
+        if (buffer.size() >= bufferSize)
+            flush();
+        if (!success)
+            break;
+    }
+    if (success)
+        flush();
+    FileSystem::closeFile(handle);
+
+    // Replace the journal only once the new one is complete.
+    if (!success || !FileSystem::moveFile(temporaryPath, m_path)) {
+        FileSystem::deleteFile(temporaryPath);
+        return false;
+    }
+
+    if (FileSystem::isHandleValid(m_handle))
+        FileSystem::closeFile(m_handle);
+    m_handle = FileSystem::openFile(m_path, FileSystem::FileOpenMode::ReadWrite);
+    if (!FileSystem::isHandleValid(m_handle))
+        return false;
+    FileSystem::seekFile(m_handle, 0, FileSystem::FileSeekOrigin::End);
+    m_journalSize = journalSize;
+    return true;
+}
+
+Vector<uint8_t> RecordIndex::encodeHeader() const
+{
+    WTF::Persistence::Encoder encoder;
+    encoder << indexMagic;
+    encoder << indexVersion;
+    encoder.encodeChecksum();
+    return frameRecord(encoder);
+}
+
+Vector<uint8_t> RecordIndex::encodeRemove(const Key::HashType& hash)
+{
+    WTF::Persistence::Encoder encoder;
+    encoder << static_cast<uint8_t>(Operation::Remove);
+    encoder << hash;
+    encoder.encodeChecksum();
+    return frameRecord(encoder);
+}
+
+Vector<uint8_t> RecordIndex::encodeAdd(const Key::HashType& hash, const Entry& entry) const
+{
+    WTF::Persistence::Encoder encoder;
+    encoder << static_cast<uint8_t>(Operation::Add);
+    encoder << hash;
+    encoder << entry.partitionHash;
+    encoder << m_types[entry.typeIndex];
+    encoder << entry.recordSize;
+    encoder << entry.hasBlob;
+    encoder << entry.blobHash;
+    encoder << entry.blobSize;
+    encoder << entry.creationTime;
+    encoder << entry.accessTime;
+    encoder.encodeChecksum();
+    return frameRecord(encoder);
+}
+
+} // namespace NetworkCache
+} // namespace PurCFetcher
@@ -0,0 +1,214 @@
+/* 
+ * Copyright (C) 2020 Beijing FMSoft Technologies Co., Ltd.
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ * 
+ * Or,
+ * 
+ * As this component is a program released under LGPLv3, which claims
+ * explicitly that the program could be modified by any end user
+ * even if the program is conveyed in non-source form on the system it runs.
+ * Generally, if you distribute this program in embedded devices,
+ * you might not satisfy this condition. Under this situation or you can
+ * not accept any condition of LGPLv3, you need to get a commercial license
+ * from FMSoft, along with a patent license for the patents owned by FMSoft.
+ * 
+ * If you have got a commercial/patent license of this program, please use it
+ * under the terms and conditions of the commercial license.
+ * 
+ * For more information about the commercial license and patent license,
+ * please refer to
+ * <https://hybridos.fmsoft.cn/blog/hybridos-licensing-policy/>.
+ * 
+ * Also note that the LGPLv3 license does not apply to any entity in the
+ * Exception List published by Beijing FMSoft Technologies Co., Ltd.
+ * 
+ * If you are or the entity you represent is listed in the Exception List,
+ * the above open source or free software license does not apply to you
+ * or the entity you represent. Regardless of the purpose, you should not
+ * use the software in any way whatsoever, including but not limited to
+ * downloading, viewing, copying, distributing, compiling, and running.
+ * If you have already downloaded it, you MUST destroy all of its copies.
+ * 
+ * The Exception List is published by FMSoft and may be updated
+ * from time to time. For more information, please see
+ * <https://www.fmsoft.cn/exception-list>.
+ */ 
+
+#pragma once
+
+#include "NetworkCacheEvictionPolicy.h"
+#include "NetworkCacheFileSystem.h"
+#include "NetworkCacheKey.h"
+#include <limits>
+#include <wtf/FileSystem.h>
+#include <wtf/Function.h>
+#include <wtf/HashMap.h>
+#include <wtf/Lock.h>
+#include <wtf/Vector.h>
+#include <wtf/WallTime.h>
+#include <wtf/text/WTFString.h>
+
+namespace PurCFetcher {
+namespace NetworkCache {
+
+struct RecordIndexHash {
+    static unsigned hash(const Key::HashType& hash)
+    {
+        static_assert(SHA1::hashSize >= sizeof(unsigned), "Hash size must be greater than sizeof(unsigned)");
+        return *reinterpret_cast<const unsigned*>(hash.data());
+    }
+    static bool equal(const Key::HashType& a, const Key::HashType& b) { return a == b; }
+    static const bool safeToCompareToEmptyOrDeleted = true;
+};
+
+struct RecordIndexHashTraits : WTF::GenericHashTraits<Key::HashType> {
+    static const bool emptyValueIsZero = true;
+    static void constructDeletedValue(Key::HashType& slot) { slot.fill(0xff); }
+    static bool isDeletedValue(const Key::HashType& value)
+    {
+        return std::all_of(value.begin(), value.end(), [](uint8_t byte) { return byte == 0xff; });
+    }
+};
+
+// The records of the storage with what is needed to find, size and age
+// them, so that opening and shrinking the cache do not have to walk and
+// stat the records directory.
+//
+// The index file is an append-only journal: a header followed by
+// checksummed add, touch and remove records. It is mapped and replayed on
+// load; a torn tail left by a crash is cut off, and an unreadable file is
+// rebuilt from the records directory. Record files are created after their
+// add record is written and deleted before their remove record is, so a
+// crash leaves at worst an index entry whose file is gone, which the
+// storage drops on the failed read.
+//
+// Only one process writes the journal: the one holding the lock on the
+// 'Index.lock' file next to it. The others read it once and append their
+// changes to a journal of their own, 'Index.<pid>.journal', which they keep
+// locked. The writer merges the journals no process holds anymore when it
+// loads or compacts the index.
+//
+// All functions are thread-safe. Until load() or rebuild() succeeds the
+// changes are queued and applied after the entries read from disk.
+class RecordIndex {
+    WTF_MAKE_NONCOPYABLE(RecordIndex);
+    WTF_MAKE_FAST_ALLOCATED;
+public:
+    explicit RecordIndex(const String& path);
+    ~RecordIndex();
+
+    struct Entry {
+        Key::HashType partitionHash;
+        unsigned typeIndex { 0 };
+        uint64_t recordSize { 0 };
+        // The body blob may be shared with other records. Its hash is
+        // zero when the index was rebuilt from the directory.
+        bool hasBlob { false };
+        SHA1::Digest blobHash { };
+        uint64_t blobSize { 0 };
+        WallTime creationTime;
+        WallTime accessTime;
+    };
+
+    // What a walk of the records directory recovers of a record.
+    struct RecoveredRecord {
+        Key::HashType hash;
+        Key::HashType partitionHash;
+        String type;
+        uint64_t recordSize { 0 };
+        bool hasBlob { false };
+        uint64_t blobSize { 0 };
+        FileTimes times;
+    };
+
+    // Returns false if the index file is missing or unusable.
+    bool load();
+    void rebuild(Vector<RecoveredRecord>&&);
+    bool isLoaded() const { return m_isLoaded; }
+
+    void add(const Key&, uint64_t recordSize, const SHA1::Digest* blobHash, uint64_t blobSize);
+    void touch(const Key::HashType&);
+    // Returns the bytes the index no longer accounts for.
+    size_t remove(const Key::HashType&);
+    void clear(const String& type, WallTime modifiedSinceTime);
+
+    // The policy learns the records least recently used first.
+    void setEvictionPolicy(std::unique_ptr<EvictionPolicy>&&);
+    void setEvictionCapacity(size_t);
+    const char* evictionPolicyName() const;
+    // Up to maximumCount records to evict, in order. They stay indexed
+    // until removed.
+    Vector<std::pair<Key::HashType, Entry>> takeEvictionCandidates(unsigned maximumCount);
+
+    // Runs with the index locked; the visitor must not call back into it.
+    using Visitor = Function<void (const Key::HashType&, const Entry&)>;
+    void forEach(const Visitor&) const;
+
+    String type(const Entry&) const;
+
+    // Records plus the blobs they reference, each shared blob counted once.
+    size_t size() const { return m_size; }
+    unsigned count() const { return m_count; }
+
+    // In the writer, also merges the journals left by other processes.
+    void compactIfNeeded();
+
+private:
+    enum class Operation : uint8_t { Add, Touch, Remove };
+
+    // Returns the length of the readable part, or 0 without a header.
+    size_t replay(const uint8_t* data, size_t, bool shouldAppend);
+    bool apply(const uint8_t* data, size_t);
+    void applyPendingRecords();
+    void append(const Vector<uint8_t>&);
+    void write(const Vector<uint8_t>&);
+
+    void addEntry(const Key::HashType&, Entry&&);
+    void touchEntry(const Key::HashType&, WallTime accessTime);
+    size_t removeEntry(const Key::HashType&);
+    void seedEvictionPolicy();
+    unsigned typeIndex(const String&);
+
+    bool lockJournal();
+    bool rewrite();
+    String sideJournalPath() const;
+    void openSideJournal();
+    void mergeSideJournals();
+    Vector<uint8_t> encodeHeader() const;
+    Vector<uint8_t> encodeAdd(const Key::HashType&, const Entry&) const;
+    static Vector<uint8_t> encodeRemove(const Key::HashType&);
+
+    const String m_path;
+
+    mutable Lock m_lock;
+    HashMap<Key::HashType, Entry, RecordIndexHash, RecordIndexHashTraits> m_entries;
+    HashMap<SHA1::Digest, unsigned, RecordIndexHash, RecordIndexHashTraits> m_blobShareCounts;
+    Vector<String> m_types;
+    std::unique_ptr<EvictionPolicy> m_evictionPolicy;
+    size_t m_evictionCapacity { std::numeric_limits<size_t>::max() };
+
+    FileSystem::PlatformFileHandle m_lockHandle { FileSystem::invalidPlatformFileHandle };
+    FileSystem::PlatformFileHandle m_handle { FileSystem::invalidPlatformFileHandle };
+    size_t m_journalSize { 0 };
+    size_t m_compactedSize { 0 };
+    Vector<Vector<uint8_t>> m_pendingRecords;
+
+    std::atomic<bool> m_isLoaded { false };
+    std::atomic<size_t> m_size { 0 };
+    std::atomic<unsigned> m_count { 0 };
+};
+
+} // namespace NetworkCache
+} // namespace PurCFetcher
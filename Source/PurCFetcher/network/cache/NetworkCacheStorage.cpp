@@ -36,7 +36,6 @@
 #include <wtf/Condition.h>
 #include <wtf/Lock.h>
 #include <wtf/PageBlock.h>
-#include <wtf/RandomNumber.h>
 #include <wtf/RunLoop.h>
 #include <wtf/text/CString.h>
 #include <wtf/text/StringConcatenateNumbers.h>
@@ -45,10 +44,17 @@ namespace PurCFetcher {
 namespace NetworkCache {
 
 static const char saltFileName[] = "salt";
+static const char indexFileName[] = "Index";
 static const char versionDirectoryPrefix[] = "Version ";
 static const char recordsDirectoryName[] = "Records";
 static const char blobsDirectoryName[] = "Blobs";
 static const char blobSuffix[] = "-blob";
+static const char legacySoupCacheIndexFileName[] = "soup.cache2";
+
+// A shrink evicts down to this share of the capacity, in batches, so that
+// the next stores do not immediately trigger another one.
+static const unsigned shrinkLowWaterMarkPercentage = 90;
+static const unsigned evictionBatchSize = 64;
 
 static inline size_t maximumInlineBodySize()
 {
@@ -175,6 +181,16 @@ static String makeSaltFilePath(const String& baseDirectoryPath)
     return FileSystem::pathByAppendingComponent(makeVersionedDirectoryPath(baseDirectoryPath), saltFileName);
 }
 
+static String makeIndexFilePath(const String& baseDirectoryPath)
+{
+    return FileSystem::pathByAppendingComponent(makeVersionedDirectoryPath(baseDirectoryPath), indexFileName);
+}
+
+static String blobPathForRecordPath(const String& recordPath)
+{
+    return recordPath + blobSuffix;
+}
+
 RefPtr<Storage> Storage::open(const String& baseCachePath, Mode mode, size_t capacity)
 {
     ASSERT(RunLoop::isMain());
@@ -251,9 +267,11 @@ Storage::Storage(const String& baseDirectoryPath, Mode mode, Salt salt, size_t c
     , m_backgroundIOQueue(WorkQueue::create("com.apple.PurCFetcher.Cache.Storage.background", WorkQueue::Type::Concurrent, WorkQueue::QOS::Background))
     , m_serialBackgroundIOQueue(WorkQueue::create("com.apple.PurCFetcher.Cache.Storage.serialBackground", WorkQueue::Type::Serial, WorkQueue::QOS::Background))
     , m_blobStorage(makeBlobDirectoryPath(baseDirectoryPath), m_salt)
+    , m_index(makeIndexFilePath(baseDirectoryPath))
 {
     ASSERT(RunLoop::isMain());
 
+    m_index.setEvictionCapacity(m_capacity);
     deleteOldVersions();
     synchronize();
 }
@@ -285,15 +303,21 @@ String Storage::recordsPathIsolatedCopy() const
 
 size_t Storage::approximateSize() const
 {
-    return m_approximateRecordsSize + m_blobStorage.approximateSize();
+    return m_index.size();
+}
+
+void Storage::setEvictionPolicy(std::unique_ptr<EvictionPolicy>&& evictionPolicy)
+{
+    m_index.setEvictionPolicy(WTFMove(evictionPolicy));
 }
 
-static size_t estimateRecordsSize(unsigned recordCount, unsigned blobCount)
+Storage::Statistics Storage::statistics() const
 {
-    auto inlineBodyCount = recordCount - std::min(blobCount, recordCount);
-    auto headerSizes = recordCount * 4096;
-    auto inlineBodySizes = (maximumInlineBodySize() / 2) * inlineBodyCount;
-    return headerSizes + inlineBodySizes;
+    ASSERT(RunLoop::isMain());
+
+    auto statistics = m_statistics;
+    statistics.evictionPolicy = m_index.evictionPolicyName();
+    return statistics;
 }
 
 void Storage::synchronize()
@@ -307,45 +331,26 @@ void Storage::synchronize()
     LOG(NetworkCacheStorage, "(NetworkProcess) synchronizing cache");
 
     backgroundIOQueue().dispatch([this, protectedThis = makeRef(*this)] () mutable {
-        auto recordFilter = makeUnique<ContentsFilter>();
-        auto blobFilter = makeUnique<ContentsFilter>();
-
-        // Most of the disk space usage is in blobs if we are using them. Approximate records file sizes to avoid expensive stat() calls.
-        size_t recordsSize = 0;
-        unsigned recordCount = 0;
-        unsigned blobCount = 0;
-
-        String anyType;
-        traverseRecordsFiles(recordsPathIsolatedCopy(), anyType, [&](const String& fileName, const String& hashString, const String& type, bool isBlob, const String& recordDirectoryPath) {
-            UNUSED_PARAM(type);
-            auto filePath = FileSystem::pathByAppendingComponent(recordDirectoryPath, fileName);
+        auto startTime = MonotonicTime::now();
 
-            Key::HashType hash;
-            if (!Key::stringToHash(hashString, hash)) {
-                FileSystem::deleteFile(filePath);
-                return;
-            }
-
-            if (isBlob) {
-                ++blobCount;
-                blobFilter->add(hash);
-                return;
-            }
+        if (!m_index.isLoaded() && !m_index.load())
+            rebuildIndex();
 
-            ++recordCount;
+        // Merges the journals of other processes, so run it before the
+        // filters are filled.
+        m_index.compactIfNeeded();
 
+        auto recordFilter = makeUnique<ContentsFilter>();
+        auto blobFilter = makeUnique<ContentsFilter>();
+        m_index.forEach([&](const Key::HashType& hash, const RecordIndex::Entry& entry) {
             recordFilter->add(hash);
+            if (entry.hasBlob)
+                blobFilter->add(hash);
         });
 
-        recordsSize = estimateRecordsSize(recordCount, blobCount);
-
-        m_blobStorage.synchronize();
-
-        deleteEmptyRecordsDirectories(recordsPathIsolatedCopy());
-
-        LOG(NetworkCacheStorage, "(NetworkProcess) cache synchronization completed size=%zu recordCount=%u", recordsSize, recordCount);
+        LOG(NetworkCacheStorage, "(NetworkProcess) cache synchronization completed size=%zu recordCount=%u time=%.2fms", m_index.size(), m_index.count(), (MonotonicTime::now() - startTime).milliseconds());
 
-        RunLoop::main().dispatch([this, protectedThis = WTFMove(protectedThis), recordFilter = WTFMove(recordFilter), blobFilter = WTFMove(blobFilter), recordsSize]() mutable {
+        RunLoop::main().dispatch([this, protectedThis = WTFMove(protectedThis), recordFilter = WTFMove(recordFilter), blobFilter = WTFMove(blobFilter)]() mutable {
             for (auto& recordFilterKey : m_recordFilterHashesAddedDuringSynchronization)
                 recordFilter->add(recordFilterKey);
             m_recordFilterHashesAddedDuringSynchronization.clear();
@@ -356,7 +361,6 @@ void Storage::synchronize()
 
             m_recordFilter = WTFMove(recordFilter);
             m_blobFilter = WTFMove(blobFilter);
-            m_approximateRecordsSize = recordsSize;
             m_synchronizationInProgress = false;
             if (m_mode == Mode::AvoidRandomness)
                 dispatchPendingWriteOperations();
@@ -365,6 +369,55 @@ void Storage::synchronize()
     });
 }
 
+void Storage::rebuildIndex()
+{
+    ASSERT(!RunLoop::isMain());
+
+    // The index is missing or damaged; recover it from the records directory.
+    LOG(NetworkCacheStorage, "(NetworkProcess) rebuilding cache index");
+
+    Vector<RecordIndex::RecoveredRecord> records;
+    String anyType;
+    traverseRecordsFiles(recordsPathIsolatedCopy(), anyType, [&](const String& fileName, const String& hashString, const String& type, bool isBlob, const String& recordDirectoryPath) {
+        auto filePath = FileSystem::pathByAppendingComponent(recordDirectoryPath, fileName);
+
+        RecordIndex::RecoveredRecord record;
+        if (!Key::stringToHash(hashString, record.hash)) {
+            FileSystem::deleteFile(filePath);
+            return;
+        }
+
+        // Blobs are looked up from their record.
+        if (isBlob)
+            return;
+
+        auto partitionName = FileSystem::lastComponentOfPathIgnoringTrailingSlash(FileSystem::directoryName(recordDirectoryPath));
+        if (!Key::stringToHash(partitionName, record.partitionHash))
+            return;
+
+        long long recordSize;
+        if (!FileSystem::getFileSize(filePath, recordSize))
+            return;
+        record.type = type;
+        record.recordSize = recordSize;
+        record.times = fileTimes(filePath);
+
+        long long blobSize;
+        if (FileSystem::getFileSize(blobPathForRecordPath(filePath), blobSize)) {
+            record.hasBlob = true;
+            record.blobSize = blobSize;
+        }
+
+        records.append(WTFMove(record));
+    });
+
+    m_index.rebuild(WTFMove(records));
+
+    m_blobStorage.synchronize();
+
+    deleteEmptyRecordsDirectories(recordsPathIsolatedCopy());
+}
+
 void Storage::addToRecordFilter(const Key& key)
 {
     ASSERT(RunLoop::isMain());
@@ -400,11 +453,6 @@ String Storage::recordPathForKey(const Key& key) const
     return FileSystem::pathByAppendingComponent(recordDirectoryPathForKey(key), key.hashAsString());
 }
 
-static String blobPathForRecordPath(const String& recordPath)
-{
-    return recordPath + blobSuffix;
-}
-
 String Storage::blobPathForKey(const Key& key) const
 {
     return blobPathForRecordPath(recordPathForKey(key));
@@ -638,7 +686,6 @@ void Storage::remove(const Key& key)
     auto protectedThis = makeRef(*this);
 
     // We can't remove the key from the Bloom filter (but some false positives are expected anyway).
-    // For simplicity we also don't reduce m_approximateSize on removals.
     // The next synchronization will update everything.
 
     removeFromPendingWriteOperations(key);
@@ -676,12 +723,25 @@ void Storage::deleteFiles(const Key& key)
 
     FileSystem::deleteFile(recordPathForKey(key));
     m_blobStorage.remove(blobPathForKey(key));
+    // After the files, so that a crash never leaves a record out of the index.
+    m_index.remove(key.hash());
 }
 
-void Storage::updateFileModificationTime(const String& path)
+void Storage::touch(const Key& key)
 {
-    serialBackgroundIOQueue().dispatch([path = path.isolatedCopy()] {
+    ASSERT(RunLoop::isMain());
+
+    if (!mayContain(key))
+        return;
+    updateAccessTime(key);
+}
+
+void Storage::updateAccessTime(const Key& key)
+{
+    // The modification time still serves a rebuild of the index.
+    serialBackgroundIOQueue().dispatch([this, protectedThis = makeRef(*this), path = recordPathForKey(key).isolatedCopy(), hash = key.hash()] {
         updateFileModificationTimeIfNeeded(path);
+        m_index.touch(hash);
     });
 }
 
@@ -748,10 +808,14 @@ void Storage::finishReadOperation(ReadOperation& readOperation)
 
     RunLoop::main().dispatch([this, &readOperation] {
         bool success = readOperation.finish();
-        if (success)
-            updateFileModificationTime(recordPathForKey(readOperation.key));
-        else if (!readOperation.isCanceled)
-            remove(readOperation.key);
+        if (success) {
+            ++m_statistics.hitCount;
+            updateAccessTime(readOperation.key);
+        } else {
+            ++m_statistics.missCount;
+            if (!readOperation.isCanceled)
+                remove(readOperation.key);
+        }
 
         auto protectedThis = makeRef(*this);
 
@@ -861,11 +925,12 @@ void Storage::dispatchWriteOperation(std::unique_ptr<WriteOperation> writeOperat
 
         auto recordData = encodeRecord(writeOperation.record, blob);
 
+        // Index the record before it exists, so that a crash never leaves a record out of the index.
+        m_index.add(writeOperation.record.key, recordData.size(), blob ? &blob->hash : nullptr, blob ? blob->data.size() : 0);
+
         auto channel = IOChannel::open(recordPath, IOChannel::Type::Create);
-        size_t recordSize = recordData.size();
-        channel->write(0, recordData, nullptr, [this, &writeOperation, recordSize](int error) {
-            // On error the entry still stays in the contents filter until next synchronization.
-            m_approximateRecordsSize += recordSize;
+        channel->write(0, recordData, nullptr, [this, &writeOperation](int error) {
+            // On error the entry still stays in the contents filter and the index until the read fails.
             finishWriteOperation(writeOperation, error);
 
             LOG(NetworkCacheStorage, "(NetworkProcess) write complete error=%d", error);
@@ -905,14 +970,16 @@ void Storage::retrieve(const Key& key, unsigned priority, RetrieveCompletionHand
     }
 
     if (!mayContain(key)) {
+        ++m_statistics.missCount;
         completionHandler(nullptr, { });
         return;
     }
 
-    if (retrieveFromMemory(m_pendingWriteOperations, key, completionHandler))
-        return;
-    if (retrieveFromMemory(m_activeWriteOperations, key, completionHandler))
+    if (retrieveFromMemory(m_pendingWriteOperations, key, completionHandler)
+        || retrieveFromMemory(m_activeWriteOperations, key, completionHandler)) {
+        ++m_statistics.hitCount;
         return;
+    }
 
     auto readOperation = makeUnique<ReadOperation>(*this, key, WTFMove(completionHandler));
 
@@ -1037,6 +1104,7 @@ void Storage::setCapacity(size_t capacity)
 #endif
 
     m_capacity = capacity;
+    m_index.setEvictionCapacity(capacity);
 
     shrinkIfNeeded();
 }
@@ -1050,7 +1118,6 @@ void Storage::clear(const String& type, WallTime modifiedSinceTime, CompletionHa
         m_recordFilter->clear();
     if (m_blobFilter)
         m_blobFilter->clear();
-    m_approximateRecordsSize = 0;
 
     ioQueue().dispatch([this, protectedThis = makeRef(*this), modifiedSinceTime, completionHandler = WTFMove(completionHandler), type = type.isolatedCopy()] () mutable {
         auto recordsPath = this->recordsPathIsolatedCopy();
@@ -1069,6 +1136,8 @@ void Storage::clear(const String& type, WallTime modifiedSinceTime, CompletionHa
 
         deleteEmptyRecordsDirectories(recordsPath);
 
+        m_index.clear(type, modifiedSinceTime);
+
         // This cleans unreferenced blobs.
         m_blobStorage.synchronize();
 
@@ -1090,25 +1159,6 @@ static double computeRecordWorth(FileTimes times)
     return accessAge / age;
 }
 
-static double deletionProbability(FileTimes times, unsigned bodyShareCount)
-{
-    static const double maximumProbability { 0.33 };
-    static const unsigned maximumEffectiveShareCount { 5 };
-
-    auto worth = computeRecordWorth(times);
-
-    // Adjust a bit so the most valuable entries don't get deleted at all.
-    auto effectiveWorth = std::min(1.1 * worth, 1.);
-
-    auto probability =  (1 - effectiveWorth) * maximumProbability;
-
-    // It is less useful to remove an entry that shares its body data.
-    if (bodyShareCount)
-        probability /= std::min(bodyShareCount, maximumEffectiveShareCount);
-
-    return probability;
-}
-
 void Storage::shrinkIfNeeded()
 {
     ASSERT(RunLoop::isMain());
@@ -1131,48 +1181,80 @@ void Storage::shrink()
 
     LOG(NetworkCacheStorage, "(NetworkProcess) shrinking cache approximateSize=%zu capacity=%zu", approximateSize(), m_capacity);
 
-    backgroundIOQueue().dispatch([this, protectedThis = makeRef(*this)] () mutable {
-        auto recordsPath = this->recordsPathIsolatedCopy();
-        String anyType;
-        traverseRecordsFiles(recordsPath, anyType, [this](const String& fileName, const String& hashString, const String& type, bool isBlob, const String& recordDirectoryPath) {
-            UNUSED_PARAM(hashString);
-            UNUSED_PARAM(type);
-            if (isBlob)
-                return;
+    size_t lowWaterMark = m_capacity / 100 * shrinkLowWaterMarkPercentage;
 
-            auto recordPath = FileSystem::pathByAppendingComponent(recordDirectoryPath, fileName);
-            auto blobPath = blobPathForRecordPath(recordPath);
-
-            auto times = fileTimes(recordPath);
-            unsigned bodyShareCount = m_blobStorage.shareCount(blobPath);
-            auto probability = deletionProbability(times, bodyShareCount);
+    backgroundIOQueue().dispatch([this, protectedThis = makeRef(*this), lowWaterMark] () mutable {
+        auto startTime = MonotonicTime::now();
+        auto recordsPath = this->recordsPathIsolatedCopy();
 
-            bool shouldDelete = randomNumber() < probability;
+        // Evict in the order the policy gives until the size is down to
+        // the low-water mark, without touching the records directory.
+        Vector<Key::HashType> evictedHashes;
+        uint64_t evictedBytes = 0;
+        while (m_index.size() > lowWaterMark) {
+            auto candidates = m_index.takeEvictionCandidates(evictionBatchSize);
+            if (candidates.isEmpty())
+                break;
 
-            LOG(NetworkCacheStorage, "Deletion probability=%f bodyLinkCount=%d shouldDelete=%d", probability, bodyShareCount, shouldDelete);
+            for (auto& candidate : candidates) {
+                auto& entry = candidate.second;
+                auto recordDirectoryPath = FileSystem::pathByAppendingComponent(FileSystem::pathByAppendingComponent(recordsPath, Key::hashAsString(entry.partitionHash)), m_index.type(entry));
+                auto recordPath = FileSystem::pathByAppendingComponent(recordDirectoryPath, Key::hashAsString(candidate.first));
 
-            if (shouldDelete) {
                 FileSystem::deleteFile(recordPath);
-                m_blobStorage.remove(blobPath);
+                auto blobPath = blobPathForRecordPath(recordPath);
+                if (entry.hasBlob) {
+                    // An index rebuilt from the directory does not know the blob hash.
+                    auto blobHash = entry.blobHash == SHA1::Digest { } ? m_blobStorage.get(blobPath).hash : entry.blobHash;
+                    m_blobStorage.remove(blobPath, blobHash);
+                } else
+                    m_blobStorage.remove(blobPath);
+                evictedBytes += m_index.remove(candidate.first);
+                evictedHashes.append(candidate.first);
             }
-        });
+        }
+
+        deleteEmptyRecordsDirectories(recordsPath);
+
+        LOG(NetworkCacheStorage, "(NetworkProcess) cache shrink completed evictedCount=%zu evictedBytes=%" PRIu64 " size=%zu time=%.2fms", evictedHashes.size(), evictedBytes, m_index.size(), (MonotonicTime::now() - startTime).milliseconds());
 
-        RunLoop::main().dispatch([this, protectedThis = WTFMove(protectedThis)] {
+        RunLoop::main().dispatch([this, protectedThis = WTFMove(protectedThis), evictedHashes = WTFMove(evictedHashes), evictedBytes] {
+            m_statistics.evictedRecordCount += evictedHashes.size();
+            m_statistics.evictedBytes += evictedBytes;
+            if (m_evictionHandler && !evictedHashes.isEmpty())
+                m_evictionHandler(evictedHashes);
             m_shrinkInProgress = false;
-            // We could synchronize during the shrink traversal. However this is fast and it is better to have just one code path.
+            // This only rebuilds the filters from the index.
             synchronize();
         });
-
-        LOG(NetworkCacheStorage, "(NetworkProcess) cache shrink completed");
     });
 }
 
+static bool isLegacySoupCacheEntryFile(const String& fileName)
+{
+    // libsoup names its entries after the hash of the URL and keeps them
+    // next to its index file.
+    bool success;
+    fileName.toUIntStrict(&success);
+    return success;
+}
+
 void Storage::deleteOldVersions()
 {
     backgroundIOQueue().dispatch([cachePath = basePathIsolatedCopy()] () mutable {
-        traverseDirectory(cachePath, [&cachePath](const String& subdirName, DirectoryEntryType type) {
-            if (type != DirectoryEntryType::Directory)
+        // The fetcher used to keep a SoupCache in this directory; this cache
+        // never reads those files, so reclaim the space. The directory may be
+        // shared, so only when the SoupCache index is there, and the index
+        // goes last so that an interrupted cleanup is resumed next time.
+        auto legacySoupCacheIndexPath = FileSystem::pathByAppendingComponent(cachePath, legacySoupCacheIndexFileName);
+        bool hasLegacySoupCache = FileSystem::fileExists(legacySoupCacheIndexPath);
+
+        traverseDirectory(cachePath, [&cachePath, hasLegacySoupCache](const String& subdirName, DirectoryEntryType type) {
+            if (type == DirectoryEntryType::File) {
+                if (hasLegacySoupCache && isLegacySoupCacheEntryFile(subdirName))
+                    FileSystem::deleteFile(FileSystem::pathByAppendingComponent(cachePath, subdirName));
                 return;
+            }
             if (!subdirName.startsWith(versionDirectoryPrefix))
                 return;
             auto versionString = subdirName.substring(strlen(versionDirectoryPrefix));
@@ -1188,6 +1270,9 @@ void Storage::deleteOldVersions()
 
             deleteDirectoryRecursively(oldVersionPath);
         });
+
+        if (hasLegacySoupCache)
+            FileSystem::deleteFile(legacySoupCacheIndexPath);
     });
 }
 
@@ -28,6 +28,7 @@
 #include "NetworkCacheBlobStorage.h"
 #include "NetworkCacheData.h"
 #include "NetworkCacheKey.h"
+#include "NetworkCacheRecordIndex.h"
 #include "Timer.h"
 #include <wtf/BloomFilter.h>
 #include <wtf/CompletionHandler.h>
@@ -84,6 +85,9 @@ public:
     using MappedBodyHandler = Function<void (const Data& mappedBody)>;
     void store(const Record&, MappedBodyHandler&&, CompletionHandler<void(int)>&& = { });
 
+    // Records a hit served without reading the record, e.g. from memory.
+    void touch(const Key&);
+
     void remove(const Key&);
     void remove(const Vector<Key>&, CompletionHandler<void()>&&);
     void clear(const String& type, WallTime modifiedSinceTime, CompletionHandler<void()>&&);
@@ -106,6 +110,21 @@ public:
     size_t capacity() const { return m_capacity; }
     size_t approximateSize() const;
 
+    void setEvictionPolicy(std::unique_ptr<EvictionPolicy>&&);
+
+    // Called on the main thread with the records a shrink evicted.
+    using EvictionHandler = Function<void (const Vector<Key::HashType>&)>;
+    void setEvictionHandler(EvictionHandler&& handler) { m_evictionHandler = WTFMove(handler); }
+
+    struct Statistics {
+        const char* evictionPolicy { nullptr };
+        uint64_t hitCount { 0 };
+        uint64_t missCount { 0 };
+        uint64_t evictedRecordCount { 0 };
+        uint64_t evictedBytes { 0 };
+    };
+    Statistics statistics() const;
+
     // Incrementing this number will delete all existing cache content for everyone. Do you really need to do it?
     static const unsigned version = 16;
 
@@ -127,6 +146,7 @@ private:
     String blobPathForKey(const Key&) const;
 
     void synchronize();
+    void rebuildIndex();
     void deleteOldVersions();
     void shrinkIfNeeded();
     void shrink();
@@ -147,7 +167,7 @@ private:
     Data encodeRecord(const Record&, Optional<BlobStorage::Blob>);
     void readRecord(ReadOperation&, const Data&);
 
-    void updateFileModificationTime(const String& path);
+    void updateAccessTime(const Key&);
     void removeFromPendingWriteOperations(const Key&);
 
     WorkQueue& ioQueue() { return m_ioQueue.get(); }
@@ -167,7 +187,6 @@ private:
     const Salt m_salt;
 
     size_t m_capacity { std::numeric_limits<size_t>::max() };
-    size_t m_approximateRecordsSize { 0 };
 
     // 2^18 bit filter can support up to 26000 entries with false positive rate < 1%.
     using ContentsFilter = BloomFilter<18>;
@@ -176,6 +195,8 @@ private:
 
     bool m_synchronizationInProgress { false };
     bool m_shrinkInProgress { false };
+    Statistics m_statistics;
+    EvictionHandler m_evictionHandler;
     size_t m_readOperationDispatchCount { 0 };
 
     Vector<Key::HashType> m_recordFilterHashesAddedDuringSynchronization;
@@ -198,6 +219,7 @@ private:
     Ref<WorkQueue> m_serialBackgroundIOQueue;
 
     BlobStorage m_blobStorage;
+    RecordIndex m_index;
 
     // By default, delay the start of writes a bit to avoid affecting early page load.
     // Completing writes will dispatch more writes without delay.
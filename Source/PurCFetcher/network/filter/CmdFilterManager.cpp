@@ -75,42 +75,141 @@
 #include "FormatKeys.h"
 #include "FormatArray.h"
 
+#include <wtf/MainThread.h>
+#include <wtf/NeverDestroyed.h>
+#include <wtf/TinyLRUCache.h>
+
+namespace WTF {
+
+template<> struct TinyLRUCachePolicy<String, RefPtr<PurCFetcher::CmdFilterManager>> {
+    static bool isKeyNull(const String& cmdFilter) { return cmdFilter.isEmpty(); }
+    static RefPtr<PurCFetcher::CmdFilterManager> createValueForNullKey() { return PurCFetcher::CmdFilterManager::create(emptyString()); }
+    static RefPtr<PurCFetcher::CmdFilterManager> createValueForKey(const String& cmdFilter) { return PurCFetcher::CmdFilterManager::create(cmdFilter); }
+};
+
+} // namespace WTF
+
 namespace PurCFetcher {
 
-CmdFilterManager::CmdFilterManager()
+#define CMD_FILTER_CACHE_CAPACITY 16
+
+Ref<CmdFilterManager> CmdFilterManager::create(const String& cmdFilter)
+{
+    return adoptRef(*new CmdFilterManager(cmdFilter));
+}
+
+Ref<CmdFilterManager> CmdFilterManager::compile(const String& cmdFilter)
+{
+    ASSERT(isMainThread());
+    static NeverDestroyed<TinyLRUCache<String, RefPtr<CmdFilterManager>, CMD_FILTER_CACHE_CAPACITY>> cache;
+    return *cache.get().get(cmdFilter);
+}
+
+CmdFilterManager::CmdFilterManager(const String& cmdFilter)
 {
-    initFilterVec();
-    initNameFilterMap();
+    parseCmdFilter(cmdFilter);
+
+    if (!m_format)
+    {
+        m_format = static_cast<FormatBase*>(filterRegistry().get("keys").get());
+        m_formatParam = emptyString();
+    }
+    m_formatKeys = m_format->escapeKeys(m_formatParam);
 }
 
 CmdFilterManager::~CmdFilterManager()
 {
 }
 
+const HashMap<String, RefPtr<FilterBase>>& CmdFilterManager::filterRegistry()
+{
+    static NeverDestroyed<HashMap<String, RefPtr<FilterBase>>> registry([] {
+        Vector<RefPtr<FilterBase>> filters;
+        filters.append(adoptRef(*new LineCharsFilter()));
+        filters.append(adoptRef(*new LineCutFilter()));
+        filters.append(adoptRef(*new LineHeadFilter()));
+        filters.append(adoptRef(*new LineIgnoreFilter()));
+        filters.append(adoptRef(*new LineLettersFilter()));
+        filters.append(adoptRef(*new LinePickFilter()));
+        filters.append(adoptRef(*new LineSentencesFilter()));
+        filters.append(adoptRef(*new LineSplitFilter()));
+        filters.append(adoptRef(*new LineTailFilter()));
+        filters.append(adoptRef(*new LineWordsFilter()));
+
+        filters.append(adoptRef(*new ColumnCharsFilter()));
+        filters.append(adoptRef(*new ColumnCutFilter()));
+        filters.append(adoptRef(*new ColumnDelimiterFilter()));
+        filters.append(adoptRef(*new ColumnHeadFilter()));
+        filters.append(adoptRef(*new ColumnIgnoreFilter()));
+        filters.append(adoptRef(*new ColumnLettersFilter()));
+        filters.append(adoptRef(*new ColumnPickFilter()));
+        filters.append(adoptRef(*new ColumnSentencesFilter()));
+        filters.append(adoptRef(*new ColumnTailFilter()));
+        filters.append(adoptRef(*new ColumnWordsFilter()));
+
+        filters.append(adoptRef(*new FormatArray()));
+        filters.append(adoptRef(*new FormatKeys()));
+
+        HashMap<String, RefPtr<FilterBase>> map;
+        for (auto& filter : filters)
+            map.set(filter->name().convertToASCIILowercase(), filter);
+        return map;
+    }());
+    return registry;
+}
+
+void CmdFilterManager::parseCmdFilter(const String& cmdFilter)
+{
+    if (cmdFilter.isEmpty())
+        return;
+    Vector<String> params = cmdFilter.split(";");
+    int size = params.size();
+    for (int i = 0; i < size; i++)
+    {
+        size_t index = params[i].find("(");
+        if (index == notFound)
+            index = params[i].length();
+
+        String name = params[i].substring(0, index);
+        String value = params[i].substring(index + 1);
+        if (!value.isEmpty())
+        {
+            size_t idx = value.reverseFind(")");
+            if (idx != notFound)
+                value = value.substring(0, idx);
+        }
+        addFilter(name, value.stripLeadingAndTrailingCharacters(isSingleQuotes));
+    }
+}
+
 bool CmdFilterManager::addFilter(String name, String param)
 {
     if (name.isEmpty())
         return false;
 
     String nameLowerCase = name.convertToASCIILowercase().stripWhiteSpace();
-    auto findResult = m_nameFilterMap.find(nameLowerCase);
-    if(findResult == m_nameFilterMap.end())
+    auto findResult = filterRegistry().find(nameLowerCase);
+    if(findResult == filterRegistry().end())
         return false;
 
     RefPtr<FilterBase> filter = findResult->value;
     switch(filter->type())
     {
-        case FilterTypeLineSplit:
         case FilterTypeLineCut:
+            m_hasLineCutFilter = true;
+            m_stages.append(Stage { WTFMove(filter), param });
+            break;
+
+        case FilterTypeLineSplit:
         case FilterTypeColumnSplit:
         case FilterTypeColumnCut:
-            m_filterNameVec.append(nameLowerCase);
-            m_filterParamVec.append(param);
+            m_stages.append(Stage { WTFMove(filter), param });
             break;
 
         case FilterTypeFormat:
-            m_formatFilter.append(nameLowerCase);
-            m_formatParamFilter.append(param);
+            // the last format wins
+            m_format = static_cast<FormatBase*>(filter.get());
+            m_formatParam = param;
             break;
 
         default:
@@ -120,104 +219,41 @@ bool CmdFilterManager::addFilter(String name, String param)
     return true;
 }
 
-Vector<Ref<JSON::Value>> CmdFilterManager::doFilter(Vector<String> lines)
+Vector<Row> CmdFilterManager::filterLines(Vector<String>&& lines) const
 {
-    Vector<Ref<JSON::Value>> result;
-
+    // the rows are moved from stage to stage, never copied
     int linesSize = lines.size();
     Vector<Vector<String>> lineListVec;
+    lineListVec.reserveInitialCapacity(linesSize);
     for (int i = 0; i < linesSize; i++) 
     {
         Vector<String> columnVec;
-        columnVec.append(lines[i]);
-        lineListVec.append(columnVec);
-    }
-
-    int size = m_filterNameVec.size();
-    for (int i = 0; i < size; i++)
-    {
-        lineListVec = doFilterInner(lineListVec, m_filterNameVec[i], m_filterParamVec[i]);
-    }
-
-    size = lineListVec.size();
-    for (int i = 0; i < size; i++)
-    {
-        Ref<JSON::Value> formatResult = doFormat(lineListVec[i]);
-        result.append(WTFMove(formatResult));
+        columnVec.append(WTFMove(lines[i]));
+        lineListVec.uncheckedAppend(WTFMove(columnVec));
     }
 
-    return result;
-}
-
-Vector<Vector<String>> CmdFilterManager::doFilterInner(Vector<Vector<String>>& lineListVec, String filterName, String filterParam)
-{
-    printf(".....................................doFilterInner|name=%s|param=%s|\n", filterName.characters8(), filterParam.characters8());
-    auto findResult  = m_nameFilterMap.find(filterName);
-    if(findResult == m_nameFilterMap.end())
-        return lineListVec;
-
-    return findResult->value->doFilter(lineListVec, filterParam);
-}
-
-Ref<JSON::Value> CmdFilterManager::doFormat(Vector<String> lineColumns)
-{
-    String name;
-    String param;
-    int formatSize =m_formatFilter.size(); 
-    if (formatSize)
+    for (auto& stage : m_stages)
     {
-        name = m_formatFilter[formatSize - 1];
-        param = m_formatParamFilter[formatSize - 1];
+        lineListVec = stage.filter->doFilter(WTFMove(lineListVec), stage.param);
     }
-    else
-    {
-        name = "keys";
-        param = "";
-    }
-
-    auto findResult  = m_nameFilterMap.find(name);
-    if(findResult == m_nameFilterMap.end())
-        return JSON::Value::null();
 
-    FormatBase* format = (FormatBase*)findResult->value.get();
-    return format->doFormat(lineColumns, param);
+    return lineListVec;
 }
 
-void CmdFilterManager::initFilterVec()
+size_t CmdFilterManager::writeFiltered(JSONWriter& writer, Vector<String> lines) const
 {
-    m_filterVec.append(adoptRef(*new LineCharsFilter()));
-    m_filterVec.append(adoptRef(*new LineCutFilter()));
-    m_filterVec.append(adoptRef(*new LineHeadFilter()));
-    m_filterVec.append(adoptRef(*new LineIgnoreFilter()));
-    m_filterVec.append(adoptRef(*new LineLettersFilter()));
-    m_filterVec.append(adoptRef(*new LinePickFilter()));
-    m_filterVec.append(adoptRef(*new LineSentencesFilter()));
-    m_filterVec.append(adoptRef(*new LineSplitFilter()));
-    m_filterVec.append(adoptRef(*new LineTailFilter()));
-    m_filterVec.append(adoptRef(*new LineWordsFilter()));
-
-    m_filterVec.append(adoptRef(*new ColumnCharsFilter()));
-    m_filterVec.append(adoptRef(*new ColumnCutFilter()));
-    m_filterVec.append(adoptRef(*new ColumnDelimiterFilter()));
-    m_filterVec.append(adoptRef(*new ColumnHeadFilter()));
-    m_filterVec.append(adoptRef(*new ColumnIgnoreFilter()));
-    m_filterVec.append(adoptRef(*new ColumnLettersFilter()));
-    m_filterVec.append(adoptRef(*new ColumnPickFilter()));
-    m_filterVec.append(adoptRef(*new ColumnSentencesFilter()));
-    m_filterVec.append(adoptRef(*new ColumnTailFilter()));
-    m_filterVec.append(adoptRef(*new ColumnWordsFilter()));
-
-    m_filterVec.append(adoptRef(*new FormatArray()));
-    m_filterVec.append(adoptRef(*new FormatKeys()));
-}
+    Vector<Row> rows = filterLines(WTFMove(lines));
 
-void CmdFilterManager::initNameFilterMap()
-{
-    int size = m_filterVec.size();
+    int size = rows.size();
     for (int i = 0; i < size; i++)
     {
-        m_nameFilterMap.set(m_filterVec[i]->name().convertToASCIILowercase(), m_filterVec[i]);
+        if (m_format)
+            m_format->writeFormat(writer, WTFMove(rows[i]), m_formatParam, m_formatKeys);
+        else
+            writer.writeNull();
     }
+
+    return size;
 }
 
 } // namespace PurCFetcher
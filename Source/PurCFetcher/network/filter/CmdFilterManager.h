@@ -54,31 +54,47 @@
 
 namespace PurCFetcher {
 
+// The compiled form of a cmdfilter expression: the filter stages to run
+// and the format of the rows. It is immutable once compiled, so the
+// requests using the same expression share one instance.
 class CmdFilterManager : public RefCounted<CmdFilterManager> {
 public:
-    CmdFilterManager();
+    // Returns the cached plan of the expression, compiling it if needed.
+    static Ref<CmdFilterManager> compile(const String& cmdFilter);
+    static Ref<CmdFilterManager> create(const String& cmdFilter);
     ~CmdFilterManager();
 
 public:
-    bool addFilter(String name, String param);
-    Vector<Ref<JSON::Value>> doFilter(Vector<String> lines);
+    // Writes the formatted rows as the elements of the array the writer
+    // is in, and returns how many rows were written.
+    size_t writeFiltered(JSONWriter&, Vector<String> lines) const;
+
+    // Whether the lines can be filtered batch by batch: the line cut
+    // filters (head, tail, pick...) need to see all lines at once.
+    bool canFilterIncrementally() const { return !m_hasLineCutFilter; }
 
 private:
-    void initFilterVec();
-    void initNameFilterMap();
+    explicit CmdFilterManager(const String& cmdFilter);
+
+    static const HashMap<String, RefPtr<FilterBase>>& filterRegistry();
+
+    void parseCmdFilter(const String& cmdFilter);
+    bool addFilter(String name, String param);
 
-    Vector<Vector<String>> doFilterInner(Vector<Vector<String>>& lineListVec, String filterName, String filterParam);
-    Ref<JSON::Value> doFormat(Vector<String> lineColumns);
+    Vector<Row> filterLines(Vector<String>&& lines) const;
 
 private:
-    HashMap<String, RefPtr<FilterBase>> m_nameFilterMap;
-    Vector<RefPtr<FilterBase>> m_filterVec;
+    struct Stage {
+        RefPtr<FilterBase> filter;
+        String param;
+    };
+    Vector<Stage> m_stages;
 
-    Vector<String> m_formatFilter;
-    Vector<String> m_formatParamFilter;
+    RefPtr<FormatBase> m_format;
+    String m_formatParam;
+    Vector<CString> m_formatKeys;
 
-    Vector<String> m_filterNameVec;
-    Vector<String> m_filterParamVec;
+    bool m_hasLineCutFilter { false };
 };
 
 } // namespace PurCFetcher
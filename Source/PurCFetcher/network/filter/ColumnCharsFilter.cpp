@@ -103,7 +103,7 @@ Vector<Row> ColumnCharsFilter::doFilter(Vector<Row> rowVec, String param)
 Vector<Row> ColumnCharsFilter::splitRow(Row& row, String param)
 {
     Vector<Row> result;
-    result.append(filterInnter(row, param));
+    result.append(filterInnter(WTFMove(row), param));
     return result;
 }
 
@@ -91,25 +91,26 @@ Vector<String> ColumnCutFilter::doFilterInner(Vector<String> lines, String param
     int size = lines.size();
     int i = 0;
     int n = left * i + right;
-    Vector<int> indexVec;
+    Vector<bool> cutMask(size, false);
     while(n < size)
     {
         if (n >= 0)
         {
-            indexVec.append(n);
+            cutMask[n] = true;
         }
         i++;
         n = left * i + right;
     }
-    
+
     Vector<String> result;
+    result.reserveInitialCapacity(size);
     for(int i = 0; i < size; i++)
     {
-        if (indexVec.contains(i))
+        if (cutMask[i])
         {
             continue;
         }
-        result.append(lines[i]);
+        result.uncheckedAppend(WTFMove(lines[i]));
     }
 
     return result;
@@ -124,7 +125,7 @@ Vector<Row> ColumnCutFilter::doFilter(Vector<Row> rowVec, String param)
     size_t size = rowVec.size();
     for (size_t i = 0; i < size; i++)
     {
-        result.append(doFilterInner(rowVec[i], param));
+        result.append(doFilterInner(WTFMove(rowVec[i]), param));
     }
     return result;
 }
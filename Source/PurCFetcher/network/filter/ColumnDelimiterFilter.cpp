@@ -105,7 +105,7 @@ Vector<Row> ColumnDelimiterFilter::doFilter(Vector<Row> rowVec, String param)
 Vector<Row> ColumnDelimiterFilter::splitRow(Row& row, String param)
 {
     Vector<Row> result;
-    result.append(filterInnter(row, param));
+    result.append(filterInnter(WTFMove(row), param));
     return result;
 }
 
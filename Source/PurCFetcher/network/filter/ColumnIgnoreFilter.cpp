@@ -95,10 +95,10 @@ Vector<String> ColumnIgnoreFilter::doFilterInner(Vector<String> lines, String pa
         }
     }
 
-    Vector<String> result;
     if (limit == 0)
     {
-        return result;
+        lines.clear();
+        return lines;
     }
 
     int ignoreBegin = limit > 0 ? start : start + limit + 1;
@@ -109,13 +109,17 @@ Vector<String> ColumnIgnoreFilter::doFilterInner(Vector<String> lines, String pa
         return lines;
     }
 
-    result.append(lines.data(), ignoreBegin);
-    if ((ignoreBegin + ignoreSize) < (int)lines.size())
+    if (ignoreBegin < 0)
+    {
+        ignoreSize += ignoreBegin;
+        ignoreBegin = 0;
+    }
+    if (ignoreSize > 0)
     {
-        result.append(lines.data() + ignoreBegin + ignoreSize, lines.size() - ignoreBegin - ignoreSize);
+        lines.remove(ignoreBegin, std::min<size_t>(ignoreSize, lines.size() - ignoreBegin));
     }
 
-    return result;
+    return lines;
 }
 
 Vector<Row> ColumnIgnoreFilter::doFilter(Vector<Row> rowVec, String param)
@@ -127,7 +131,7 @@ Vector<Row> ColumnIgnoreFilter::doFilter(Vector<Row> rowVec, String param)
     size_t size = rowVec.size();
     for (size_t i = 0; i < size; i++)
     {
-        result.append(doFilterInner(rowVec[i], param));
+        result.append(doFilterInner(WTFMove(rowVec[i]), param));
     }
     return result;
 }
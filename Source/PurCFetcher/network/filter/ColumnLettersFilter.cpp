@@ -82,22 +82,8 @@ Vector<String> ColumnLettersFilter::filterInnter(Vector<String> lines, String pa
     Vector<String> res;
     for (size_t i = 0; i < size; i++)
     {
-        switch(g_unichar_type(g_utf8_get_char((const char*)result[i].characters8())))
-        {
-            case G_UNICODE_LOWERCASE_LETTER:
-            case G_UNICODE_MODIFIER_LETTER:
-            case G_UNICODE_OTHER_LETTER:
-            case G_UNICODE_TITLECASE_LETTER:
-            case G_UNICODE_UPPERCASE_LETTER:
-            case G_UNICODE_DECIMAL_NUMBER:
-            case G_UNICODE_LETTER_NUMBER:
-            case G_UNICODE_OTHER_NUMBER:
-                res.append(result[i]);
-                break;
-
-            default:
-                break;
-        }
+        if (isLetterOrNumber(result[i]))
+            res.append(WTFMove(result[i]));
     }
 
     return res;
@@ -131,7 +117,7 @@ Vector<Row> ColumnLettersFilter::doFilter(Vector<Row> rowVec, String param)
 Vector<Row> ColumnLettersFilter::splitRow(Row& row, String param)
 {
     Vector<Row> result;
-    result.append(filterInnter(row, param));
+    result.append(filterInnter(WTFMove(row), param));
     return result;
 }
 
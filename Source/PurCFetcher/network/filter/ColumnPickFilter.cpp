@@ -114,7 +114,7 @@ Vector<Row> ColumnPickFilter::doFilter(Vector<Row> rowVec, String param)
     size_t size = rowVec.size();
     for (size_t i = 0; i < size; i++)
     {
-        result.append(doFilterInner(rowVec[i], param));
+        result.append(doFilterInner(WTFMove(rowVec[i]), param));
     }
     return result;
 }
@@ -87,7 +87,7 @@ Vector<String> ColumnSentencesFilter::splitLine(String line)
     }
 
     const char* source = (const char*)line.characters8();
-    UCharBreaker breaker(source);
+    UCharBreaker breaker(source, line.length());
     const gunichar* gucharSource = breaker.getUChar();
     int gucharSourceLen = breaker.getUCharLen();
     const struct UCharBreakAttr* breakAttrs = breaker.getBreakAttrs();
@@ -165,7 +165,7 @@ Vector<Row> ColumnSentencesFilter::doFilter(Vector<Row> rowVec, String param)
 Vector<Row> ColumnSentencesFilter::splitRow(Row& row, String)
 {
     Vector<Row> result;
-    result.append(filterInnter(row));
+    result.append(filterInnter(WTFMove(row)));
     return result;
 }
 
@@ -78,9 +78,8 @@ Vector<String> ColumnTailFilter::doFilterInner(Vector<String> lines, String para
     {
         return lines;
     }
-    Vector<String> result;
-    result.append(lines.data() + size - limit, limit);
-    return result;
+    lines.remove(0, size - limit);
+    return lines;
 }
 
 Vector<Row> ColumnTailFilter::doFilter(Vector<Row> rowVec, String param)
@@ -92,7 +91,7 @@ Vector<Row> ColumnTailFilter::doFilter(Vector<Row> rowVec, String param)
     size_t size = rowVec.size();
     for (size_t i = 0; i < size; i++)
     {
-        result.append(doFilterInner(rowVec[i], param));
+        result.append(doFilterInner(WTFMove(rowVec[i]), param));
     }
     return result;
 }
@@ -84,7 +84,10 @@ Vector<String> ColumnWordsFilter::splitLine(String line, String)
     }
 
     const char* source = (const char*)line.characters8();
-    UCharBreaker breaker(source);
+    if (isASCIIText(source, line.length()))
+        return splitASCIIWords(source, line.length());
+
+    UCharBreaker breaker(source, line.length());
     const gunichar* gucharSource = breaker.getUChar();
     int gucharSourceLen = breaker.getUCharLen();
     const struct UCharBreakAttr* breakAttrs = breaker.getBreakAttrs();
@@ -163,7 +166,7 @@ Vector<Row> ColumnWordsFilter::doFilter(Vector<Row> rowVec, String param)
 Vector<Row> ColumnWordsFilter::splitRow(Row& row, String param)
 {
     Vector<Row> result;
-    result.append(filterInnter(row, param));
+    result.append(filterInnter(WTFMove(row), param));
     return result;
 }
 
@@ -49,6 +49,8 @@
 #include "config.h"
 #include "FilterBase.h"
 
+#include <wtf/text/ASCIIFastPath.h>
+
 IGNORE_WARNINGS_BEGIN("implicit-fallthrough")
 
 namespace PurCFetcher {
@@ -1619,9 +1621,161 @@ Alphabetic:
 
 }
 
+bool FilterBase::isASCIIText(const char* text, size_t length)
+{
+    const LChar* p = reinterpret_cast<const LChar*>(text);
+    const LChar* end = p + length;
+#if CPU(X86_SSE2)
+    // 16 bytes at a time: any byte with the high bit set is non-ASCII
+    for (; end - p >= 16; p += 16) {
+        __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+        if (_mm_movemask_epi8(chunk))
+            return false;
+    }
+#endif
+    return charactersAreAllASCII(p, end - p);
+}
+
+bool FilterBase::isLetterOrNumber(const String& character)
+{
+    if (character.isEmpty())
+        return false;
+
+    LChar first = character.characters8()[0];
+    if (isASCII(first))
+        return isASCIIAlphanumeric(first);
+
+    switch (g_unichar_type(g_utf8_get_char((const char*)character.characters8())))
+    {
+        case G_UNICODE_LOWERCASE_LETTER:
+        case G_UNICODE_MODIFIER_LETTER:
+        case G_UNICODE_OTHER_LETTER:
+        case G_UNICODE_TITLECASE_LETTER:
+        case G_UNICODE_UPPERCASE_LETTER:
+        case G_UNICODE_DECIMAL_NUMBER:
+        case G_UNICODE_LETTER_NUMBER:
+        case G_UNICODE_OTHER_NUMBER:
+            return true;
+
+        default:
+            return false;
+    }
+}
+
+// The Word_Break classes of UAX#29 for the ASCII range, as genBreaks()
+// assigns them.
+enum ASCIIWordBreakType {
+    ASCIIWordBreakOther,
+    ASCIIWordBreakNewline,
+    ASCIIWordBreakALetter,
+    ASCIIWordBreakMidNumLet,
+    ASCIIWordBreakMidLetter,
+    ASCIIWordBreakMidNum,
+    ASCIIWordBreakNumeric,
+    ASCIIWordBreakExtendNumLet,
+};
+
+static ASCIIWordBreakType asciiWordBreakType(LChar c)
+{
+    if (isASCIIAlpha(c))
+        return ASCIIWordBreakALetter;
+    if (isASCIIDigit(c))
+        return ASCIIWordBreakNumeric;
+
+    switch (c) {
+    case '\n':
+    case '\v':
+    case '\f':
+    case '\r':
+        return ASCIIWordBreakNewline;
+    case '\'':
+    case '.':
+        return ASCIIWordBreakMidNumLet;
+    case ':':
+        return ASCIIWordBreakMidLetter;
+    case ',':
+    case ';':
+        return ASCIIWordBreakMidNum;
+    case '_':
+        return ASCIIWordBreakExtendNumLet;
+    default:
+        return ASCIIWordBreakOther;
+    }
+}
+
+// Splits an ASCII line into words the same way the words filters do with
+// the breaks computed by UCharBreaker, without decoding the line or
+// computing the other break attributes.
+Vector<String> FilterBase::splitASCIIWords(const char* text, size_t length)
+{
+    Vector<String> result;
+    if (!length)
+        return result;
+
+    Vector<bool> boundaries(length, false);
+    ASCIIWordBreakType prevPrevType = ASCIIWordBreakOther;
+    ASCIIWordBreakType prevType = ASCIIWordBreakOther;
+    int prevIndex = -1;
+    for (size_t i = 0; i < length; i++) {
+        // CR LF is a single grapheme
+        if (i && text[i] == '\n' && text[i - 1] == '\r')
+            continue;
+
+        ASCIIWordBreakType type = asciiWordBreakType(text[i]);
+        bool isBoundary;
+        if (prevType == ASCIIWordBreakNewline && prevIndex + 1 == (int)i)
+            isBoundary = true;
+        else if (type == ASCIIWordBreakNewline)
+            isBoundary = true;
+        else if ((prevType == ASCIIWordBreakALetter || prevType == ASCIIWordBreakNumeric || prevType == ASCIIWordBreakExtendNumLet)
+            && (type == ASCIIWordBreakALetter || type == ASCIIWordBreakNumeric || type == ASCIIWordBreakExtendNumLet))
+            isBoundary = false;
+        else if (prevPrevType == ASCIIWordBreakALetter && type == ASCIIWordBreakALetter
+            && (prevType == ASCIIWordBreakMidLetter || prevType == ASCIIWordBreakMidNumLet)) {
+            boundaries[prevIndex] = false;
+            isBoundary = false;
+        } else if (prevPrevType == ASCIIWordBreakNumeric && type == ASCIIWordBreakNumeric
+            && (prevType == ASCIIWordBreakMidNum || prevType == ASCIIWordBreakMidNumLet)) {
+            boundaries[prevIndex] = false;
+            isBoundary = false;
+        } else
+            isBoundary = true;
+
+        boundaries[i] = isBoundary;
+        prevPrevType = prevType;
+        prevType = type;
+        prevIndex = i;
+    }
+    boundaries[0] = true;
+
+    // a word gathers the kept characters up to the next boundary
+    Vector<LChar> word;
+    for (size_t i = 0; i < length; i++) {
+        bool save = isASCIIAlphanumeric(text[i]) || !boundaries[i];
+        if (!save)
+            continue;
+
+        if (boundaries[i] && !word.isEmpty()) {
+            result.append(String(word.data(), word.size()));
+            word.clear();
+        }
+        word.append(text[i]);
+    }
+    if (!word.isEmpty())
+        result.append(String(word.data(), word.size()));
+    return result;
+}
+
 Vector<String> FilterBase::splitUTF8(const char* source, const char* sourceEnd)
 {
     Vector<String> result;
+    if (isASCIIText(source, sourceEnd - source)) {
+        result.reserveInitialCapacity(sourceEnd - source);
+        for (const char* p = source; p < sourceEnd; p++)
+            result.uncheckedAppend(String(p, 1));
+        return result;
+    }
+
     for (int sourceOffset = 0; sourceOffset < sourceEnd - source; ) {
         int begin = sourceOffset;
 
@@ -1642,12 +1796,19 @@ Vector<Row> FilterBase::doFilter(Vector<Row> rowVec, String param)
 #endif
 
 UCharBreaker::UCharBreaker(const char* text)
+ : UCharBreaker(text, text ? strlen(text) : 0)
+{
+}
+
+UCharBreaker::UCharBreaker(const char* text, int length)
  : m_text(text)
+ , m_textLen(length)
  , m_uchar(NULL)
  , m_ucharLen(0)
  , m_breakAttrs(NULL)
  , m_breakAttrsCount(0)
 {
+    doUStrGetBreaks();
 }
 
 UCharBreaker::~UCharBreaker()
@@ -1665,14 +1826,15 @@ void UCharBreaker::doUStrGetBreaks()
     if (!m_text)
         return;
 
-    int textLen = strlen(m_text);
+    int textLen = m_textLen;
     if (textLen <= 0)
         return;
 
-    m_breakAttrsCount = textLen;
+    // one attribute per character plus the end position
+    m_breakAttrsCount = textLen + 1;
     m_breakAttrs = (struct UCharBreakAttr*) calloc(m_breakAttrsCount,
             sizeof(struct UCharBreakAttr));
-    m_uchar = g_utf8_to_ucs4_fast(m_text, -1, &m_ucharLen);
+    m_uchar = g_utf8_to_ucs4_fast(m_text, textLen, &m_ucharLen);
     if(!m_uchar || m_ucharLen <=0)
         return;
 
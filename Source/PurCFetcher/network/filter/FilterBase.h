@@ -84,6 +84,13 @@ public:
 
 public:
     Vector<String> splitUTF8(const char* source, const char* sourceEnd);
+
+    // Fast paths for the lines without any non-ASCII character.
+    static bool isASCIIText(const char* text, size_t length);
+    static Vector<String> splitASCIIWords(const char* text, size_t length);
+
+    // Whether the UTF-8 character is a letter or a number.
+    static bool isLetterOrNumber(const String& character);
 };
 
 struct UCharBreakAttr
@@ -119,6 +126,7 @@ struct UCharBreakAttr
 class UCharBreaker {
 public:
     UCharBreaker(const char* text);
+    UCharBreaker(const char* text, int length);
     ~UCharBreaker();
 
     const char* getText() { return m_text; }
@@ -134,6 +142,7 @@ private:
 
 private:
     const char* m_text;
+    int m_textLen;
     gunichar* m_uchar;
     glong m_ucharLen;
 
@@ -110,4 +110,56 @@ Ref<JSON::Value> FormatArray::doFormat(Vector<String> lineColumns, String param)
     return array;
 }
 
+void FormatArray::writeFormat(JSONWriter& writer, Vector<String> lineColumns, String param, const Vector<CString>& escapedKeys)
+{
+    UNUSED_PARAM(escapedKeys);
+    writer.beginArray();
+    if (lineColumns.size() == 0)
+    {
+        writer.endArray();
+        return;
+    }
+
+    int left = 0;
+    String split = ":";
+    if (!param.isEmpty())
+    {
+        Vector<String> paramVec = param.split(",");
+        if (paramVec.size() >= 2)
+        {
+            left = paramVec[0].toInt();
+            split  = paramVec[1].stripLeadingAndTrailingCharacters(isSingleQuotes);
+        }
+    }
+
+    int size = lineColumns.size();
+    if (left == 0)
+    {
+        for (int i = 0; i < size; i++)
+        {
+            writer.writeString(lineColumns[i]);
+        }
+    }
+    else
+    {
+        for (int i = 0; i < left && i < size; i++)
+        {
+            writer.writeString(lineColumns[i]);
+        }
+
+        StringBuilder sb;
+        for (int i = left; i < size; i++)
+        {
+            sb.append(lineColumns[i]);
+            sb.append(split);
+        }
+        if (sb.length())
+        {
+            sb.resize(sb.length() - split.length());
+            writer.writeString(sb.toString());
+        }
+    }
+    writer.endArray();
+}
+
 } // namespace PurCFetcher
@@ -60,6 +60,7 @@ public:
     virtual String name() { return "array"; }
     virtual FilterType type() { return FilterTypeFormat; }
     virtual Ref<JSON::Value> doFormat(Vector<String> lineColumns, String param);
+    virtual void writeFormat(JSONWriter& writer, Vector<String> lineColumns, String param, const Vector<CString>& escapedKeys);
 };
 
 } // namespace PurCFetcher
@@ -50,6 +50,7 @@
 
 #include "NetworkDataTask.h"
 #include "FilterBase.h"
+#include "JSONWriter.h"
 #include <wtf/JSONValues.h>
 
 namespace PurCFetcher {
@@ -58,6 +59,18 @@ class FormatBase : public FilterBase {
 public:
     virtual Vector<Row> doFilter(Vector<Row> rowVec, String)  { return rowVec; }
     virtual Ref<JSON::Value> doFormat(Vector<String> lineColumns, String param) = 0;
+
+    // The object keys named by the param, escaped for the JSON output.
+    // Computed once when the plan is compiled and passed to writeFormat().
+    virtual Vector<CString> escapeKeys(const String&) { return { }; }
+
+    // Writes the row straight into the response; by default through the
+    // value built by doFormat().
+    virtual void writeFormat(JSONWriter& writer, Vector<String> lineColumns, String param, const Vector<CString>& escapedKeys)
+    {
+        UNUSED_PARAM(escapedKeys);
+        writer.writeValue(doFormat(WTFMove(lineColumns), WTFMove(param)));
+    }
 };
 
 } // namespace PurCFetcher
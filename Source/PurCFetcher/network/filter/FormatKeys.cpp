@@ -50,6 +50,8 @@
 #include "config.h"
 #include "FormatKeys.h"
 
+#include <stdio.h>
+
 namespace PurCFetcher {
 
 FormatKeys::FormatKeys()
@@ -60,7 +62,7 @@ FormatKeys::~FormatKeys()
 {
 }
 
-Ref<JSON::Value> FormatKeys::doFormat(Vector<String> lineColumns, String param)
+Vector<String> FormatKeys::parseKeys(const String& param)
 {
     Vector<String> keyVec;
     if (!param.isEmpty())
@@ -77,6 +79,12 @@ Ref<JSON::Value> FormatKeys::doFormat(Vector<String> lineColumns, String param)
             }
         }
     }
+    return keyVec;
+}
+
+Ref<JSON::Value> FormatKeys::doFormat(Vector<String> lineColumns, String param)
+{
+    Vector<String> keyVec = parseKeys(param);
 
     auto result = JSON::Object::create();
     int size = lineColumns.size();
@@ -94,4 +102,36 @@ Ref<JSON::Value> FormatKeys::doFormat(Vector<String> lineColumns, String param)
     return result;
 }
 
+Vector<CString> FormatKeys::escapeKeys(const String& param)
+{
+    Vector<CString> escapedKeys;
+    for (auto& key : parseKeys(param))
+        escapedKeys.append(JSONWriter::escapeKey(key));
+    return escapedKeys;
+}
+
+void FormatKeys::writeFormat(JSONWriter& writer, Vector<String> lineColumns, String param, const Vector<CString>& escapedKeys)
+{
+    UNUSED_PARAM(param);
+
+    writer.beginObject();
+    int size = lineColumns.size();
+    int keySize = escapedKeys.size();
+    for (int i = 0; i < keySize && i < size; i++)
+    {
+        writer.writeEscapedKey(escapedKeys[i]);
+        writer.writeString(lineColumns[i]);
+    }
+
+    for (int i = keySize; i < size; i++)
+    {
+        // "C<index>" for the columns past the given keys
+        char columnKey[16];
+        snprintf(columnKey, sizeof(columnKey), "C%d", i);
+        writer.writeKey(columnKey);
+        writer.writeString(lineColumns[i]);
+    }
+    writer.endObject();
+}
+
 } // namespace PurCFetcher
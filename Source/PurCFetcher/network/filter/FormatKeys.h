@@ -60,6 +60,11 @@ public:
     virtual String name() { return "keys"; }
     virtual FilterType type() { return FilterTypeFormat; }
     virtual Ref<JSON::Value> doFormat(Vector<String> lineColumns, String param);
+    virtual Vector<CString> escapeKeys(const String& param);
+    virtual void writeFormat(JSONWriter& writer, Vector<String> lineColumns, String param, const Vector<CString>& escapedKeys);
+
+private:
+    static Vector<String> parseKeys(const String& param);
 };
 
 } // namespace PurCFetcher
@@ -0,0 +1,331 @@
+/* 
+ * Copyright (C) 2020 Beijing FMSoft Technologies Co., Ltd.
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ * 
+ * Or,
+ * 
+ * As this component is a program released under LGPLv3, which claims
+ * explicitly that the program could be modified by any end user
+ * even if the program is conveyed in non-source form on the system it runs.
+ * Generally, if you distribute this program in embedded devices,
+ * you might not satisfy this condition. Under this situation or you can
+ * not accept any condition of LGPLv3, you need to get a commercial license
+ * from FMSoft, along with a patent license for the patents owned by FMSoft.
+ * 
+ * If you have got a commercial/patent license of this program, please use it
+ * under the terms and conditions of the commercial license.
+ * 
+ * For more information about the commercial license and patent license,
+ * please refer to
+ * <https://hybridos.fmsoft.cn/blog/hybridos-licensing-policy/>.
+ * 
+ * Also note that the LGPLv3 license does not apply to any entity in the
+ * Exception List published by Beijing FMSoft Technologies Co., Ltd.
+ * 
+ * If you are or the entity you represent is listed in the Exception List,
+ * the above open source or free software license does not apply to you
+ * or the entity you represent. Regardless of the purpose, you should not
+ * use the software in any way whatsoever, including but not limited to
+ * downloading, viewing, copying, distributing, compiling, and running.
+ * If you have already downloaded it, you MUST destroy all of its copies.
+ * 
+ * The Exception List is published by FMSoft and may be updated
+ * from time to time. For more information, please see
+ * <https://www.fmsoft.cn/exception-list>.
+ */ 
+
+#include "config.h"
+#include "JSONWriter.h"
+
+#include <wtf/ASCIICType.h>
+#include <wtf/dtoa.h>
+
+namespace PurCFetcher {
+
+// The characters written as is, the others are escaped or encoded. '<' and
+// '>' are escaped as JSON::Value does, to prevent script execution.
+static inline bool isPlainJSONCharacter(UChar c)
+{
+    return c >= 0x20 && c < 0x7F && c != '"' && c != '\\' && c != '<' && c != '>';
+}
+
+static void appendEscapeSequence(Vector<char>& buffer, UChar c)
+{
+    switch (c) {
+    case '\b':
+        buffer.append("\\b", 2);
+        return;
+    case '\f':
+        buffer.append("\\f", 2);
+        return;
+    case '\n':
+        buffer.append("\\n", 2);
+        return;
+    case '\r':
+        buffer.append("\\r", 2);
+        return;
+    case '\t':
+        buffer.append("\\t", 2);
+        return;
+    case '\\':
+        buffer.append("\\\\", 2);
+        return;
+    case '"':
+        buffer.append("\\\"", 2);
+        return;
+    }
+
+    char escape[6] = { '\\', 'u',
+        upperNibbleToASCIIHexDigit(c >> 8), lowerNibbleToASCIIHexDigit(c >> 8),
+        upperNibbleToASCIIHexDigit(c), lowerNibbleToASCIIHexDigit(c) };
+    buffer.append(escape, sizeof(escape));
+}
+
+static void appendUTF8(Vector<char>& buffer, UChar32 c)
+{
+    char bytes[4];
+    size_t length;
+    if (c < 0x800) {
+        bytes[0] = 0xC0 | (c >> 6);
+        bytes[1] = 0x80 | (c & 0x3F);
+        length = 2;
+    } else if (c < 0x10000) {
+        bytes[0] = 0xE0 | (c >> 12);
+        bytes[1] = 0x80 | ((c >> 6) & 0x3F);
+        bytes[2] = 0x80 | (c & 0x3F);
+        length = 3;
+    } else {
+        bytes[0] = 0xF0 | (c >> 18);
+        bytes[1] = 0x80 | ((c >> 12) & 0x3F);
+        bytes[2] = 0x80 | ((c >> 6) & 0x3F);
+        bytes[3] = 0x80 | (c & 0x3F);
+        length = 4;
+    }
+    buffer.append(bytes, length);
+}
+
+template<typename CharacterType>
+static void appendEscaped(Vector<char>& buffer, const CharacterType* characters, unsigned length)
+{
+    unsigned i = 0;
+    while (i < length) {
+        // copy the runs of plain ASCII in one go
+        unsigned start = i;
+        while (i < length && isPlainJSONCharacter(characters[i]))
+            i++;
+        if (i > start) {
+            if constexpr (sizeof(CharacterType) == 1)
+                buffer.append(reinterpret_cast<const char*>(characters + start), i - start);
+            else {
+                for (unsigned j = start; j < i; j++)
+                    buffer.append(static_cast<char>(characters[j]));
+            }
+        }
+        if (i == length)
+            break;
+
+        UChar32 c = characters[i++];
+        if (c < 0x80) {
+            appendEscapeSequence(buffer, c);
+            continue;
+        }
+
+        if (U16_IS_LEAD(c) && i < length && U16_IS_TRAIL(characters[i]))
+            c = U16_GET_SUPPLEMENTARY(c, characters[i++]);
+        else if (U16_IS_SURROGATE(c)) {
+            // a lone surrogate can not be encoded as UTF-8
+            appendEscapeSequence(buffer, c);
+            continue;
+        }
+        appendUTF8(buffer, c);
+    }
+}
+
+void JSONWriter::appendQuotedString(Vector<char>& buffer, StringView string)
+{
+    buffer.append('"');
+    if (string.is8Bit())
+        appendEscaped(buffer, string.characters8(), string.length());
+    else
+        appendEscaped(buffer, string.characters16(), string.length());
+    buffer.append('"');
+}
+
+CString JSONWriter::escapeKey(const String& key)
+{
+    Vector<char> buffer;
+    appendQuotedString(buffer, key);
+    buffer.append(':');
+    return CString(buffer.data(), buffer.size());
+}
+
+void JSONWriter::willWriteValue()
+{
+    if (m_afterKey) {
+        m_afterKey = false;
+        return;
+    }
+
+    if (m_hasMembers.isEmpty())
+        return;
+
+    if (m_hasMembers.last())
+        m_buffer.append(',');
+    m_hasMembers.last() = true;
+}
+
+void JSONWriter::beginObject()
+{
+    willWriteValue();
+    m_buffer.append('{');
+    m_hasMembers.append(false);
+}
+
+void JSONWriter::endObject()
+{
+    ASSERT(!m_hasMembers.isEmpty() && !m_afterKey);
+    m_hasMembers.removeLast();
+    m_buffer.append('}');
+}
+
+void JSONWriter::beginArray()
+{
+    willWriteValue();
+    m_buffer.append('[');
+    m_hasMembers.append(false);
+}
+
+void JSONWriter::endArray()
+{
+    ASSERT(!m_hasMembers.isEmpty() && !m_afterKey);
+    m_hasMembers.removeLast();
+    m_buffer.append(']');
+}
+
+void JSONWriter::writeKey(const char* asciiKey)
+{
+    willWriteValue();
+    m_buffer.append('"');
+    appendLiteral(asciiKey, strlen(asciiKey));
+    m_buffer.append("\":", 2);
+    m_afterKey = true;
+}
+
+void JSONWriter::writeEscapedKey(const CString& escapedKey)
+{
+    willWriteValue();
+    appendLiteral(escapedKey.data(), escapedKey.length());
+    m_afterKey = true;
+}
+
+void JSONWriter::writeString(const String& string)
+{
+    willWriteValue();
+    if (string.isNull()) {
+        appendLiteral("\"\"", 2);
+        return;
+    }
+    appendQuotedString(m_buffer, string);
+}
+
+void JSONWriter::writeInteger(int64_t value)
+{
+    willWriteValue();
+
+    char digits[24];
+    char* end = digits + sizeof(digits);
+    char* p = end;
+    uint64_t magnitude = value < 0 ? -static_cast<uint64_t>(value) : value;
+    do {
+        *--p = '0' + magnitude % 10;
+        magnitude /= 10;
+    } while (magnitude);
+    if (value < 0)
+        *--p = '-';
+    appendLiteral(p, end - p);
+}
+
+void JSONWriter::writeDouble(double value)
+{
+    willWriteValue();
+    if (!std::isfinite(value)) {
+        appendLiteral("null", 4);
+        return;
+    }
+
+    NumberToStringBuffer buffer;
+    const char* number = numberToString(value, buffer);
+    appendLiteral(number, strlen(number));
+}
+
+void JSONWriter::writeBoolean(bool value)
+{
+    willWriteValue();
+    if (value)
+        appendLiteral("true", 4);
+    else
+        appendLiteral("false", 5);
+}
+
+void JSONWriter::writeNull()
+{
+    willWriteValue();
+    appendLiteral("null", 4);
+}
+
+void JSONWriter::writeValue(const JSON::Value& value)
+{
+    switch (value.type()) {
+    case JSON::Value::Type::Null:
+        writeNull();
+        return;
+    case JSON::Value::Type::Boolean: {
+        bool result = false;
+        value.asBoolean(result);
+        writeBoolean(result);
+        return;
+    }
+    case JSON::Value::Type::Double:
+    case JSON::Value::Type::Integer: {
+        double result = 0;
+        value.asDouble(result);
+        writeDouble(result);
+        return;
+    }
+    case JSON::Value::Type::String: {
+        String result;
+        value.asString(result);
+        writeString(result);
+        return;
+    }
+    case JSON::Value::Type::Array: {
+        auto& array = static_cast<const JSON::Array&>(value);
+        beginArray();
+        for (auto& element : array)
+            writeValue(*element);
+        endArray();
+        return;
+    }
+    case JSON::Value::Type::Object: {
+        // the member order of an object is not exposed, let it write itself
+        willWriteValue();
+        CString json = value.toJSONString().utf8();
+        appendLiteral(json.data(), json.length());
+        return;
+    }
+    }
+}
+
+} // namespace PurCFetcher
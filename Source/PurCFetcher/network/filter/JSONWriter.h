@@ -0,0 +1,100 @@
+/* 
+ * Copyright (C) 2020 Beijing FMSoft Technologies Co., Ltd.
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ * 
+ * Or,
+ * 
+ * As this component is a program released under LGPLv3, which claims
+ * explicitly that the program could be modified by any end user
+ * even if the program is conveyed in non-source form on the system it runs.
+ * Generally, if you distribute this program in embedded devices,
+ * you might not satisfy this condition. Under this situation or you can
+ * not accept any condition of LGPLv3, you need to get a commercial license
+ * from FMSoft, along with a patent license for the patents owned by FMSoft.
+ * 
+ * If you have got a commercial/patent license of this program, please use it
+ * under the terms and conditions of the commercial license.
+ * 
+ * For more information about the commercial license and patent license,
+ * please refer to
+ * <https://hybridos.fmsoft.cn/blog/hybridos-licensing-policy/>.
+ * 
+ * Also note that the LGPLv3 license does not apply to any entity in the
+ * Exception List published by Beijing FMSoft Technologies Co., Ltd.
+ * 
+ * If you are or the entity you represent is listed in the Exception List,
+ * the above open source or free software license does not apply to you
+ * or the entity you represent. Regardless of the purpose, you should not
+ * use the software in any way whatsoever, including but not limited to
+ * downloading, viewing, copying, distributing, compiling, and running.
+ * If you have already downloaded it, you MUST destroy all of its copies.
+ * 
+ * The Exception List is published by FMSoft and may be updated
+ * from time to time. For more information, please see
+ * <https://www.fmsoft.cn/exception-list>.
+ */ 
+
+#pragma once
+
+#include <wtf/JSONValues.h>
+#include <wtf/Vector.h>
+#include <wtf/text/CString.h>
+#include <wtf/text/WTFString.h>
+
+namespace PurCFetcher {
+
+// Writes JSON as UTF-8 straight into a response buffer, without building
+// a JSON::Value tree or a String first. The caller gives the structure;
+// the writer puts the separators between the members and the elements.
+// The buffer may be moved out between two writes, e.g. to send a chunk.
+class JSONWriter {
+    WTF_MAKE_NONCOPYABLE(JSONWriter);
+public:
+    explicit JSONWriter(Vector<char>& buffer)
+        : m_buffer(buffer)
+    {
+    }
+
+    // A member name quoted and escaped once, for the keys repeated on
+    // every row of a result.
+    static CString escapeKey(const String&);
+
+    void beginObject();
+    void endObject();
+    void beginArray();
+    void endArray();
+
+    void writeKey(const char* asciiKey);
+    void writeEscapedKey(const CString&);
+
+    void writeString(const String&);
+    void writeInteger(int64_t);
+    void writeDouble(double);
+    void writeBoolean(bool);
+    void writeNull();
+    void writeValue(const JSON::Value&);
+
+private:
+    void willWriteValue();
+    void appendLiteral(const char* literal, size_t length) { m_buffer.append(literal, length); }
+    static void appendQuotedString(Vector<char>&, StringView);
+
+    Vector<char>& m_buffer;
+    // one entry per open object or array: whether it has a member yet
+    Vector<bool, 16> m_hasMembers;
+    bool m_afterKey { false };
+};
+
+} // namespace PurCFetcher
@@ -103,13 +103,13 @@ Vector<Row> LineCharsFilter::doFilter(Vector<Row> rowVec, String param)
 Vector<Row> LineCharsFilter::splitRow(Row& row, String param)
 {
     Vector<Row> result;
-    Vector<String> lineVec = doFilterInner(row, param);
+    Vector<String> lineVec = doFilterInner(WTFMove(row), param);
     int size = lineVec.size();
     for (int i = 0; i < size; i++)
     {
         Row r;
-        r.append(lineVec[i]);
-        result.append(r);
+        r.append(WTFMove(lineVec[i]));
+        result.append(WTFMove(r));
     }
     return result;
 }
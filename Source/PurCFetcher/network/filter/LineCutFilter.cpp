@@ -91,25 +91,26 @@ Vector<Row> LineCutFilter::doFilter(Vector<Row> lines, String param)
     int size = lines.size();
     int i = 0;
     int n = left * i + right;
-    Vector<int> indexVec;
+    Vector<bool> cutMask(size, false);
     while(n < size)
     {
         if (n >= 0)
         {
-            indexVec.append(n);
+            cutMask[n] = true;
         }
         i++;
         n = left * i + right;
     }
-    
+
     Vector<Row> result;
+    result.reserveInitialCapacity(size);
     for(int i = 0; i < size; i++)
     {
-        if (indexVec.contains(i))
+        if (cutMask[i])
         {
             continue;
         }
-        result.append(lines[i]);
+        result.uncheckedAppend(WTFMove(lines[i]));
     }
 
     return result;
@@ -95,10 +95,10 @@ Vector<Row> LineIgnoreFilter::doFilter(Vector<Row> lines, String param)
         }
     }
 
-    Vector<Row> result;
     if (limit == 0)
     {
-        return result;
+        lines.clear();
+        return lines;
     }
 
     int ignoreBegin = limit > 0 ? start : start + limit + 1;
@@ -109,13 +109,17 @@ Vector<Row> LineIgnoreFilter::doFilter(Vector<Row> lines, String param)
         return lines;
     }
 
-    result.append(lines.data(), ignoreBegin);
-    if (ignoreBegin + ignoreSize < (int)lines.size())
+    if (ignoreBegin < 0)
+    {
+        ignoreSize += ignoreBegin;
+        ignoreBegin = 0;
+    }
+    if (ignoreSize > 0)
     {
-        result.append(lines.data() + ignoreBegin + ignoreSize, lines.size() - ignoreBegin - ignoreSize);
+        lines.remove(ignoreBegin, std::min<size_t>(ignoreSize, lines.size() - ignoreBegin));
     }
 
-    return result;
+    return lines;
 }
 
 } // namespace PurCFetcher
@@ -83,22 +83,8 @@ Vector<String> LineLettersFilter::doFilterInner(Vector<String> lines, String par
     Vector<String> res;
     for (size_t i = 0; i < size; i++)
     {
-        switch(g_unichar_type(g_utf8_get_char((const char*)result[i].characters8())))
-        {
-            case G_UNICODE_LOWERCASE_LETTER:
-            case G_UNICODE_MODIFIER_LETTER:
-            case G_UNICODE_OTHER_LETTER:
-            case G_UNICODE_TITLECASE_LETTER:
-            case G_UNICODE_UPPERCASE_LETTER:
-            case G_UNICODE_DECIMAL_NUMBER:
-            case G_UNICODE_LETTER_NUMBER:
-            case G_UNICODE_OTHER_NUMBER:
-                res.append(result[i]);
-                break;
-
-            default:
-                break;
-        }
+        if (isLetterOrNumber(result[i]))
+            res.append(WTFMove(result[i]));
     }
 
     return res;
@@ -132,13 +118,13 @@ Vector<Row> LineLettersFilter::doFilter(Vector<Row> rowVec, String param)
 Vector<Row> LineLettersFilter::splitRow(Row& row, String param)
 {
     Vector<Row> result;
-    Vector<String> lineVec = doFilterInner(row, param);
+    Vector<String> lineVec = doFilterInner(WTFMove(row), param);
     int size = lineVec.size();
     for (int i = 0; i < size; i++)
     {
         Row r;
-        r.append(lineVec[i]);
-        result.append(r);
+        r.append(WTFMove(lineVec[i]));
+        result.append(WTFMove(r));
     }
     return result;
 }
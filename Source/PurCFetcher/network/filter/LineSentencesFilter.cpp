@@ -73,7 +73,7 @@ Vector<String> LineSentencesFilter::splitLine(String line)
     }
 
     const char* source = (const char*)line.characters8();
-    UCharBreaker breaker(source);
+    UCharBreaker breaker(source, line.length());
     const gunichar* gucharSource = breaker.getUChar();
     int gucharSourceLen = breaker.getUCharLen();
     const struct UCharBreakAttr* breakAttrs = breaker.getBreakAttrs();
@@ -159,8 +159,8 @@ Vector<Row> LineSentencesFilter::splitRow(Row& row, String)
     for (int i = 0; i < rowColumnSize; i++)
     {
         Vector<String> splitRet = splitLine(row[i]);
-        lastRow.append(splitRet[0]);
-        rowVec.append(lastRow);
+        lastRow.append(WTFMove(splitRet[0]));
+        rowVec.append(WTFMove(lastRow));
         lastRow.clear();
 
         int size = splitRet.size();
@@ -171,11 +171,11 @@ Vector<Row> LineSentencesFilter::splitRow(Row& row, String)
         for (int j = 1; j < last; j++)
         {
             Row r;
-            r.append(splitRet[j]);
-            rowVec.append(r);
+            r.append(WTFMove(splitRet[j]));
+            rowVec.append(WTFMove(r));
         }
 
-        lastRow.append(splitRet[last]);
+        lastRow.append(WTFMove(splitRet[last]));
     }
     return rowVec;
 }
@@ -96,9 +96,8 @@ Vector<Row> LineSplitFilter::splitRowByUChar(Row& row, UChar uc)
     for (int i = 0; i < rowColumnSize; i++)
     {
         Vector<String> splitRet = row[i].split(uc);
-        printf(".................................i=%d|splitRet[0]=%s\n", i, splitRet[0].characters8());
-        lastRow.append(splitRet[0]);
-        rowVec.append(lastRow);
+        lastRow.append(WTFMove(splitRet[0]));
+        rowVec.append(WTFMove(lastRow));
         lastRow.clear();
 
         int size = splitRet.size();
@@ -109,13 +108,11 @@ Vector<Row> LineSplitFilter::splitRowByUChar(Row& row, UChar uc)
         for (int j = 1; j < last; j++)
         {
             Row r;
-            r.append(splitRet[j]);
-            printf(".................................splitRet[%d]=%s\n", j, splitRet[j].characters8());
-            rowVec.append(r);
+            r.append(WTFMove(splitRet[j]));
+            rowVec.append(WTFMove(r));
         }
 
-        printf(".................................splitRet[%d]=%s\n", last, splitRet[last].characters8());
-        lastRow.append(splitRet[last]);
+        lastRow.append(WTFMove(splitRet[last]));
     }
     return rowVec;
 }
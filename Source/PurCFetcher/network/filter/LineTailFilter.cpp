@@ -78,9 +78,8 @@ Vector<Row> LineTailFilter::doFilter(Vector<Row> lines, String param)
     {
         return lines;
     }
-    Vector<Row> result;
-    result.append(lines.data() + size - limit, limit);
-    return result;
+    lines.remove(0, size - limit);
+    return lines;
 }
 
 } // namespace PurCFetcher
@@ -70,7 +70,10 @@ Vector<String> LineWordsFilter::splitLine(String line, String)
     }
 
     const char* source = (const char*)line.characters8();
-    UCharBreaker breaker(source);
+    if (isASCIIText(source, line.length()))
+        return splitASCIIWords(source, line.length());
+
+    UCharBreaker breaker(source, line.length());
     const gunichar* gucharSource = breaker.getUChar();
     int gucharSourceLen = breaker.getUCharLen();
     const struct UCharBreakAttr* breakAttrs = breaker.getBreakAttrs();
@@ -156,8 +159,8 @@ Vector<Row> LineWordsFilter::splitRow(Row& row, String param)
     for (int i = 0; i < rowColumnSize; i++)
     {
         Vector<String> splitRet = splitLine(row[i], param);
-        lastRow.append(splitRet[0]);
-        rowVec.append(lastRow);
+        lastRow.append(WTFMove(splitRet[0]));
+        rowVec.append(WTFMove(lastRow));
         lastRow.clear();
 
         int size = splitRet.size();
@@ -168,11 +171,11 @@ Vector<Row> LineWordsFilter::splitRow(Row& row, String param)
         for (int j = 1; j < last; j++)
         {
             Row r;
-            r.append(splitRet[j]);
-            rowVec.append(r);
+            r.append(WTFMove(splitRet[j]));
+            rowVec.append(WTFMove(r));
         }
 
-        lastRow.append(splitRet[last]);
+        lastRow.append(WTFMove(splitRet[last]));
     }
     return rowVec;
 }
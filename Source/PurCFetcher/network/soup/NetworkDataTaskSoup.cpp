@@ -261,6 +261,17 @@ void NetworkDataTaskSoup::resume()
     }
 }
 
+void NetworkDataTaskSoup::suspend()
+{
+    if (m_state != State::Running)
+        return;
+
+    // The read in flight completes into m_pendingResult and is
+    // replayed by resume().
+    m_state = State::Suspended;
+    stopTimeout();
+}
+
 void NetworkDataTaskSoup::cancel()
 {
     if (m_state == State::Canceling || m_state == State::Completed)
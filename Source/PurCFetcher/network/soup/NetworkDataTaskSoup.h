@@ -50,6 +50,7 @@ private:
 
     void cancel() override;
     void resume() override;
+    void suspend() override;
     void invalidateAndCancel() override;
     NetworkDataTask::State state() const override;
 
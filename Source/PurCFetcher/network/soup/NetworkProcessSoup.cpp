@@ -137,6 +137,10 @@ void NetworkProcess::platformInitializeNetworkProcess(const NetworkProcessCreati
 
     setIgnoreTLSErrors(parameters.ignoreTLSErrors);
 
+    // Must be set before the default network session is created.
+    if (parameters.maxConnections)
+        SoupNetworkSession::setMaxConnections(std::min<uint64_t>(parameters.maxConnections, std::numeric_limits<unsigned>::max()));
+
     if (!parameters.hstsStorageDirectory.isEmpty())
         SoupNetworkSession::setHSTSPersistentStorage(parameters.hstsStorageDirectory.utf8());
     forEachNetworkSession([](const auto& session) {
@@ -97,9 +97,4 @@ void NetworkSessionSoup::clearCredentials()
 #endif
 }
 
-void NetworkSessionSoup::flushCache()
-{
-    m_networkSession->flushCache();
-}
-
 } // namespace PurCFetcher
@@ -52,8 +52,6 @@ public:
 
     void setCookiePersistentStorage(const String& storagePath, SoupCookiePersistentStorageType);
 
-    void flushCache();
-
 private:
     void clearCredentials() final;
 
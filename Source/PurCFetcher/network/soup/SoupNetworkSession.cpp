@@ -45,6 +45,7 @@
 namespace PurCFetcher {
 
 static bool gIgnoreTLSErrors;
+static unsigned gMaxConnections;
 
 static CString& initialAcceptLanguages()
 {
@@ -115,8 +116,6 @@ static AllowedCertificatesMap& allowedCertificates()
     return certificates;
 }
 
-#define CACHE_STORAGE_DIR  "/tmp/fetcher/cache"
-
 SoupNetworkSession::SoupNetworkSession(PAL::SessionID sessionID)
     : m_soupSession(adoptGRef(soup_session_new()))
     , m_sessionID(sessionID)
@@ -125,8 +124,12 @@ SoupNetworkSession::SoupNetworkSession(PAL::SessionID sessionID)
     // the rule "Do What Every Other Modern Browser Is Doing". They seem
     // to significantly improve page loading time compared to soup's
     // default values.
-    static const int maxConnections = 17;
-    static const int maxConnectionsPerHost = 6;
+    static const int defaultMaxConnections = 17;
+    static const int defaultMaxConnectionsPerHost = 6;
+
+    // The client may ask for another limit in pcfetcher_init().
+    int maxConnections = gMaxConnections ? std::min<unsigned>(gMaxConnections, G_MAXINT) : defaultMaxConnections;
+    int maxConnectionsPerHost = std::min(maxConnections, defaultMaxConnectionsPerHost);
 
     g_object_set(m_soupSession.get(),
         SOUP_SESSION_MAX_CONNS, maxConnections,
@@ -152,13 +155,9 @@ SoupNetworkSession::SoupNetworkSession(PAL::SessionID sessionID)
         setupProxy();
     setupLogger();
     setupHSTSEnforcer();
-    setupCache("/tmp/fetcher/cache");
 }
 
-SoupNetworkSession::~SoupNetworkSession()
-{
-    flushCache();
-}
+SoupNetworkSession::~SoupNetworkSession() = default;
 
 void SoupNetworkSession::setupLogger()
 {
@@ -266,12 +265,6 @@ void SoupNetworkSession::clearHSTSCache(WallTime modifiedSince)
 #endif
 }
 
-void SoupNetworkSession::flushCache()
-{
-    soup_cache_flush(m_soupCache.get());
-    soup_cache_dump(m_soupCache.get());
-}
-
 static inline bool stringIsNumeric(const char* str)
 {
     while (*str) {
@@ -328,6 +321,11 @@ void SoupNetworkSession::setAcceptLanguages(const CString& languages)
     g_object_set(m_soupSession.get(), "accept-language", languages.data(), nullptr);
 }
 
+void SoupNetworkSession::setMaxConnections(unsigned maxConnections)
+{
+    gMaxConnections = maxConnections;
+}
+
 void SoupNetworkSession::setShouldIgnoreTLSErrors(bool ignoreTLSErrors)
 {
     gIgnoreTLSErrors = ignoreTLSErrors;
@@ -353,18 +351,6 @@ void SoupNetworkSession::allowSpecificHTTPSCertificateForHost(const CertificateI
     allowedCertificates().add(host, HostTLSCertificateSet()).iterator->value.add(certificateInfo.certificate());
 }
 
-void SoupNetworkSession::setupCache(const char* path)
-{
-    if (!path) {
-        return;
-    }
-    m_soupCache = adoptGRef(soup_cache_new(path, SOUP_CACHE_SINGLE_USER));
-    soup_cache_set_max_size(m_soupCache.get(), G_MAXUINT);
-    soup_session_add_feature(m_soupSession.get(), SOUP_SESSION_FEATURE(m_soupCache.get()));
-    soup_cache_load(m_soupCache.get());
-}
-
-
 } // namespace PurCFetcher
 
 #endif
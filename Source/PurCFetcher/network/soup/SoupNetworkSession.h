@@ -34,7 +34,6 @@
 #include <wtf/glib/GRefPtr.h>
 #include <wtf/text/WTFString.h>
 
-typedef struct _SoupCache SoupCache;
 typedef struct _SoupCookieJar SoupCookieJar;
 typedef struct _SoupMessage SoupMessage;
 typedef struct _SoupRequest SoupRequest;
@@ -63,6 +62,8 @@ public:
     static void setProxySettings(const SoupNetworkProxySettings&);
     void setupProxy();
 
+    static void setMaxConnections(unsigned);
+
     static void setInitialAcceptLanguages(const CString&);
     void setAcceptLanguages(const CString&);
 
@@ -73,14 +74,11 @@ public:
     void getHostNamesWithHSTSCache(HashSet<String>&);
     void deleteHSTSCacheForHostNames(const Vector<String>&);
     void clearHSTSCache(WallTime);
-    void flushCache();
 
 private:
     void setupLogger();
-    void setupCache(const char* path);
 
     GRefPtr<SoupSession> m_soupSession;
-    GRefPtr<SoupCache> m_soupCache;
     PAL::SessionID m_sessionID;
 };
 
@@ -0,0 +1,72 @@
+/*
+ * @file fetcher-completion-queue.cpp
+ * @date 2026/10/18
+ * @brief The impl for the completion queue of the fetcher requests.
+ *
+ * Copyright (C) 2021 FMSoft <https://www.fmsoft.cn>
+ *
+ * This file is a part of PurC (short for Purring Cat), an HVML interpreter.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "config.h"
+
+#include "fetcher-completion-queue.h"
+
+#include <wtf/NeverDestroyed.h>
+#include <wtf/ThreadSpecific.h>
+#include <wtf/Vector.h>
+
+#if ENABLE(LINK_PURC_FETCHER)
+
+PcFetcherCompletionQueue& PcFetcherCompletionQueue::current()
+{
+    static NeverDestroyed<ThreadSpecific<RefPtr<PcFetcherCompletionQueue>>> queues;
+    RefPtr<PcFetcherCompletionQueue>& queue = *queues.get();
+    if (!queue)
+        queue = adoptRef(*new PcFetcherCompletionQueue);
+    return *queue;
+}
+
+void PcFetcherCompletionQueue::append(Function<void()>&& completion)
+{
+    auto locker = holdLock(m_lock);
+    m_completions.append(WTFMove(completion));
+    m_condition.notifyOne();
+}
+
+size_t PcFetcherCompletionQueue::dispatch(Seconds timeout, size_t maxCount)
+{
+    Vector<Function<void()>> batch;
+    {
+        auto locker = holdLock(m_lock);
+        if (m_completions.isEmpty() && timeout > 0_s) {
+            m_condition.waitFor(m_lock, timeout, [this] {
+                return !m_completions.isEmpty();
+            });
+        }
+
+        while (!m_completions.isEmpty() && batch.size() < maxCount)
+            batch.append(m_completions.takeFirst());
+    }
+
+    // Run the handlers without the lock: they may issue new requests.
+    for (auto& completion : batch)
+        completion();
+
+    return batch.size();
+}
+
+#endif // ENABLE(LINK_PURC_FETCHER)
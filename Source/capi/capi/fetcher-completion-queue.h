@@ -0,0 +1,63 @@
+/*
+ * @file fetcher-completion-queue.h
+ * @date 2026/10/18
+ * @brief The completion queue of the asynchronous fetcher requests.
+ *
+ * Copyright (C) 2021 FMSoft <https://www.fmsoft.cn>
+ *
+ * This file is a part of PurC (short for Purring Cat), an HVML interpreter.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef PURC_FETCHER_COMPLETION_QUEUE_H
+#define PURC_FETCHER_COMPLETION_QUEUE_H
+
+#if ENABLE(LINK_PURC_FETCHER)
+
+#include <wtf/Condition.h>
+#include <wtf/Deque.h>
+#include <wtf/Function.h>
+#include <wtf/Lock.h>
+#include <wtf/Seconds.h>
+#include <wtf/ThreadSafeRefCounted.h>
+
+// Every thread issuing async requests owns one completion queue. The IPC
+// receive queue appends the finished requests to it, and the thread runs
+// the response handlers itself from pcfetcher_check_response().
+class PcFetcherCompletionQueue
+    : public ThreadSafeRefCounted<PcFetcherCompletionQueue> {
+    WTF_MAKE_NONCOPYABLE(PcFetcherCompletionQueue);
+
+public:
+    // The queue of the calling thread, created on first use.
+    static PcFetcherCompletionQueue& current();
+
+    void append(Function<void()>&& completion);
+
+    // Run at most maxCount queued completions, waiting up to timeout for
+    // the first one to arrive. Returns the number of completions run.
+    size_t dispatch(Seconds timeout, size_t maxCount);
+
+private:
+    PcFetcherCompletionQueue() = default;
+
+    Lock m_lock;
+    Condition m_condition;
+    Deque<Function<void()>> m_completions;
+};
+
+#endif // ENABLE(LINK_PURC_FETCHER)
+
+#endif /* not defined PURC_FETCHER_COMPLETION_QUEUE_H */
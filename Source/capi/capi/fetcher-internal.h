@@ -69,6 +69,15 @@ typedef purc_rwstream_t (*pcfetcher_request_sync_fn)(
         uint32_t timeout,
         struct pcfetcher_resp_header *resp_header);
 
+typedef purc_variant_t (*pcfetcher_request_stream_fn)(
+        struct pcfetcher* fetcher,
+        const char* url,
+        enum pcfetcher_request_method method,
+        purc_variant_t params,
+        uint32_t timeout,
+        response_chunk_handler handler,
+        void* ctxt);
+
 typedef int (*pcfetcher_check_response_fn)(struct pcfetcher* fetcher,
         uint32_t timeout_ms);
 
@@ -84,6 +93,7 @@ struct pcfetcher {
     pcfetcher_cookie_remove_fn cookie_remove;
     pcfetcher_request_async_fn request_async;
     pcfetcher_request_sync_fn request_sync;
+    pcfetcher_request_stream_fn request_stream;
     pcfetcher_check_response_fn check_response;
 };
 
@@ -122,6 +132,15 @@ purc_rwstream_t pcfetcher_local_request_sync(
         uint32_t timeout,
         struct pcfetcher_resp_header *resp_header);
 
+purc_variant_t pcfetcher_local_request_stream(
+        struct pcfetcher* fetcher,
+        const char* url,
+        enum pcfetcher_request_method method,
+        purc_variant_t params,
+        uint32_t timeout,
+        response_chunk_handler handler,
+        void* ctxt);
+
 int pcfetcher_local_check_response(struct pcfetcher* fetcher,
         uint32_t timeout_ms);
 
@@ -131,6 +150,10 @@ struct pcfetcher* pcfetcher_remote_init(size_t max_conns, size_t cache_quota);
 
 int pcfetcher_remote_term(struct pcfetcher* fetcher);
 
+int pcfetcher_remote_prespawn(size_t max_conns, size_t cache_quota);
+
+void pcfetcher_remote_drop_prespawned(void);
+
 const char* pcfetcher_remote_set_base_url(struct pcfetcher* fetcher,
         const char* base_url);
 
@@ -163,6 +186,15 @@ purc_rwstream_t pcfetcher_remote_request_sync(
         uint32_t timeout,
         struct pcfetcher_resp_header *resp_header);
 
+purc_variant_t pcfetcher_remote_request_stream(
+        struct pcfetcher* fetcher,
+        const char* url,
+        enum pcfetcher_request_method method,
+        purc_variant_t params,
+        uint32_t timeout,
+        response_chunk_handler handler,
+        void* ctxt);
+
 int pcfetcher_remote_check_response(struct pcfetcher* fetcher,
         uint32_t timeout_ms);
 
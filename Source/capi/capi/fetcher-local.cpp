@@ -37,7 +37,7 @@ struct pcfetcher* pcfetcher_local_init(size_t max_conns, size_t cache_quota)
             sizeof(struct pcfetcher));
 
     fetcher->max_conns = max_conns;
-    fetcher->cache_quota;
+    fetcher->cache_quota = cache_quota;
     fetcher->init = pcfetcher_local_init;
     fetcher->term = pcfetcher_local_term;
     fetcher->set_base_url = pcfetcher_local_set_base_url;
@@ -46,6 +46,7 @@ struct pcfetcher* pcfetcher_local_init(size_t max_conns, size_t cache_quota)
     fetcher->cookie_remove = pcfetcher_cookie_loccal_remove;
     fetcher->request_async = pcfetcher_local_request_async;
     fetcher->request_sync = pcfetcher_local_request_sync;
+    fetcher->request_stream = pcfetcher_local_request_stream;
     fetcher->check_response = pcfetcher_local_check_response;
 
     return fetcher;
@@ -139,6 +140,25 @@ purc_rwstream_t pcfetcher_local_request_sync(
 }
 
 
+purc_variant_t pcfetcher_local_request_stream(
+        struct pcfetcher* fetcher,
+        const char* url,
+        enum pcfetcher_request_method method,
+        purc_variant_t params,
+        uint32_t timeout,
+        response_chunk_handler handler,
+        void* ctxt)
+{
+    UNUSED_PARAM(fetcher);
+    UNUSED_PARAM(url);
+    UNUSED_PARAM(method);
+    UNUSED_PARAM(params);
+    UNUSED_PARAM(timeout);
+    UNUSED_PARAM(handler);
+    UNUSED_PARAM(ctxt);
+    return PURC_VARIANT_INVALID;
+}
+
 int pcfetcher_local_check_response(struct pcfetcher* fetcher,
         uint32_t timeout_ms)
 {
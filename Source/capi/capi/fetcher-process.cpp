@@ -25,23 +25,44 @@
 #include "config.h"
 
 #include "fetcher-process.h"
+#include "fetcher-completion-queue.h"
 #include "fetcher-messages.h"
 
 #include "NetworkProcessCreationParameters.h"
 
 #include <wtf/RunLoop.h>
 
+#define DEF_MAX_SESSIONS 4
+#define DEF_MAX_CHECK_RESPONSES 64
+
+// Where the fetcher keeps its disk cache unless PURC_FETCHER_CACHE_DIR
+// tells otherwise.
+#define DEF_FETCHER_CACHE_DIR "/tmp/fetcher/cache"
+#define PURC_ENVV_FETCHER_CACHE_DIR "PURC_FETCHER_CACHE_DIR"
+#define PURC_ENVV_FETCHER_CACHE_EVICTION "PURC_FETCHER_CACHE_EVICTION"
+
 using namespace PurCFetcher;
 
 PcFetcherProcess::PcFetcherProcess(struct pcfetcher* fetcher,
         bool alwaysRunsAtBackgroundPriority)
  : m_fetcher(fetcher)
  , m_alwaysRunsAtBackgroundPriority(alwaysRunsAtBackgroundPriority)
+ , m_maxSessions(fetcher && fetcher->max_conns ?
+         std::min<size_t>(fetcher->max_conns, DEF_MAX_SESSIONS) :
+         DEF_MAX_SESSIONS)
 {
 }
 
 PcFetcherProcess::~PcFetcherProcess()
 {
+    {
+        auto locker = holdLock(m_sessionsLock);
+        for (auto* session : std::exchange(m_sessions, { })) {
+            session->close();
+            delete session;
+        }
+    }
+
     if (m_connection)
         m_connection->invalidate();
 
@@ -90,6 +111,23 @@ void PcFetcherProcess::terminate()
 void PcFetcherProcess::initFetcherProcess()
 {
     NetworkProcessCreationParameters parameters;
+    if (m_fetcher) {
+        parameters.maxConnections = m_fetcher->max_conns;
+        parameters.cacheQuota = m_fetcher->cache_quota;
+    }
+
+    // The disk cache of the DocumentViewer model, the default, is empty;
+    // without a quota the cache would be off.
+    parameters.cacheModel = CacheModel::PrimaryWebBrowser;
+
+    const char* cacheDirectory = getenv(PURC_ENVV_FETCHER_CACHE_DIR);
+    if (!cacheDirectory || !cacheDirectory[0])
+        cacheDirectory = DEF_FETCHER_CACHE_DIR;
+    parameters.defaultDataStoreParameters.networkSessionParameters
+        .networkCacheDirectory = String::fromUTF8(cacheDirectory);
+
+    if (const char* evictionPolicy = getenv(PURC_ENVV_FETCHER_CACHE_EVICTION))
+        parameters.cacheEvictionPolicy = String::fromUTF8(evictionPolicy);
     send(Messages::NetworkProcess::InitializeNetworkProcess(parameters), 0);
 }
 
@@ -246,10 +284,61 @@ PcFetcherSession* PcFetcherProcess::createSession(void)
         Messages::NetworkProcess::CreateNetworkConnectionToWebProcess { pid, sid },
         Messages::NetworkProcess::CreateNetworkConnectionToWebProcess::Reply(
             attachment, cookieAcceptPolicy), 0);
+    if (!attachment)
+        return nullptr;
+
     return new PcFetcherSession(sid.toUInt64(),
             attachment->releaseFileDescriptor());
 }
 
+PcFetcherSession* PcFetcherProcess::leastLoadedSession(size_t& inflight) const
+{
+    PcFetcherSession* leastLoaded = nullptr;
+    inflight = 0;
+    for (auto* session : m_sessions) {
+        size_t sessionInflight = session->inflightRequests();
+        if (!leastLoaded || sessionInflight < inflight) {
+            leastLoaded = session;
+            inflight = sessionInflight;
+        }
+    }
+    return leastLoaded;
+}
+
+PcFetcherSession* PcFetcherProcess::acquireSession(void)
+{
+    {
+        auto locker = holdLock(m_sessionsLock);
+        for (;;) {
+            size_t leastInflight;
+            PcFetcherSession* leastLoaded = leastLoadedSession(leastInflight);
+            size_t poolSize = m_sessions.size() + m_creatingSessions;
+            if (leastLoaded && (!leastInflight || poolSize >= m_maxSessions))
+                return leastLoaded;
+            if (poolSize < m_maxSessions)
+                break;
+            // Every slot is reserved by a session still being created.
+            m_sessionsCondition.wait(m_sessionsLock);
+        }
+        ++m_creatingSessions;
+    }
+
+    // Creating a session is a sync round trip to the fetcher process; the
+    // other threads keep using the pool meanwhile.
+    PcFetcherSession* session = createSession();
+
+    auto locker = holdLock(m_sessionsLock);
+    --m_creatingSessions;
+    m_sessionsCondition.notifyAll();
+    if (!session) {
+        size_t leastInflight;
+        return leastLoadedSession(leastInflight);
+    }
+
+    m_sessions.append(session);
+    return session;
+}
+
 purc_variant_t PcFetcherProcess::requestAsync(
         const char* url,
         enum pcfetcher_request_method method,
@@ -258,7 +347,10 @@ purc_variant_t PcFetcherProcess::requestAsync(
         response_handler handler,
         void* ctxt)
 {
-    PcFetcherSession* session = createSession();
+    PcFetcherSession* session = acquireSession();
+    if (!session)
+        return PURC_VARIANT_INVALID;
+
     return session->requestAsync(url, method, params, timeout, handler, ctxt);
 }
 
@@ -269,14 +361,33 @@ purc_rwstream_t PcFetcherProcess::requestSync(
         uint32_t timeout,
         struct pcfetcher_resp_header *resp_header)
 {
-    PcFetcherSession* session = createSession();
+    PcFetcherSession* session = acquireSession();
+    if (!session)
+        return NULL;
+
     return session->requestSync(url, method, params, timeout, resp_header);
 }
 
+purc_variant_t PcFetcherProcess::requestStream(
+        const char* url,
+        enum pcfetcher_request_method method,
+        purc_variant_t params,
+        uint32_t timeout,
+        response_chunk_handler handler,
+        void* ctxt)
+{
+    PcFetcherSession* session = acquireSession();
+    if (!session)
+        return PURC_VARIANT_INVALID;
+
+    return session->requestStream(url, method, params, timeout, handler, ctxt);
+}
+
 int PcFetcherProcess::checkResponse(uint32_t timeout_ms)
 {
-    UNUSED_PARAM(timeout_ms);
-    return 0;
+    size_t count = PcFetcherCompletionQueue::current().dispatch(
+            Seconds::fromMilliseconds(timeout_ms), DEF_MAX_CHECK_RESPONSES);
+    return (int)count;
 }
 
 void PcFetcherProcess::didClose(IPC::Connection&)
@@ -33,6 +33,8 @@
 #include "Connection.h"
 #include "ProcessLauncher.h"
 
+#include <wtf/Condition.h>
+#include <wtf/Lock.h>
 #include <wtf/ProcessID.h>
 #include <wtf/SystemTracing.h>
 #include <wtf/ThreadSafeRefCounted.h>
@@ -104,6 +106,11 @@ public:
 
     PcFetcherSession* createSession(void);
 
+    // Pick the least loaded session of the pool. A new session is only
+    // created when every session has requests in flight and the pool is
+    // not full yet; it is created without holding the pool lock.
+    PcFetcherSession* acquireSession(void);
+
     purc_variant_t requestAsync(
         const char* url,
         enum pcfetcher_request_method method,
@@ -119,6 +126,14 @@ public:
         uint32_t timeout,
         struct pcfetcher_resp_header *resp_header);
 
+    purc_variant_t requestStream(
+        const char* url,
+        enum pcfetcher_request_method method,
+        purc_variant_t params,
+        uint32_t timeout,
+        response_chunk_handler handler,
+        void* ctxt);
+
     int checkResponse(uint32_t timeout_ms);
 
 protected:
@@ -152,6 +167,15 @@ private:
     RefPtr<IPC::Connection> m_connection;
     bool m_alwaysRunsAtBackgroundPriority { false };
     PurCFetcher::ProcessIdentifier m_processIdentifier { PurCFetcher::ProcessIdentifier::generate() };
+
+    PcFetcherSession* leastLoadedSession(size_t& inflight) const;
+
+    Lock m_sessionsLock;
+    Condition m_sessionsCondition;
+    size_t m_maxSessions;
+    // Slots of the pool reserved by sessions still being created.
+    size_t m_creatingSessions { 0 };
+    Vector<PcFetcherSession*> m_sessions;
 };
 
 template<typename T>
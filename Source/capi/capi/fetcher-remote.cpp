@@ -37,7 +37,12 @@ struct pcfetcher_remote {
     PcFetcherProcess* process;
 };
 
-struct pcfetcher* pcfetcher_remote_init(size_t max_conns, size_t cache_quota)
+// The fetcher launched by pcfetcher_remote_prespawn(), waiting for
+// pcfetcher_remote_init() to take it over.
+static struct pcfetcher_remote* s_prespawned;
+
+static struct pcfetcher_remote* pcfetcher_remote_create(size_t max_conns,
+        size_t cache_quota)
 {
     struct pcfetcher_remote* remote = (struct pcfetcher_remote*)malloc(
             sizeof(struct pcfetcher_remote));
@@ -53,14 +58,52 @@ struct pcfetcher* pcfetcher_remote_init(size_t max_conns, size_t cache_quota)
     fetcher->cookie_remove = pcfetcher_cookie_remote_remove;
     fetcher->request_async = pcfetcher_remote_request_async;
     fetcher->request_sync = pcfetcher_remote_request_sync;
+    fetcher->request_stream = pcfetcher_remote_request_stream;
     fetcher->check_response = pcfetcher_remote_check_response;
 
     remote->process = new PcFetcherProcess(fetcher);
+    // the process starts and handles InitializeNetworkProcess while the
+    // caller goes on
     remote->process->connect();
 
+    return remote;
+}
+
+struct pcfetcher* pcfetcher_remote_init(size_t max_conns, size_t cache_quota)
+{
+    struct pcfetcher_remote* remote = std::exchange(s_prespawned, nullptr);
+    if (remote && (remote->base.max_conns != max_conns
+                || remote->base.cache_quota != cache_quota)) {
+        pcfetcher_remote_term((struct pcfetcher*)remote);
+        remote = NULL;
+    }
+
+    if (!remote) {
+        remote = pcfetcher_remote_create(max_conns, cache_quota);
+    }
     return (struct pcfetcher*)remote;
 }
 
+int pcfetcher_remote_prespawn(size_t max_conns, size_t cache_quota)
+{
+    if (s_prespawned && s_prespawned->base.max_conns == max_conns
+            && s_prespawned->base.cache_quota == cache_quota) {
+        return 0;
+    }
+
+    pcfetcher_remote_drop_prespawned();
+    s_prespawned = pcfetcher_remote_create(max_conns, cache_quota);
+    return 0;
+}
+
+void pcfetcher_remote_drop_prespawned(void)
+{
+    struct pcfetcher_remote* remote = std::exchange(s_prespawned, nullptr);
+    if (remote) {
+        pcfetcher_remote_term((struct pcfetcher*)remote);
+    }
+}
+
 int pcfetcher_remote_term(struct pcfetcher* fetcher)
 {
     struct pcfetcher_remote* remote = (struct pcfetcher_remote*)fetcher;
@@ -146,6 +189,20 @@ purc_rwstream_t pcfetcher_remote_request_sync(
 }
 
 
+purc_variant_t pcfetcher_remote_request_stream(
+        struct pcfetcher* fetcher,
+        const char* url,
+        enum pcfetcher_request_method method,
+        purc_variant_t params,
+        uint32_t timeout,
+        response_chunk_handler handler,
+        void* ctxt)
+{
+    struct pcfetcher_remote* remote = (struct pcfetcher_remote*)fetcher;
+    return remote->process->requestStream(
+            url, method, params, timeout, handler, ctxt);
+}
+
 int pcfetcher_remote_check_response(struct pcfetcher* fetcher,
         uint32_t timeout_ms)
 {
@@ -0,0 +1,301 @@
+/*
+ * @file fetcher-request.cpp
+ * @date 2026/10/18
+ * @brief The impl for fetcher request.
+ *
+ * Copyright (C) 2021 FMSoft <https://www.fmsoft.cn>
+ *
+ * This file is a part of PurC (short for Purring Cat), an HVML interpreter.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "config.h"
+
+#include "fetcher-request.h"
+#include "fetcher-session.h"
+#include "fetcher-messages.h"
+
+#include "ResourceError.h"
+#include "ResourceResponse.h"
+
+#define DEF_RWS_SIZE 1024
+
+// Flow control of a streamed body, in bytes queued for the handler.
+#define DEF_STREAM_HIGH_WATER   (1024 * 1024)
+#define DEF_STREAM_LOW_WATER    (256 * 1024)
+
+using namespace PurCFetcher;
+
+PcFetcherRequest::PcFetcherRequest(PcFetcherSession* session, uint64_t reqId,
+        bool isAsync, response_handler handler,
+        response_chunk_handler chunkHandler, void* ctxt)
+    : m_connection(session->connection())
+    , m_req_id(reqId)
+    , m_is_async(isAsync)
+    , m_finished(false)
+    , m_req_handler(handler)
+    , m_chunk_handler(chunkHandler)
+    , m_req_ctxt(ctxt)
+    , m_pending_bytes(0)
+    , m_defers_loading(false)
+    , m_resp_rwstream(NULL)
+    , m_req_vid(PURC_VARIANT_INVALID)
+{
+    memset(&m_resp_header, 0, sizeof(m_resp_header));
+    if (m_is_async) {
+        m_req_vid = purc_variant_make_ulongint(m_req_id);
+        // the handler runs on the thread issuing the request
+        m_completionQueue = &PcFetcherCompletionQueue::current();
+    }
+}
+
+PcFetcherRequest::~PcFetcherRequest()
+{
+    if (m_resp_header.mime_type) {
+        free(m_resp_header.mime_type);
+    }
+    if (m_resp_rwstream) {
+        purc_rwstream_destroy(m_resp_rwstream);
+    }
+}
+
+bool PcFetcherRequest::wait(uint32_t timeout)
+{
+    return m_waitForSyncReplySemaphore.waitFor(Seconds(timeout));
+}
+
+void PcFetcherRequest::wakeUp(void)
+{
+    m_waitForSyncReplySemaphore.signal();
+}
+
+purc_rwstream_t PcFetcherRequest::takeResponse(
+        struct pcfetcher_resp_header *resp_header)
+{
+    if (resp_header) {
+        resp_header->ret_code = m_resp_header.ret_code;
+        if (m_resp_header.mime_type) {
+            resp_header->mime_type = strdup(m_resp_header.mime_type);
+        }
+        resp_header->sz_resp = m_resp_header.sz_resp;
+    }
+
+    // the caller owns the stream from now on
+    return std::exchange(m_resp_rwstream, nullptr);
+}
+
+void PcFetcherRequest::didReceiveResponse(
+        const PurCFetcher::ResourceResponse& response,
+        bool needsContinueDidReceiveResponseMessage)
+{
+    UNUSED_PARAM(needsContinueDidReceiveResponseMessage);
+    m_resp_header.ret_code = response.httpStatusCode();
+    if (m_resp_header.mime_type) {
+        free(m_resp_header.mime_type);
+    }
+    const CString &utf8 = response.mimeType().utf8();
+    m_resp_header.mime_type = strdup((const char*)utf8.data());
+    m_resp_header.sz_resp = response.expectedContentLength();
+    if (m_resp_rwstream) {
+        purc_rwstream_destroy(m_resp_rwstream);
+    }
+    if (isStreaming()) {
+        m_resp_rwstream = NULL;
+        return;
+    }
+    size_t init = m_resp_header.sz_resp ? m_resp_header.sz_resp : DEF_RWS_SIZE;
+    m_resp_rwstream = purc_rwstream_new_buffer(init, INT_MAX);
+}
+
+void PcFetcherRequest::didReceiveSharedBuffer(
+        IPC::SharedBufferDataReference&& data, int64_t encodedDataLength)
+{
+    UNUSED_PARAM(encodedDataLength);
+    if (isStreaming()) {
+        size_t size = data.size();
+        if (!size)
+            return;
+
+        Vector<char> chunk(data.data(), size);
+        willDispatchChunk(size);
+        m_completionQueue->append([protectedThis = makeRef(*this),
+                chunk = WTFMove(chunk)] {
+            protectedThis->callChunkHandler(
+                    chunk.data(), chunk.size());
+            protectedThis->didDispatchChunk(chunk.size());
+        });
+        return;
+    }
+
+    if (m_resp_rwstream) {
+        purc_rwstream_write(m_resp_rwstream, data.data(), data.size());
+    }
+}
+
+void PcFetcherRequest::didReceiveSharedMemory(
+        const SharedMemory::Handle& body, uint64_t bodySize)
+{
+    if (isStreaming())
+        return;
+
+    // The fetcher wrote the body into this memory as it arrived; copy it
+    // into the buffer stream at once instead of chunk by chunk.
+    auto memory = SharedMemory::map(body, SharedMemory::Protection::ReadOnly);
+    if (!memory) {
+        // fail rather than complete with the body missing; the finish
+        // message that follows is ignored
+        m_resp_header.ret_code = 500;
+        m_resp_header.sz_resp = 0;
+        if (m_resp_rwstream) {
+            purc_rwstream_destroy(m_resp_rwstream);
+            m_resp_rwstream = NULL;
+        }
+        finish();
+        return;
+    }
+    if (bodySize > memory->size())
+        bodySize = memory->size();
+
+    size_t sz_content = 0;
+    size_t sz_buffer = 0;
+    if (m_resp_rwstream) {
+        purc_rwstream_get_mem_buffer_ex(m_resp_rwstream, &sz_content,
+                &sz_buffer, false);
+    }
+    // size the stream for the body rather than growing it
+    if (!m_resp_rwstream || (!sz_content && sz_buffer < bodySize)) {
+        if (m_resp_rwstream) {
+            purc_rwstream_destroy(m_resp_rwstream);
+        }
+        m_resp_rwstream = purc_rwstream_new_buffer(
+                bodySize ? bodySize : DEF_RWS_SIZE, INT_MAX);
+    }
+    if (m_resp_rwstream) {
+        purc_rwstream_write(m_resp_rwstream, memory->data(), bodySize);
+    }
+}
+
+void PcFetcherRequest::setDefersLoading(bool defers)
+{
+    m_connection->send(
+            Messages::NetworkResourceLoader::SetDefersLoading(defers),
+            m_req_id);
+}
+
+void PcFetcherRequest::willDispatchChunk(size_t size)
+{
+    bool defers = false;
+    {
+        auto locker = holdLock(m_flowLock);
+        m_pending_bytes += size;
+        if (!m_defers_loading && m_pending_bytes > DEF_STREAM_HIGH_WATER) {
+            m_defers_loading = true;
+            defers = true;
+        }
+    }
+    if (defers)
+        setDefersLoading(true);
+}
+
+void PcFetcherRequest::didDispatchChunk(size_t size)
+{
+    bool resumes = false;
+    {
+        auto locker = holdLock(m_flowLock);
+        m_pending_bytes -= size;
+        if (m_defers_loading && m_pending_bytes <= DEF_STREAM_LOW_WATER) {
+            m_defers_loading = false;
+            resumes = !m_finished.load();
+        }
+    }
+    if (resumes)
+        setDefersLoading(false);
+}
+
+void PcFetcherRequest::callChunkHandler(const char* chunk, size_t size)
+{
+    if (m_chunk_handler)
+        m_chunk_handler(m_req_vid, m_req_ctxt, &m_resp_header, chunk, size);
+}
+
+void PcFetcherRequest::finish(void)
+{
+    if (m_finished.exchange(true))
+        return;
+
+    if (!m_is_async) {
+        wakeUp();
+        return;
+    }
+
+    m_completionQueue->append([protectedThis = makeRef(*this)] {
+        if (protectedThis->isStreaming())
+            protectedThis->callChunkHandler(NULL, 0);
+        else
+            protectedThis->callResponseHandler();
+    });
+}
+
+void PcFetcherRequest::callResponseHandler(void)
+{
+    if (m_req_handler) {
+        if (!m_resp_header.sz_resp && m_resp_rwstream) {
+            size_t sz_content = 0;
+            size_t sz_buffer = 0;
+            purc_rwstream_get_mem_buffer_ex(m_resp_rwstream, &sz_content,
+                    &sz_buffer, false);
+            m_resp_header.sz_resp = sz_content;
+        }
+        if (m_resp_rwstream) {
+            purc_rwstream_seek(m_resp_rwstream, 0, SEEK_SET);
+        }
+        // the handler owns the stream from now on
+        m_req_handler(m_req_vid, m_req_ctxt,
+                &m_resp_header, std::exchange(m_resp_rwstream, nullptr));
+    }
+}
+
+void PcFetcherRequest::didFinishResourceLoad(
+        const NetworkLoadMetrics& networkLoadMetrics)
+{
+    UNUSED_PARAM(networkLoadMetrics);
+    finish();
+}
+
+void PcFetcherRequest::didFailResourceLoad(const ResourceError& error)
+{
+    UNUSED_PARAM(error);
+    // TODO : trans error code
+    m_resp_header.ret_code = 408;
+    finish();
+}
+
+void PcFetcherRequest::didCloseSession(void)
+{
+    // e.g. the fetcher process crashed
+    m_resp_header.ret_code = 503;
+    finish();
+}
+
+void PcFetcherRequest::willSendRequest(ResourceRequest&& proposedRequest,
+        IPC::FormDataReference&& proposedRequestBody,
+        ResourceResponse&& redirectResponse)
+{
+    UNUSED_PARAM(redirectResponse);
+    proposedRequest.setHTTPBody(proposedRequestBody.takeData());
+    m_connection->send(
+            Messages::NetworkResourceLoader::ContinueWillSendRequest(
+                proposedRequest, true), m_req_id);
+}
@@ -0,0 +1,141 @@
+/*
+ * @file fetcher-request.h
+ * @date 2026/10/18
+ * @brief The fetcher request class.
+ *
+ * Copyright (C) 2021 FMSoft <https://www.fmsoft.cn>
+ *
+ * This file is a part of PurC (short for Purring Cat), an HVML interpreter.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef PURC_FETCHER_REQUEST_H
+#define PURC_FETCHER_REQUEST_H
+
+#if ENABLE(LINK_PURC_FETCHER)
+
+#include "fetcher-internal.h"
+#include "fetcher-completion-queue.h"
+#include "fetcher-messages-basic.h"
+
+#include "WebCoreArgumentCoders.h"
+#include "SharedBufferDataReference.h"
+#include "FormDataReference.h"
+#include "Connection.h"
+
+#include <atomic>
+
+#include <wtf/Lock.h>
+#include <wtf/ThreadSafeRefCounted.h>
+#include <wtf/Vector.h>
+#include <wtf/threads/BinarySemaphore.h>
+
+using namespace PurCFetcher;
+
+class PcFetcherSession;
+
+// The state of one in-flight load on a PcFetcherSession. The session
+// routes the WebResourceLoader messages to the request whose identifier
+// matches the destination ID of the message.
+class PcFetcherRequest : public ThreadSafeRefCounted<PcFetcherRequest> {
+    WTF_MAKE_NONCOPYABLE(PcFetcherRequest);
+
+public:
+    static Ref<PcFetcherRequest> create(PcFetcherSession* session,
+            uint64_t reqId, bool isAsync, response_handler handler,
+            void* ctxt)
+    {
+        return adoptRef(*new PcFetcherRequest(session, reqId, isAsync,
+                    handler, NULL, ctxt));
+    }
+
+    // An async request delivering the body chunk by chunk.
+    static Ref<PcFetcherRequest> createStreaming(PcFetcherSession* session,
+            uint64_t reqId, response_chunk_handler handler, void* ctxt)
+    {
+        return adoptRef(*new PcFetcherRequest(session, reqId, true,
+                    NULL, handler, ctxt));
+    }
+
+    ~PcFetcherRequest();
+
+    uint64_t requestId() const { return m_req_id; }
+    bool isAsync() const { return m_is_async; }
+    bool isFinished() const { return m_finished.load(); }
+    bool isStreaming() const { return !!m_chunk_handler; }
+
+    purc_variant_t requestVariant() const { return m_req_vid; }
+
+    bool wait(uint32_t timeout);
+    void wakeUp(void);
+
+    // Move the response out of a finished sync request.
+    purc_rwstream_t takeResponse(struct pcfetcher_resp_header *resp_header);
+
+    void didReceiveResponse(const PurCFetcher::ResourceResponse&, bool);
+    void didReceiveSharedBuffer(IPC::SharedBufferDataReference&&,
+            int64_t encodedDataLength);
+    void didReceiveSharedMemory(const SharedMemory::Handle& body,
+            uint64_t bodySize);
+    void didFinishResourceLoad(const PurCFetcher::NetworkLoadMetrics&);
+    void didFailResourceLoad(const ResourceError& error);
+    // The connection of the session is gone; fail the request.
+    void didCloseSession(void);
+    void willSendRequest(ResourceRequest&&,
+            IPC::FormDataReference&& requestBody, ResourceResponse&&);
+
+private:
+    PcFetcherRequest(PcFetcherSession* session, uint64_t reqId,
+            bool isAsync, response_handler handler,
+            response_chunk_handler chunkHandler, void* ctxt);
+
+    void finish(void);
+    void callResponseHandler(void);
+    void callChunkHandler(const char* chunk, size_t size);
+    void setDefersLoading(bool defers);
+
+    void willDispatchChunk(size_t size);
+    void didDispatchChunk(size_t size);
+
+    // The connection rather than the session: handlers still queued may
+    // run after the session is deleted, and sending on a closed
+    // connection does nothing.
+    RefPtr<IPC::Connection> m_connection;
+    uint64_t m_req_id;
+    bool m_is_async;
+    // Set on the IPC thread, read on the requesting and handler threads.
+    std::atomic<bool> m_finished;
+
+    BinarySemaphore m_waitForSyncReplySemaphore;
+    struct pcfetcher_resp_header m_resp_header;
+
+    response_handler m_req_handler;
+    response_chunk_handler m_chunk_handler;
+    void* m_req_ctxt;
+    RefPtr<PcFetcherCompletionQueue> m_completionQueue;
+
+    // Bytes of a streamed body waiting for the handler; the load is
+    // deferred while this is above the high-water mark.
+    Lock m_flowLock;
+    size_t m_pending_bytes;
+    bool m_defers_loading;
+
+    purc_rwstream_t m_resp_rwstream;
+    purc_variant_t m_req_vid;
+};
+
+#endif // ENABLE(LINK_PURC_FETCHER)
+
+#endif /* not defined PURC_FETCHER_REQUEST_H */
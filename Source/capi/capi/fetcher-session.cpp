@@ -33,21 +33,13 @@
 
 #include <wtf/RunLoop.h>
 
-#define DEF_RWS_SIZE 1024
-
 using namespace PurCFetcher;
 
 PcFetcherSession::PcFetcherSession(uint64_t sessionId,
         IPC::Connection::Identifier identifier)
     : m_sessionId(sessionId)
-    , m_req_id(0)
-    , m_is_async(false)
     , m_connection(IPC::Connection::createClientConnection(identifier, *this))
-    , m_req_handler(NULL)
-    , m_req_ctxt(NULL)
-    , m_resp_rwstream(NULL)
 {
-    memset(&m_resp_header, 0, sizeof(m_resp_header));
     m_connection->open();
 }
 
@@ -58,6 +50,20 @@ PcFetcherSession::~PcFetcherSession()
 void PcFetcherSession::close()
 {
     m_connection->invalidate();
+    failPendingRequests();
+}
+
+void PcFetcherSession::failPendingRequests()
+{
+    HashMap<uint64_t, RefPtr<PcFetcherRequest>> requests;
+    {
+        auto locker = holdLock(m_requestsLock);
+        requests = std::exchange(m_requests, { });
+    }
+
+    // outside the lock: a sync caller woken up removes its request
+    for (auto& req : requests.values())
+        req->didCloseSession();
 }
 
 static const char* transMethod(enum pcfetcher_request_method method)
@@ -78,100 +84,135 @@ static const char* transMethod(enum pcfetcher_request_method method)
     }
 }
 
-purc_variant_t PcFetcherSession::requestAsync(
-        const char* url,
-        enum pcfetcher_request_method method,
-        purc_variant_t params,
-        uint32_t timeout,
-        response_handler handler,
-        void* ctxt)
+uint64_t PcFetcherSession::generateRequestId(void)
 {
-    // TODO send params with http request
-    UNUSED_PARAM(params);
-
-    m_req_handler = handler;
-    m_req_ctxt = ctxt;
-    m_is_async = true;
+    return ProcessIdentifier::generate().toUInt64();
+}
 
+Ref<PcFetcherRequest> PcFetcherSession::scheduleLoad(const char* url,
+        enum pcfetcher_request_method method, uint32_t timeout,
+        Ref<PcFetcherRequest>&& req)
+{
     std::unique_ptr<WTF::URL> wurl = makeUnique<URL>(URL(), url);;
     ResourceRequest request;
     request.setURL(*wurl);
     request.setHTTPMethod(transMethod(method));
     request.setTimeoutInterval(timeout);
 
-    m_req_id = ProcessIdentifier::generate().toUInt64();
+    uint64_t reqId = req->requestId();
+    {
+        // register before sending: the response may arrive at any time
+        auto locker = holdLock(m_requestsLock);
+        m_requests.set(reqId, req.copyRef());
+    }
+
     NetworkResourceLoadParameters loadParameters;
-    loadParameters.identifier = m_req_id;
+    loadParameters.identifier = reqId;
     loadParameters.request = request;
     loadParameters.webPageProxyID = WebPageProxyIdentifier::generate();
     loadParameters.webPageID = PageIdentifier::generate();
     loadParameters.webFrameID = FrameIdentifier::generate();
     loadParameters.parentPID = getpid();
+    // a buffered body arrives in one piece the client stream can read
+    // directly; a streamed one keeps coming chunk by chunk
+    loadParameters.shouldSendBodyAsSharedMemory = !req->isStreaming();
 
-    m_connection->send(
+    if (!m_connection->send(
             Messages::NetworkConnectionToWebProcess::ScheduleResourceLoad(
-                loadParameters), 0);
+                loadParameters), 0)) {
+        // the connection is closed; no response will ever come
+        removeRequest(reqId);
+        req->didCloseSession();
+    }
 
-    m_req_vid = purc_variant_make_ulongint(m_req_id);
-    return m_req_vid;
+    return WTFMove(req);
 }
 
-purc_rwstream_t PcFetcherSession::requestSync(
+purc_variant_t PcFetcherSession::requestAsync(
         const char* url,
         enum pcfetcher_request_method method,
         purc_variant_t params,
         uint32_t timeout,
-        struct pcfetcher_resp_header *resp_header)
+        response_handler handler,
+        void* ctxt)
 {
     // TODO send params with http request
     UNUSED_PARAM(params);
 
-    m_is_async = false;
+    auto req = scheduleLoad(url, method, timeout,
+            PcFetcherRequest::create(this, generateRequestId(), true,
+                handler, ctxt));
+    return req->requestVariant();
+}
 
-    std::unique_ptr<WTF::URL> wurl = makeUnique<URL>(URL(), url);;
-    ResourceRequest request;
-    request.setURL(*wurl);
-    request.setHTTPMethod(transMethod(method));
-    request.setTimeoutInterval(timeout);
+purc_variant_t PcFetcherSession::requestStream(
+        const char* url,
+        enum pcfetcher_request_method method,
+        purc_variant_t params,
+        uint32_t timeout,
+        response_chunk_handler handler,
+        void* ctxt)
+{
+    // TODO send params with http request
+    UNUSED_PARAM(params);
 
-    m_req_id = ProcessIdentifier::generate().toUInt64();
-    NetworkResourceLoadParameters loadParameters;
-    loadParameters.identifier = m_req_id;
-    loadParameters.request = request;
-    loadParameters.webPageProxyID = WebPageProxyIdentifier::generate();
-    loadParameters.webPageID = PageIdentifier::generate();
-    loadParameters.webFrameID = FrameIdentifier::generate();
-    loadParameters.parentPID = getpid();
+    auto req = scheduleLoad(url, method, timeout,
+            PcFetcherRequest::createStreaming(this, generateRequestId(),
+                handler, ctxt));
+    return req->requestVariant();
+}
 
-    m_connection->send(
-            Messages::NetworkConnectionToWebProcess::ScheduleResourceLoad(
-                loadParameters), 0);
+purc_rwstream_t PcFetcherSession::requestSync(
+        const char* url,
+        enum pcfetcher_request_method method,
+        purc_variant_t params,
+        uint32_t timeout,
+        struct pcfetcher_resp_header *resp_header)
+{
+    // TODO send params with http request
+    UNUSED_PARAM(params);
+
+    auto req = scheduleLoad(url, method, timeout,
+            PcFetcherRequest::create(this, generateRequestId(), false,
+                NULL, NULL));
 
-    wait(timeout);
+    bool done = req->wait(timeout);
 
-    if (resp_header) {
-        resp_header->ret_code = m_resp_header.ret_code;
-        if (m_resp_header.mime_type) {
-            resp_header->mime_type = strdup(m_resp_header.mime_type);
+    // a late reply to a timed out request finds no receiver and is dropped
+    removeRequest(req->requestId());
+    if (!done) {
+        if (resp_header) {
+            resp_header->ret_code = 408;
+            resp_header->mime_type = NULL;
+            resp_header->sz_resp = 0;
         }
-        resp_header->sz_resp = m_resp_header.sz_resp;
+        return NULL;
     }
+    return req->takeResponse(resp_header);
+}
 
-    return m_resp_rwstream;
+size_t PcFetcherSession::inflightRequests(void)
+{
+    auto locker = holdLock(m_requestsLock);
+    return m_requests.size();
 }
 
-void PcFetcherSession::wait(uint32_t timeout)
+RefPtr<PcFetcherRequest> PcFetcherSession::findRequest(uint64_t reqId)
 {
-    m_waitForSyncReplySemaphore.waitFor(Seconds(timeout));
+    auto locker = holdLock(m_requestsLock);
+    return m_requests.get(reqId);
 }
 
-void PcFetcherSession::wakeUp(void)
+void PcFetcherSession::removeRequest(uint64_t reqId)
 {
-    m_waitForSyncReplySemaphore.signal();
+    auto locker = holdLock(m_requestsLock);
+    m_requests.remove(reqId);
 }
 
 void PcFetcherSession::didClose(IPC::Connection&)
 {
+    // the requests on this connection would wait forever
+    failPendingRequests();
 }
 
 void PcFetcherSession::didReceiveInvalidMessage(IPC::Connection&,
@@ -182,30 +223,40 @@ void PcFetcherSession::didReceiveInvalidMessage(IPC::Connection&,
 void PcFetcherSession::didReceiveMessage(IPC::Connection&,
         IPC::Decoder& decoder)
 {
+    // The lock is not held while dispatching, so the response handler
+    // is free to issue new requests on this session.
+    RefPtr<PcFetcherRequest> req = findRequest(decoder.destinationID());
+    if (!req) {
+        return;
+    }
+
     if (decoder.messageName() == Messages::WebResourceLoader::DidReceiveResponse::name()) {
         IPC::handleMessage<Messages::WebResourceLoader::DidReceiveResponse>(
-                decoder, this, &PcFetcherSession::didReceiveResponse);
-        return;
+                decoder, req.get(), &PcFetcherRequest::didReceiveResponse);
     }
-    if (decoder.messageName() == Messages::WebResourceLoader::DidReceiveSharedBuffer::name()) {
+    else if (decoder.messageName() == Messages::WebResourceLoader::DidReceiveSharedBuffer::name()) {
         IPC::handleMessage<Messages::WebResourceLoader::DidReceiveSharedBuffer>(
-                decoder, this, &PcFetcherSession::didReceiveSharedBuffer);
-        return;
+                decoder, req.get(), &PcFetcherRequest::didReceiveSharedBuffer);
+    }
+    else if (decoder.messageName() == Messages::WebResourceLoader::DidReceiveSharedMemory::name()) {
+        IPC::handleMessage<Messages::WebResourceLoader::DidReceiveSharedMemory>(
+                decoder, req.get(), &PcFetcherRequest::didReceiveSharedMemory);
     }
-    if (decoder.messageName() == Messages::WebResourceLoader::DidFinishResourceLoad::name()) {
+    else if (decoder.messageName() == Messages::WebResourceLoader::DidFinishResourceLoad::name()) {
         IPC::handleMessage<Messages::WebResourceLoader::DidFinishResourceLoad>(
-                decoder, this, &PcFetcherSession::didFinishResourceLoad);
-        return;
+                decoder, req.get(), &PcFetcherRequest::didFinishResourceLoad);
     }
-    if (decoder.messageName() == Messages::WebResourceLoader::DidFailResourceLoad::name()) {
+    else if (decoder.messageName() == Messages::WebResourceLoader::DidFailResourceLoad::name()) {
         IPC::handleMessage<Messages::WebResourceLoader::DidFailResourceLoad>(
-                decoder, this, &PcFetcherSession::didFailResourceLoad);
-        return;
+                decoder, req.get(), &PcFetcherRequest::didFailResourceLoad);
     }
-    if (decoder.messageName() == Messages::WebResourceLoader::WillSendRequest::name()) {
+    else if (decoder.messageName() == Messages::WebResourceLoader::WillSendRequest::name()) {
         IPC::handleMessage<Messages::WebResourceLoader::WillSendRequest>(
-                decoder, this, &PcFetcherSession::willSendRequest);
-        return;
+                decoder, req.get(), &PcFetcherRequest::willSendRequest);
+    }
+
+    if (req->isFinished() && req->isAsync()) {
+        removeRequest(req->requestId());
     }
 }
 
@@ -216,94 +267,3 @@ void PcFetcherSession::didReceiveSyncMessage(IPC::Connection& connection,
     UNUSED_PARAM(decoder);
     UNUSED_PARAM(replyEncoder);
 }
-
-void PcFetcherSession::didReceiveResponse(
-        const PurCFetcher::ResourceResponse& response,
-        bool needsContinueDidReceiveResponseMessage)
-{
-    UNUSED_PARAM(needsContinueDidReceiveResponseMessage);
-    m_resp_header.ret_code = response.httpStatusCode();
-    if (m_resp_header.mime_type) {
-        free(m_resp_header.mime_type);
-    }
-    const CString &utf8 = response.mimeType().utf8();
-    m_resp_header.mime_type = strdup((const char*)utf8.data());
-    m_resp_header.sz_resp = response.expectedContentLength();
-    if (m_resp_rwstream) {
-        purc_rwstream_destroy(m_resp_rwstream);
-    }
-    size_t init = m_resp_header.sz_resp ? m_resp_header.sz_resp : DEF_RWS_SIZE;
-    m_resp_rwstream = purc_rwstream_new_buffer(init, INT_MAX);
-}
-
-void PcFetcherSession::didReceiveSharedBuffer(
-        IPC::SharedBufferDataReference&& data, int64_t encodedDataLength)
-{
-    UNUSED_PARAM(encodedDataLength);
-    purc_rwstream_write(m_resp_rwstream, data.data(), data.size());
-}
-
-void PcFetcherSession::didFinishResourceLoad(
-        const NetworkLoadMetrics& networkLoadMetrics)
-{
-    UNUSED_PARAM(networkLoadMetrics);
-
-    if (m_is_async) {
-        if (m_req_handler) {
-            if (!m_resp_header.sz_resp && m_resp_rwstream) {
-                size_t sz_content = 0;
-                size_t sz_buffer = 0;
-                purc_rwstream_get_mem_buffer_ex(m_resp_rwstream, &sz_content,
-                        &sz_buffer, false);
-                m_resp_header.sz_resp = sz_content;
-            }
-            if (m_resp_rwstream) {
-                purc_rwstream_seek(m_resp_rwstream, 0, SEEK_SET);
-            }
-            m_req_handler(m_req_vid, m_req_ctxt,
-                    &m_resp_header, m_resp_rwstream);
-        }
-    }
-    else {
-        wakeUp();
-    }
-}
-
-void PcFetcherSession::didFailResourceLoad(const ResourceError& error)
-{
-    UNUSED_PARAM(error);
-    // TODO : trans error code
-    m_resp_header.ret_code = 408;
-
-    if (m_is_async) {
-        if (m_req_handler) {
-            if (!m_resp_header.sz_resp && m_resp_rwstream) {
-                size_t sz_content = 0;
-                size_t sz_buffer = 0;
-                purc_rwstream_get_mem_buffer_ex(m_resp_rwstream, &sz_content,
-                        &sz_buffer, false);
-                m_resp_header.sz_resp = sz_content;
-            }
-            if (m_resp_rwstream) {
-                purc_rwstream_seek(m_resp_rwstream, 0, SEEK_SET);
-            }
-            m_req_handler(m_req_vid, m_req_ctxt,
-                    &m_resp_header, m_resp_rwstream);
-        }
-    }
-    else {
-        wakeUp();
-    }
-}
-
-void PcFetcherSession::willSendRequest(ResourceRequest&& proposedRequest,
-        IPC::FormDataReference&& proposedRequestBody,
-        ResourceResponse&& redirectResponse)
-{
-    UNUSED_PARAM(proposedRequestBody);
-    UNUSED_PARAM(redirectResponse);
-    proposedRequest.setHTTPBody(proposedRequestBody.takeData());
-    m_connection->send(
-            Messages::NetworkResourceLoader::ContinueWillSendRequest(
-                proposedRequest, true), m_req_id);
-}
@@ -28,6 +28,7 @@
 #if ENABLE(LINK_PURC_FETCHER)
 
 #include "fetcher-internal.h"
+#include "fetcher-request.h"
 #include "fetcher-messages-basic.h"
 
 #include "WebCoreArgumentCoders.h"
@@ -37,6 +38,8 @@
 #include "ProcessLauncher.h"
 #include "FormDataReference.h"
 
+#include <wtf/HashMap.h>
+#include <wtf/Lock.h>
 #include <wtf/ProcessID.h>
 #include <wtf/SystemTracing.h>
 #include <wtf/ThreadSafeRefCounted.h>
@@ -76,8 +79,16 @@ public:
         uint32_t timeout,
         struct pcfetcher_resp_header *resp_header);
 
-    void wait(uint32_t timeout);
-    void wakeUp(void);
+    purc_variant_t requestStream(
+        const char* url,
+        enum pcfetcher_request_method method,
+        purc_variant_t params,
+        uint32_t timeout,
+        response_chunk_handler handler,
+        void* ctxt);
+
+    // The number of requests still waiting for their response.
+    size_t inflightRequests(void);
 
 protected:
     bool dispatchMessage(IPC::Connection&, IPC::Decoder&);
@@ -92,29 +103,23 @@ protected:
     void didReceiveSyncMessage(IPC::Connection&, IPC::Decoder&,
             std::unique_ptr<IPC::Encoder>&);
 
-    void didReceiveResponse(const PurCFetcher::ResourceResponse&, bool);
-    void didReceiveSharedBuffer(IPC::SharedBufferDataReference&&,
-            int64_t encodedDataLength);
-    void didFinishResourceLoad(const PurCFetcher::NetworkLoadMetrics&);
-    void didFailResourceLoad(const ResourceError& error);
-    void willSendRequest(ResourceRequest&&,
-            IPC::FormDataReference&& requestBody, ResourceResponse&&);
+    uint64_t generateRequestId(void);
+    Ref<PcFetcherRequest> scheduleLoad(const char* url,
+            enum pcfetcher_request_method method, uint32_t timeout,
+            Ref<PcFetcherRequest>&& req);
+
+    RefPtr<PcFetcherRequest> findRequest(uint64_t reqId);
+    void removeRequest(uint64_t reqId);
+    void failPendingRequests(void);
 
 private:
     uint64_t m_sessionId;
-    uint64_t m_req_id;
-    bool m_is_async;
 
     RefPtr<IPC::Connection> m_connection;
     IPC::MessageReceiverMap m_messageReceiverMap;
-    BinarySemaphore m_waitForSyncReplySemaphore;
-    struct pcfetcher_resp_header m_resp_header;
-
-    response_handler m_req_handler;
-    void* m_req_ctxt;
 
-    purc_rwstream_t m_resp_rwstream;
-    purc_variant_t m_req_vid;
+    Lock m_requestsLock;
+    HashMap<uint64_t, RefPtr<PcFetcherRequest>> m_requests;
 };
 
 
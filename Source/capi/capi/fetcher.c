@@ -44,8 +44,27 @@ int pcfetcher_init(size_t max_conns, size_t cache_quota)
     return 0;
 }
 
+int pcfetcher_prespawn(size_t max_conns, size_t cache_quota)
+{
+    if (s_fetcher) {
+        return 0;
+    }
+
+#if ENABLE(LINK_PURC_FETCHER)
+    return pcfetcher_remote_prespawn(max_conns, cache_quota);
+#else
+    UNUSED_PARAM(max_conns);
+    UNUSED_PARAM(cache_quota);
+    return 0;
+#endif
+}
+
 int pcfetcher_term(void)
 {
+#if ENABLE(LINK_PURC_FETCHER)
+    pcfetcher_remote_drop_prespawned();
+#endif
+
     if (!s_fetcher) {
         return 0;
     }
@@ -109,6 +128,17 @@ purc_rwstream_t pcfetcher_request_sync(
             params, timeout, resp_header) : NULL;
 }
 
+purc_variant_t pcfetcher_request_stream(
+        const char* url,
+        enum pcfetcher_request_method method,
+        purc_variant_t params,
+        uint32_t timeout,
+        response_chunk_handler handler,
+        void* ctxt)
+{
+    return s_fetcher ? s_fetcher->request_stream(s_fetcher, url, method,
+            params, timeout, handler, ctxt) : PURC_VARIANT_INVALID;
+}
 
 int pcfetcher_check_response(uint32_t timeout_ms)
 {
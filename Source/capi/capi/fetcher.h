@@ -51,13 +51,46 @@ typedef void (*response_handler)(
         const struct pcfetcher_resp_header *resp_header,
         purc_rwstream_t resp);
 
+/*
+ * Called for every piece of the body of a streamed response as it
+ * arrives, then once more with chunk set to NULL and sz_chunk to 0
+ * when the response is complete (or failed, see resp_header->ret_code).
+ * The chunk is only valid during the call.
+ */
+typedef void (*response_chunk_handler)(
+        purc_variant_t request_id, void* ctxt,
+        const struct pcfetcher_resp_header *resp_header,
+        const char* chunk, size_t sz_chunk);
+
 
 #ifdef __cplusplus
 extern "C" {
 #endif  /* __cplusplus */
 
+/*
+ * Initializes the fetcher. max_conns bounds the connections the fetcher
+ * opens to the servers; the requests of this process are multiplexed over
+ * at most four connections to the fetcher (max_conns when it is smaller).
+ * cache_quota bounds the disk cache in bytes; zero lets the fetcher size
+ * it from the free disk space, between 100MB and 1GB. The cache lives in
+ * the directory named by the PURC_FETCHER_CACHE_DIR environment variable,
+ * or in /tmp/fetcher/cache. PURC_FETCHER_CACHE_EVICTION picks how the
+ * cache makes room: "lru" (segmented LRU, the default) or "tinylfu"
+ * (W-TinyLFU, which also weighs how often records are used).
+ */
 int pcfetcher_init(size_t max_conns, size_t cache_quota);
 
+/*
+ * Launches and initializes a fetcher process ahead of pcfetcher_init(),
+ * so that the first request does not wait for the process to start.
+ * pcfetcher_init() takes this process over when it is called with the
+ * same arguments; otherwise the process is dropped and a new one is
+ * launched. Does nothing when the fetcher runs in the calling process.
+ * Like pcfetcher_init() and pcfetcher_term(), this is not thread-safe:
+ * the caller must not run these functions concurrently.
+ */
+int pcfetcher_prespawn(size_t max_conns, size_t cache_quota);
+
 int pcfetcher_term(void);
 
 const char* pcfetcher_set_base_url(const char* base_url);
@@ -88,6 +121,25 @@ purc_rwstream_t pcfetcher_request_sync(
         uint32_t timeout,
         struct pcfetcher_resp_header *resp_header);
 
+/*
+ * Like pcfetcher_request_async(), but hands the body to the handler
+ * chunk by chunk instead of buffering the whole response. The handlers
+ * are run by pcfetcher_check_response(); the transfer is paused while
+ * the calling thread has too many bytes left to consume.
+ */
+purc_variant_t pcfetcher_request_stream(
+        const char* url,
+        enum pcfetcher_request_method method,
+        purc_variant_t params,
+        uint32_t timeout,
+        response_chunk_handler handler,
+        void* ctxt);
+
+/*
+ * Run the handlers of the async requests issued by the calling thread
+ * which have completed, waiting up to timeout_ms for the first one.
+ * Returns the number of handlers run.
+ */
 int pcfetcher_check_response(uint32_t timeout_ms);
 
 #ifdef __cplusplus
@@ -96,6 +96,7 @@ template<typename AsyncReplyResult> struct AsyncReplyError {
 };
 
 class MachMessage;
+class MessageRing;
 class UnixMessage;
 
 class Connection : public ThreadSafeRefCounted<Connection, WTF::DestructionThread::MainRunLoop> {
@@ -133,6 +134,14 @@ public:
     };
 
     static Connection::SocketPair createPlatformConnection(unsigned options = SetCloexecOnClient | SetCloexecOnServer);
+
+    // The outgoing messages sent so far and the sendmsg() calls they took,
+    // to see how well they are gathered.
+    struct OutputStatistics {
+        uint64_t messageCount { 0 };
+        uint64_t sendmsgCount { 0 };
+    };
+    OutputStatistics outputStatistics() const { return { m_outputMessageCount.load(), m_sendmsgCount.load() }; }
 #endif
 
     static Ref<Connection> createServerConnection(Identifier, Client&);
@@ -358,12 +367,22 @@ private:
     // Called on the connection queue.
     void readyReadHandler();
     bool processMessage();
-    bool sendOutputMessage(UnixMessage&);
+    bool flushOutputMessages();
+    bool sendOutputMessages(size_t count);
 
     Vector<uint8_t> m_readBuffer;
     Vector<int> m_fileDescriptors;
     int m_socketDescriptor;
-    std::unique_ptr<UnixMessage> m_pendingOutputMessage;
+    // Prepared messages gathered to be sent with as few sendmsg() as possible.
+    Vector<std::unique_ptr<UnixMessage>> m_outputMessages;
+    size_t m_outputMessagesSize { 0 };
+    bool m_isWaitingForSocket { false };
+    std::atomic<uint64_t> m_outputMessageCount { 0 };
+    std::atomic<uint64_t> m_sendmsgCount { 0 };
+    // Carry the bodies too large to be sent inline, one per direction.
+    std::unique_ptr<MessageRing> m_outgoingMessageRing;
+    std::unique_ptr<MessageRing> m_incomingMessageRing;
+    bool m_didFailToCreateMessageRing { false };
 #if USE(GLIB)
     GRefPtr<GSocket> m_socket;
     GSocketMonitor m_readSocketMonitor;
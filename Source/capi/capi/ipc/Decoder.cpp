@@ -28,6 +28,7 @@
 
 #include "ArgumentCoders.h"
 #include "DataReference.h"
+#include "MessageBufferPool.h"
 #include "MessageFlags.h"
 #include <stdio.h>
 #include <wtf/StdLibExtras.h>
@@ -40,7 +41,8 @@ namespace IPC {
 
 static const uint8_t* copyBuffer(const uint8_t* buffer, size_t bufferSize)
 {
-    auto bufferCopy = static_cast<uint8_t*>(fastMalloc(bufferSize));
+    size_t capacity = bufferSize;
+    auto bufferCopy = MessageBufferPool::allocate(capacity);
     memcpy(bufferCopy, buffer, bufferSize);
 
     return bufferCopy;
@@ -81,7 +83,7 @@ Decoder::~Decoder()
     if (m_bufferDeallocator)
         m_bufferDeallocator(m_buffer, m_bufferEnd - m_buffer);
     else
-        fastFree(const_cast<uint8_t*>(m_buffer));
+        MessageBufferPool::deallocate(const_cast<uint8_t*>(m_buffer), m_bufferEnd - m_buffer);
 
     // FIXME: We need to dispose of the mach ports in cases of failure.
 
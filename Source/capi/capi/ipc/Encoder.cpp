@@ -27,6 +27,7 @@
 #include "Encoder.h"
 
 #include "DataReference.h"
+#include "MessageBufferPool.h"
 #include "MessageFlags.h"
 #include <algorithm>
 #include <wtf/OptionSet.h>
@@ -40,13 +41,13 @@ namespace IPC {
 static const uint8_t defaultMessageFlags = 0;
 
 template <typename T>
-static inline bool allocBuffer(T*& buffer, size_t size)
+static inline bool allocBuffer(T*& buffer, size_t& size)
 {
 #if OS(DARWIN)
     buffer = static_cast<T*>(mmap(0, size, PROT_READ | PROT_WRITE, MAP_ANON | MAP_PRIVATE, -1, 0));
     return buffer != MAP_FAILED;
 #else
-    buffer = static_cast<T*>(fastMalloc(size));
+    buffer = MessageBufferPool::allocate(size);
     return !!buffer;
 #endif
 }
@@ -56,11 +57,27 @@ static inline void freeBuffer(void* addr, size_t size)
 #if OS(DARWIN)
     munmap(addr, size);
 #else
-    UNUSED_PARAM(size);
-    fastFree(addr);
+    MessageBufferPool::deallocate(static_cast<uint8_t*>(addr), size);
 #endif
 }
 
+// The messages carrying a request or a response with its headers seldom
+// fit in the inline buffer. They start on a pooled buffer instead of
+// growing out of it.
+static size_t initialBufferCapacity(MessageName messageName)
+{
+    switch (messageName) {
+    case MessageName::NetworkConnectionToWebProcess_ScheduleResourceLoad:
+    case MessageName::NetworkConnectionToWebProcess_PerformSynchronousLoad:
+    case MessageName::NetworkResourceLoader_ContinueWillSendRequest:
+    case MessageName::WebResourceLoader_WillSendRequest:
+    case MessageName::WebResourceLoader_DidReceiveResponse:
+        return 4096;
+    default:
+        return 0;
+    }
+}
+
 Encoder::Encoder(MessageName messageName, uint64_t destinationID)
     : m_messageName(messageName)
     , m_destinationID(destinationID)
@@ -69,6 +86,7 @@ Encoder::Encoder(MessageName messageName, uint64_t destinationID)
     , m_bufferSize(0)
     , m_bufferCapacity(sizeof(m_inlineBuffer))
 {
+    reserve(initialBufferCapacity(messageName));
     encodeHeader();
 }
 
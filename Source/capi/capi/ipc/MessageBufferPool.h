@@ -0,0 +1,96 @@
+/* 
+ * Copyright (C) 2020 Beijing FMSoft Technologies Co., Ltd.
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ * 
+ * Or,
+ * 
+ * As this component is a program released under LGPLv3, which claims
+ * explicitly that the program could be modified by any end user
+ * even if the program is conveyed in non-source form on the system it runs.
+ * Generally, if you distribute this program in embedded devices,
+ * you might not satisfy this condition. Under this situation or you can
+ * not accept any condition of LGPLv3, you need to get a commercial license
+ * from FMSoft, along with a patent license for the patents owned by FMSoft.
+ * 
+ * If you have got a commercial/patent license of this program, please use it
+ * under the terms and conditions of the commercial license.
+ * 
+ * For more information about the commercial license and patent license,
+ * please refer to
+ * <https://hybridos.fmsoft.cn/blog/hybridos-licensing-policy/>.
+ * 
+ * Also note that the LGPLv3 license does not apply to any entity in the
+ * Exception List published by Beijing FMSoft Technologies Co., Ltd.
+ * 
+ * If you are or the entity you represent is listed in the Exception List,
+ * the above open source or free software license does not apply to you
+ * or the entity you represent. Regardless of the purpose, you should not
+ * use the software in any way whatsoever, including but not limited to
+ * downloading, viewing, copying, distributing, compiling, and running.
+ * If you have already downloaded it, you MUST destroy all of its copies.
+ * 
+ * The Exception List is published by FMSoft and may be updated
+ * from time to time. For more information, please see
+ * <https://www.fmsoft.cn/exception-list>.
+ */ 
+
+#pragma once
+
+#include <wtf/FastMalloc.h>
+#include <wtf/Noncopyable.h>
+#include <wtf/Vector.h>
+
+namespace IPC {
+
+// The heap buffers of encoders and of the decoders' copies of received
+// messages. They come in power-of-two size classes, and a freed buffer is
+// kept in a cache of the freeing thread for the next message of its class.
+//
+// Encoders mostly release their buffer on the connection thread, which in
+// turn allocates the decoders' copies; the threads sending and handling
+// messages do the opposite. Both kinds share the cache so that each thread
+// gets back what it gives away.
+class MessageBufferPool {
+    WTF_MAKE_FAST_ALLOCATED;
+    WTF_MAKE_NONCOPYABLE(MessageBufferPool);
+public:
+    // The capacity is rounded up to the size class. Deallocating with the
+    // requested capacity or the rounded one puts the buffer in the same class.
+    static uint8_t* allocate(size_t& capacity);
+    static void deallocate(uint8_t*, size_t capacity);
+
+    // The buffers handed out by the pool of the current thread.
+    struct Statistics {
+        uint64_t allocationCount { 0 };
+        uint64_t reuseCount { 0 };
+    };
+    static Statistics statistics();
+
+    MessageBufferPool() = default;
+    ~MessageBufferPool();
+
+private:
+    static MessageBufferPool& current();
+
+    static constexpr size_t minimumSizeClassShift = 9;
+    static constexpr size_t sizeClassCount = 10;
+    static size_t sizeClass(size_t capacity);
+
+    Vector<uint8_t*> m_freeBuffers[sizeClassCount];
+    size_t m_cachedSize { 0 };
+    Statistics m_statistics;
+};
+
+} // namespace IPC
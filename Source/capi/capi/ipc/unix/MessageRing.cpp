@@ -0,0 +1,124 @@
+/* 
+ * Copyright (C) 2020 Beijing FMSoft Technologies Co., Ltd.
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ * 
+ * Or,
+ * 
+ * As this component is a program released under LGPLv3, which claims
+ * explicitly that the program could be modified by any end user
+ * even if the program is conveyed in non-source form on the system it runs.
+ * Generally, if you distribute this program in embedded devices,
+ * you might not satisfy this condition. Under this situation or you can
+ * not accept any condition of LGPLv3, you need to get a commercial license
+ * from FMSoft, along with a patent license for the patents owned by FMSoft.
+ * 
+ * If you have got a commercial/patent license of this program, please use it
+ * under the terms and conditions of the commercial license.
+ * 
+ * For more information about the commercial license and patent license,
+ * please refer to
+ * <https://hybridos.fmsoft.cn/blog/hybridos-licensing-policy/>.
+ * 
+ * Also note that the LGPLv3 license does not apply to any entity in the
+ * Exception List published by Beijing FMSoft Technologies Co., Ltd.
+ * 
+ * If you are or the entity you represent is listed in the Exception List,
+ * the above open source or free software license does not apply to you
+ * or the entity you represent. Regardless of the purpose, you should not
+ * use the software in any way whatsoever, including but not limited to
+ * downloading, viewing, copying, distributing, compiling, and running.
+ * If you have already downloaded it, you MUST destroy all of its copies.
+ * 
+ * The Exception List is published by FMSoft and may be updated
+ * from time to time. For more information, please see
+ * <https://www.fmsoft.cn/exception-list>.
+ */ 
+
+#include "config.h"
+#include "MessageRing.h"
+
+namespace IPC {
+
+static const size_t messageRingCapacity = 4 * MB;
+static_assert(MessageRing::maxBodySize <= messageRingCapacity, "A body must fit in an empty ring.");
+
+std::unique_ptr<MessageRing> MessageRing::create()
+{
+    // The memory comes zeroed, so does the read position.
+    auto memory = PurCFetcher::SharedMemory::allocate(sizeof(Header) + messageRingCapacity);
+    if (!memory)
+        return nullptr;
+
+    return std::unique_ptr<MessageRing>(new MessageRing(memory.releaseNonNull()));
+}
+
+std::unique_ptr<MessageRing> MessageRing::map(const PurCFetcher::SharedMemory::Handle& handle)
+{
+    auto memory = PurCFetcher::SharedMemory::map(handle, PurCFetcher::SharedMemory::Protection::ReadWrite);
+    if (!memory || memory->size() <= sizeof(Header))
+        return nullptr;
+
+    return std::unique_ptr<MessageRing>(new MessageRing(memory.releaseNonNull()));
+}
+
+MessageRing::MessageRing(Ref<PurCFetcher::SharedMemory>&& memory)
+    : m_memory(WTFMove(memory))
+    , m_capacity(m_memory->size() - sizeof(Header))
+{
+}
+
+bool MessageRing::createHandle(PurCFetcher::SharedMemory::Handle& handle)
+{
+    return m_memory->createHandle(handle, PurCFetcher::SharedMemory::Protection::ReadWrite);
+}
+
+Optional<uint64_t> MessageRing::write(const uint8_t* body, size_t size)
+{
+    if (size > maxBodySize)
+        return WTF::nullopt;
+
+    // A body never wraps around: it starts over at the beginning of the
+    // ring instead, and the bytes skipped are freed with it.
+    uint64_t position = m_writePosition;
+    size_t offset = position % m_capacity;
+    if (offset + size > m_capacity) {
+        position += m_capacity - offset;
+        offset = 0;
+    }
+
+    uint64_t readPosition = header().readPosition.load(std::memory_order_acquire);
+    if (position + size - readPosition > m_capacity)
+        return WTF::nullopt;
+
+    memcpy(data() + offset, body, size);
+    m_writePosition = position + size;
+    return position;
+}
+
+const uint8_t* MessageRing::bodyAt(uint64_t position, size_t size) const
+{
+    size_t offset = position % m_capacity;
+    if (size > m_capacity || offset + size > m_capacity)
+        return nullptr;
+
+    return data() + offset;
+}
+
+void MessageRing::release(uint64_t position, size_t size)
+{
+    header().readPosition.store(position + size, std::memory_order_release);
+}
+
+} // namespace IPC
@@ -33,6 +33,7 @@
 #include "Encoder.h"
 #include <errno.h>
 #include <fcntl.h>
+#include <stdio.h>
 #include <stdlib.h>
 #include <sys/mman.h>
 #include <sys/stat.h>
@@ -215,15 +216,43 @@ SharedMemory::~SharedMemory()
         closeWithRetry(m_fileDescriptor.value());
 }
 
-bool SharedMemory::createHandle(Handle& handle, Protection)
+#if OS(LINUX)
+// A new open file description of the region which only allows reading;
+// a dup() would carry the write access of ours along.
+static int reopenReadOnly(int fileDescriptor)
+{
+    char path[32];
+    snprintf(path, sizeof(path), "/proc/self/fd/%d", fileDescriptor);
+
+    int readOnlyFileDescriptor;
+    do {
+        readOnlyFileDescriptor = open(path, O_RDONLY | O_CLOEXEC);
+    } while (readOnlyFileDescriptor == -1 && errno == EINTR);
+    return readOnlyFileDescriptor;
+}
+#endif
+
+bool SharedMemory::createHandle(Handle& handle, Protection protection)
 {
     ASSERT_ARG(handle, handle.isNull());
     ASSERT(m_fileDescriptor);
 
+    int duplicatedHandle = -1;
+#if OS(LINUX)
+    if (protection == Protection::ReadOnly) {
+        duplicatedHandle = reopenReadOnly(m_fileDescriptor.value());
+        // Without /proc mounted, fall back to a duplicate as elsewhere.
+        if (duplicatedHandle == -1 && errno != ENOENT)
+            return false;
+    }
+#else
     // FIXME: Handle the case where the passed Protection is ReadOnly.
     // See https://bugs.webkit.org/show_bug.cgi?id=131542.
+    UNUSED_PARAM(protection);
+#endif
 
-    int duplicatedHandle = dupCloseOnExec(m_fileDescriptor.value());
+    if (duplicatedHandle == -1)
+        duplicatedHandle = dupCloseOnExec(m_fileDescriptor.value());
     if (duplicatedHandle == -1) {
         ASSERT_NOT_REACHED();
         return false;
@@ -40,6 +40,9 @@ NetworkProcessCreationParameters::NetworkProcessCreationParameters() = default;
 void NetworkProcessCreationParameters::encode(IPC::Encoder& encoder) const
 {
     encoder << cacheModel;
+    encoder << maxConnections;
+    encoder << cacheQuota;
+    encoder << cacheEvictionPolicy;
 #if PLATFORM(MAC) || PLATFORM(MACCATALYST)
     encoder << uiProcessCookieStorageIdentifier;
 #endif
@@ -82,6 +85,12 @@ bool NetworkProcessCreationParameters::decode(IPC::Decoder& decoder, NetworkProc
 {
     if (!decoder.decode(result.cacheModel))
         return false;
+    if (!decoder.decode(result.maxConnections))
+        return false;
+    if (!decoder.decode(result.cacheQuota))
+        return false;
+    if (!decoder.decode(result.cacheEvictionPolicy))
+        return false;
 
 #if PLATFORM(MAC) || PLATFORM(MACCATALYST)
     if (!decoder.decode(result.uiProcessCookieStorageIdentifier))
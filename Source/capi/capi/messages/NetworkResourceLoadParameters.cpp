@@ -112,6 +112,7 @@ void NetworkResourceLoadParameters::encode(IPC::Encoder& encoder) const
     encoder << crossOriginAccessControlCheckEnabled;
 
     encoder << isNavigatingToAppBoundDomain;
+    encoder << shouldSendBodyAsSharedMemory;
 }
 
 Optional<NetworkResourceLoadParameters> NetworkResourceLoadParameters::decode(IPC::Decoder& decoder)
@@ -270,6 +271,12 @@ Optional<NetworkResourceLoadParameters> NetworkResourceLoadParameters::decode(IP
         return WTF::nullopt;
     result.isNavigatingToAppBoundDomain = *isNavigatingToAppBoundDomain;
 
+    Optional<bool> shouldSendBodyAsSharedMemory;
+    decoder >> shouldSendBodyAsSharedMemory;
+    if (!shouldSendBodyAsSharedMemory)
+        return WTF::nullopt;
+    result.shouldSendBodyAsSharedMemory = *shouldSendBodyAsSharedMemory;
+
     return result;
 }
 
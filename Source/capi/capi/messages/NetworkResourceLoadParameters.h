@@ -63,6 +63,10 @@ public:
     bool crossOriginAccessControlCheckEnabled { true };
 
     Optional<NavigatingToAppBoundDomain> isNavigatingToAppBoundDomain { NavigatingToAppBoundDomain::No };
+
+    // The client wants the whole body at once: it is delivered in a single
+    // read-only shared memory region instead of SharedBuffer chunks.
+    bool shouldSendBodyAsSharedMemory { false };
 };
 
 } // namespace PurCFetcher
@@ -31,6 +31,7 @@
 #include "Attachment.h"
 #include "Connection.h"
 #include "MessageNames.h"
+#include "SharedMemory.h"
 
 #include <wtf/Optional.h>
 #include <wtf/Forward.h>
@@ -190,6 +191,27 @@ private:
     Arguments m_arguments;
 };
 
+class SetDefersLoading {
+public:
+    using Arguments = std::tuple<bool>;
+
+    static IPC::MessageName name() { return IPC::MessageName::NetworkResourceLoader_SetDefersLoading; }
+    static const bool isSync = false;
+
+    explicit SetDefersLoading(bool defers)
+        : m_arguments(defers)
+    {
+    }
+
+    const Arguments& arguments() const
+    {
+        return m_arguments;
+    }
+
+private:
+    Arguments m_arguments;
+};
+
 } // namespace NetworkResourceLoader
 
 namespace WebResourceLoader {
@@ -304,6 +326,27 @@ private:
     Arguments m_arguments;
 };
 
+class DidReceiveSharedMemory {
+public:
+    using Arguments = std::tuple<const PurCFetcher::SharedMemory::Handle&, uint64_t>;
+
+    static IPC::MessageName name() { return IPC::MessageName::WebResourceLoader_DidReceiveSharedMemory; }
+    static const bool isSync = false;
+
+    DidReceiveSharedMemory(const PurCFetcher::SharedMemory::Handle& body, uint64_t bodySize)
+        : m_arguments(body, bodySize)
+    {
+    }
+
+    const Arguments& arguments() const
+    {
+        return m_arguments;
+    }
+
+private:
+    Arguments m_arguments;
+};
+
 class DidFinishResourceLoad {
 public:
     using Arguments = std::tuple<const PurCFetcher::NetworkLoadMetrics&>;
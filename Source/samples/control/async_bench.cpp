@@ -0,0 +1,83 @@
+#include "purc/purc.h"
+#include "capi/fetcher.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <unistd.h>
+
+// Measures request throughput over the pooled fetcher sessions: keeps
+// a number of async requests in flight until the given count completed.
+//
+// usage: async_bench [url] [count] [inflight]
+
+const char* def_url = "https://hybridos.fmsoft.cn";
+static size_t s_completed = 0;
+static size_t s_failed = 0;
+
+static double now_ms(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1000.0 + ts.tv_nsec / 1000000.0;
+}
+
+void async_response_handler(
+        purc_variant_t request_id, void* ctxt,
+        const struct pcfetcher_resp_header *resp_header,
+        purc_rwstream_t resp)
+{
+    (void)ctxt;
+    s_completed++;
+    if (resp_header->ret_code != 200) {
+        s_failed++;
+    }
+    if (resp) {
+        purc_rwstream_destroy(resp);
+    }
+    if (request_id != PURC_VARIANT_INVALID) {
+        purc_variant_unref(request_id);
+    }
+}
+
+int main(int argc, char** argv)
+{
+    purc_instance_extra_info info = {};
+    purc_init ("cn.fmsoft.hybridos.sample", "pcfetcher", &info);
+
+    const char* url = argc > 1 ? argv[1] : def_url;
+    size_t count = argc > 2 ? (size_t)atoi(argv[2]) : 1000;
+    size_t inflight = argc > 3 ? (size_t)atoi(argv[3]) : 64;
+
+    size_t issued = 0;
+    double start = now_ms();
+    while (s_completed < count) {
+        while (issued < count && issued - s_completed < inflight) {
+            purc_variant_t req_id = pcfetcher_request_async(
+                    url,
+                    PCFETCHER_REQUEST_METHOD_GET,
+                    NULL,
+                    10,
+                    async_response_handler,
+                    NULL);
+            if (req_id == PURC_VARIANT_INVALID) {
+                fprintf(stderr, "failed to issue request %zu\n", issued);
+                count = issued;
+                break;
+            }
+            issued++;
+        }
+        pcfetcher_check_response(100);
+    }
+    double elapsed = now_ms() - start;
+
+    fprintf(stderr, "url=%s\n", url);
+    fprintf(stderr, "requests=%zu failed=%zu inflight=%zu\n",
+            s_completed, s_failed, inflight);
+    fprintf(stderr, "time=%.2fms rate=%.2freq/s\n", elapsed,
+            elapsed > 0 ? s_completed / (elapsed / 1000.0) : 0);
+
+    purc_cleanup();
+
+    return 0;
+}
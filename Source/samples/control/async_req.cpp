@@ -8,6 +8,7 @@
 
 const char* def_url = "https://hybridos.fmsoft.cn";
 const char* url = NULL;
+static bool s_done = false;
 
 void async_response_handler(
         purc_variant_t request_id, void* ctxt,
@@ -41,7 +42,7 @@ void async_response_handler(
     if (request_id != PURC_VARIANT_INVALID) {
         purc_variant_unref(request_id);
     }
-    RunLoop::current().stop();
+    s_done = true;
 }
 
 
@@ -64,9 +65,11 @@ int main(int argc, char** argv)
                 NULL);
 
     if (req_id != PURC_VARIANT_INVALID) {
-        RunLoop::run();
+        while (!s_done) {
+            pcfetcher_check_response(100);
+        }
     }
-    fprintf(stderr, "....................................after runloop\n");
+    fprintf(stderr, "....................................after check response\n");
 
     purc_cleanup();
 
@@ -18,7 +18,8 @@
 class ThreadFetcher
 {
 public:
-    ThreadFetcher(int idx, const char *name, const char *url) : idx(idx)
+    ThreadFetcher(int idx, const char *name, const char *url)
+        : idx(idx), isRun(false), isDone(false)
     {
         if (url) {
             this->url = strdup(url);
@@ -57,13 +58,12 @@ public:
         if (request_id != PURC_VARIANT_INVALID) {
             purc_variant_unref(request_id);
         }
-        tf->runLoop->stop();
+        tf->isDone = true;
     }
 
     void run() {
         isRun = true;
         Thread::create(name, [&] {
-                runLoop = &RunLoop::current();
                 initPurc();
 
                 fprintf(stderr, "req|idx=%d|name=%s|url=%s\n", idx, name,
@@ -74,7 +74,9 @@ public:
                         10,
                         async_handler,
                         this);
-                runLoop->run();
+                while (!isDone) {
+                    pcfetcher_check_response(100);
+                }
                 cleanupPurc();
                 waitRunLoopExit.signal();
                 })->detach();
@@ -97,9 +99,9 @@ private:
 private:
     int idx;
     bool isRun;
+    bool isDone;
     char *name;
     char *url;
-    RunLoop* runLoop;
     BinarySemaphore waitRunLoopExit;
 };
 
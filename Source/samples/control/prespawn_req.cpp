@@ -0,0 +1,77 @@
+#include "purc/purc.h"
+#include "capi/fetcher.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+// Measures the time from start to the first response, with or without
+// launching the fetcher ahead with pcfetcher_prespawn().
+//
+// usage: prespawn_req [-p] [url] [startup_ms]
+//   -p: prespawn the fetcher before the rest of the startup
+//   startup_ms: the other startup work of the caller, simulated by a
+//   sleep, which the launch of a prespawned fetcher overlaps
+
+const char* def_url = "https://hybridos.fmsoft.cn";
+
+static double now_ms(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1000.0 + ts.tv_nsec / 1000000.0;
+}
+
+int main(int argc, char** argv)
+{
+    int arg = 1;
+    bool prespawn = false;
+    if (argc > arg && strcmp(argv[arg], "-p") == 0) {
+        prespawn = true;
+        arg++;
+    }
+    const char* url = argc > arg ? argv[arg++] : def_url;
+    int startup_ms = argc > arg ? atoi(argv[arg++]) : 100;
+
+    double start = now_ms();
+    // the same arguments as pcfetcher_init() below, or the prespawned
+    // process is dropped
+    if (prespawn) {
+        pcfetcher_prespawn(0, 0);
+    }
+
+    usleep(startup_ms * 1000);
+
+    purc_instance_extra_info info = {};
+    purc_init ("cn.fmsoft.hybridos.sample", "pcfetcher", &info);
+    pcfetcher_init(0, 0);
+    double init = now_ms();
+
+    struct pcfetcher_resp_header resp_header;
+    purc_rwstream_t resp = pcfetcher_request_sync(
+        url,
+        PCFETCHER_REQUEST_METHOD_GET,
+        NULL,
+        10,
+        &resp_header);
+    double end = now_ms();
+
+    fprintf(stderr, "url=%s prespawn=%d\n", url, prespawn);
+    fprintf(stderr, "ret_code=%d\n", resp_header.ret_code);
+    fprintf(stderr, "init=%.2fms first_response=%.2fms total=%.2fms\n",
+            init - start, end - init, end - start);
+
+    if (resp) {
+        purc_rwstream_destroy(resp);
+    }
+    if (resp_header.mime_type) {
+        free(resp_header.mime_type);
+    }
+
+    pcfetcher_term();
+    purc_cleanup();
+
+    return 0;
+}
@@ -0,0 +1,85 @@
+#include "purc/purc.h"
+#include "capi/fetcher.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <unistd.h>
+
+// Streams a response with pcfetcher_request_stream() and reports how
+// many chunks and bytes arrived, and how fast.
+//
+// usage: stream_req [url] [delay_us]
+//   delay_us: time the handler spends on every chunk, to see the
+//   transfer pause and resume while the caller falls behind
+
+const char* def_url = "https://hybridos.fmsoft.cn";
+static bool s_done = false;
+static int s_ret_code = 0;
+static size_t s_chunks = 0;
+static size_t s_bytes = 0;
+static useconds_t s_delay = 0;
+
+static double now_ms(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1000.0 + ts.tv_nsec / 1000000.0;
+}
+
+void stream_chunk_handler(
+        purc_variant_t request_id, void* ctxt,
+        const struct pcfetcher_resp_header *resp_header,
+        const char* chunk, size_t sz_chunk)
+{
+    (void)ctxt;
+    if (chunk) {
+        s_chunks++;
+        s_bytes += sz_chunk;
+        if (s_delay) {
+            usleep(s_delay);
+        }
+        return;
+    }
+
+    s_ret_code = resp_header->ret_code;
+    if (request_id != PURC_VARIANT_INVALID) {
+        purc_variant_unref(request_id);
+    }
+    s_done = true;
+}
+
+int main(int argc, char** argv)
+{
+    purc_instance_extra_info info = {};
+    purc_init ("cn.fmsoft.hybridos.sample", "pcfetcher", &info);
+
+    const char* url = argc > 1 ? argv[1] : def_url;
+    s_delay = argc > 2 ? (useconds_t)atoi(argv[2]) : 0;
+
+    double start = now_ms();
+    purc_variant_t req_id = pcfetcher_request_stream(
+                url,
+                PCFETCHER_REQUEST_METHOD_GET,
+                NULL,
+                0,
+                stream_chunk_handler,
+                NULL);
+
+    if (req_id != PURC_VARIANT_INVALID) {
+        while (!s_done) {
+            pcfetcher_check_response(100);
+        }
+    }
+    double elapsed = now_ms() - start;
+
+    fprintf(stderr, "url=%s\n", url);
+    fprintf(stderr, "ret_code=%d\n", s_ret_code);
+    fprintf(stderr, "chunks=%zu bytes=%zu time=%.2fms rate=%.2fMB/s\n",
+            s_chunks, s_bytes, elapsed,
+            elapsed > 0 ? s_bytes / 1024.0 / 1024.0 / (elapsed / 1000.0) : 0);
+
+    purc_cleanup();
+
+    return 0;
+}